@@ -13,7 +13,6 @@ TO DO:
 	- fog support in all shaders
 	- add water rendering options (light reflection, scene reflection, fbos' resolutions, etc.)
 	- change water reflection fbo resolution based on camera's distance from water
-	- add possibility to add particle to the same particle group every frame
 
 	+ make texture atlas support for 2D
 	+ organize whole code
@@ -22,6 +21,7 @@ TO DO:
 	+ add support for rendering closest lights when there are too many important lights
 	+ 2d camera zooming in and out
 	+ check if FrameBuffer class should have std::vector of texture ids
+	+ add possibility to add particle to the same particle group every frame
 
 */
 
@@ -32,6 +32,7 @@ TO DO:
 // Normal Includes
 #include <iostream>
 #include <vector>
+#include <cstdlib>
 
 // Gumi Gota Engine Includes
 #include "../../Gumi Gota/src/GumiGota.h"
@@ -159,6 +160,852 @@ int main()
 }
 #endif
 
+#if 0
+int main() //2D culling benchmark - 1M sprites in world 500 times bigger than screen, about 2k visible
+{
+	using namespace gg;
+
+	/* Window Setup */
+	Window window("Gumi Gota Engine v0.0.1 - 2D Culling Benchmark", 1280, 720);
+
+	const unsigned int spriteCount = 1000000;
+	const vector2 worldSize(1280.0f * 25.0f, 720.0f * 20.0f);
+
+
+	/* TESTING STUFF */
+	Layer2D layer(window);
+	layer.reserveSprites(spriteCount);
+
+	std::vector<Sprite2D> sprites;
+	sprites.reserve(spriteCount);
+
+	for (unsigned int i = 0; i < spriteCount; i++)
+	{
+		vector2 pos(worldSize.x * (float)std::rand() / RAND_MAX, worldSize.y * (float)std::rand() / RAND_MAX);
+
+		sprites.push_back(Sprite2D(pos, vector2(16.0f, 16.0f), (float)std::rand() / RAND_MAX));
+		sprites.back().setColor(Color((float)std::rand() / RAND_MAX, (float)std::rand() / RAND_MAX, (float)std::rand() / RAND_MAX));
+	}
+
+	for (Sprite2D& sprite : sprites)
+		layer.addSprite(&sprite);
+
+	Camera2D camera(vector2(0.0f, 0.0f), vector2(1280.0f, 720.0f));
+	vector2 cameraVelocity(240.0f, 150.0f);
+
+	std::vector<Sprite2D*> visibleSprites;
+
+
+	Timer fpsTimer; //used for fps calculating
+	Timer secondTimer; //used for fps calculating
+	Timer deltaTimeTimer;
+
+	float totalQueryTime = 0.0f;
+	unsigned int frames = 0;
+
+	/* APPLICATION LOOP */
+	while (!window.closed())
+	{
+		fpsTimer.reset(); //used for fps calculating
+
+		/* Clearing */
+		window.clear();
+
+		/* Updating */
+		float deltaTime = deltaTimeTimer.elapsed();
+		deltaTimeTimer.reset();
+
+		// Bouncing Camera Around World
+		camera.move(cameraVelocity * deltaTime);
+
+		if (camera.getPosition().x < 0.0f || camera.getPosition().x > worldSize.x - 1280.0f)
+			cameraVelocity.x = -cameraVelocity.x;
+
+		if (camera.getPosition().y < 0.0f || camera.getPosition().y > worldSize.y - 720.0f)
+			cameraVelocity.y = -cameraVelocity.y;
+
+		// Measuring Query Alone
+		Timer queryTimer;
+
+		visibleSprites.clear();
+		layer.getVisibleSprites(camera.getPosition(), camera.getPosition() + vector2(1280.0f, 720.0f), visibleSprites);
+
+		totalQueryTime += queryTimer.elapsed();
+		frames++;
+
+		/* Rendering */
+		layer.render(camera);
+
+		/* Drawing */
+		window.update();
+
+		// FPS Calculations
+		if (secondTimer.elapsed() >= 1.0f)
+		{
+			std::cout << "[Info] FPS: " << 1.0f / fpsTimer.elapsed() << ", visible sprites: " << visibleSprites.size() << ", average query time: " << totalQueryTime / frames * 1000.0f << " ms" << std::endl;
+			secondTimer.reset();
+
+			totalQueryTime = 0.0f;
+			frames = 0;
+		}
+	}
+
+
+	return 0;
+}
+#endif
+
+#if 0
+int main() //sorting benchmark - closest light selection on random and nearly sorted distances
+{
+	using namespace gg;
+
+	const unsigned int valueCount = 100000;
+	const unsigned int selectedCount = 8;
+	const unsigned int repeats = 100;
+
+	/* TESTING STUFF */
+	std::vector<float> randomValues;
+	std::vector<float> nearlySortedValues; //like distances from previous frame after small camera move
+	randomValues.reserve(valueCount);
+	nearlySortedValues.reserve(valueCount);
+
+	for (unsigned int i = 0; i < valueCount; i++)
+	{
+		randomValues.push_back(1000.0f * (float)std::rand() / RAND_MAX);
+		nearlySortedValues.push_back((float)i + 4.0f * (float)std::rand() / RAND_MAX);
+	}
+
+	const std::vector<float>* inputs[2] = { &randomValues, &nearlySortedValues };
+	const char* inputNames[2] = { "random", "nearly sorted" };
+
+	std::vector<unsigned int> indices;
+
+	for (unsigned int input = 0; input < 2; input++)
+	{
+		const std::vector<float>& values = *inputs[input];
+
+		// Full Key Sort
+		Timer timer;
+		for (unsigned int i = 0; i < repeats; i++)
+			sortIndicesByKeys(values.data(), values.size(), indices);
+
+		std::cout << "[Info] " << inputNames[input] << ", radix key sort: " << timer.elapsed() / repeats * 1000.0f << " ms" << std::endl;
+
+		// Full Comparison Sort
+		timer.reset();
+		for (unsigned int i = 0; i < repeats; i++)
+			selectLowestIndices(values.data(), values.size(), values.size(), indices);
+
+		std::cout << "[Info] " << inputNames[input] << ", comparison key sort: " << timer.elapsed() / repeats * 1000.0f << " ms" << std::endl;
+
+		// Top-K Selection
+		timer.reset();
+		for (unsigned int i = 0; i < repeats; i++)
+			selectLowestIndices(values.data(), values.size(), selectedCount, indices);
+
+		std::cout << "[Info] " << inputNames[input] << ", top " << selectedCount << " selection: " << timer.elapsed() / repeats * 1000.0f << " ms" << std::endl;
+
+		// Values Sort
+		std::vector<float> copy;
+
+		timer.reset();
+		for (unsigned int i = 0; i < repeats; i++)
+		{
+			copy = values;
+			radixSortValues(copy);
+		}
+
+		std::cout << "[Info] " << inputNames[input] << ", radix values sort: " << timer.elapsed() / repeats * 1000.0f << " ms" << std::endl;
+	}
+
+
+	return 0;
+}
+#endif
+
+#if 0
+int main() //closest lights benchmark - 50k lights, camera flying through them while some lights move
+{
+	using namespace gg;
+
+	const unsigned int lightCount = 50000;
+	const unsigned int selectedCount = 16;
+	const unsigned int frames = 1000;
+	const float worldSize = 2000.0f;
+
+	/* TESTING STUFF */
+	std::vector<Light3D> lights;
+	lights.reserve(lightCount);
+
+	for (unsigned int i = 0; i < lightCount; i++)
+		lights.push_back(Light3D(vector3(worldSize * (float)std::rand() / RAND_MAX, worldSize * (float)std::rand() / RAND_MAX, worldSize * (float)std::rand() / RAND_MAX)));
+
+	std::vector<Light3D*> lightPointers;
+	LightGrid3D grid(40.0f);
+
+	for (unsigned int i = 0; i < lightCount; i++)
+	{
+		lightPointers.push_back(&lights[i]);
+		lights[i].setLightGrid(&grid, i);
+	}
+
+	std::vector<unsigned int> result;
+	unsigned int mismatches = 0;
+
+	// Camera Flying Through Lights (some lights move every frame)
+	float bruteForceTime = 0.0f;
+	float gridTime = 0.0f;
+
+	for (unsigned int frame = 0; frame < frames; frame++)
+	{
+		vector3 cameraPosition(frame * 1.5f, worldSize * 0.5f, worldSize * 0.5f);
+
+		for (unsigned int i = 0; i < 100; i++)
+			lights[std::rand() % lightCount].move(vector3(1.0f, 0.0f, -1.0f));
+
+		Timer timer;
+		std::vector<unsigned int> expected = getClosestLightsIndices(cameraPosition, lightPointers, selectedCount);
+		bruteForceTime += timer.elapsed();
+
+		timer.reset();
+		grid.getClosest(cameraPosition, selectedCount, result);
+		gridTime += timer.elapsed();
+
+		if (result != expected)
+			mismatches++;
+	}
+
+	std::cout << "[Info] brute force: " << bruteForceTime / frames * 1000.0f << " ms, grid: " << gridTime / frames * 1000.0f << " ms, mismatches: " << mismatches << std::endl;
+
+	// Camera Standing Still (previous result is reused)
+	Timer timer;
+	for (unsigned int frame = 0; frame < frames; frame++)
+		grid.getClosest(vector3(worldSize * 0.5f), selectedCount, result);
+
+	std::cout << "[Info] grid with nothing moving: " << timer.elapsed() / frames * 1000.0f << " ms" << std::endl;
+
+
+	return 0;
+}
+#endif
+
+#if 0
+int main() //particle kernel benchmark - 1M particles integrated by every kernel the cpu supports
+{
+	using namespace gg;
+
+	const unsigned int particleCount = 1000000;
+	const unsigned int repeats = 100;
+
+	/* TESTING STUFF */
+	std::vector<float> positionsX(particleCount), positionsY(particleCount), positionsZ(particleCount);
+	std::vector<float> velocitiesX(particleCount), velocitiesY(particleCount), velocitiesZ(particleCount);
+	std::vector<float> ages(particleCount), lifetimes(particleCount), gravities(particleCount, 10.0f);
+	std::vector<unsigned int> textureAtlasIndices(particleCount);
+	std::vector<float> distancesFromCamera(particleCount);
+	std::vector<unsigned int> deadIndices;
+	deadIndices.reserve(particleCount);
+
+	ParticleKernelData data = {
+		positionsX.data(), positionsY.data(), positionsZ.data(),
+		velocitiesX.data(), velocitiesY.data(), velocitiesZ.data(),
+		ages.data(), lifetimes.data(), gravities.data(),
+		textureAtlasIndices.data(), distancesFromCamera.data(),
+		particleCount
+	};
+
+	ParticleKernelParameters parameters = { 0.016f, vector3(0.0f, 10.0f, 0.0f), 0, 16 };
+
+	const ParticleKernel kernels[3] = { PARTICLE_KERNEL_SCALAR, PARTICLE_KERNEL_SSE2, PARTICLE_KERNEL_AVX2 };
+	const char* kernelNames[3] = { "scalar", "sse2", "avx2" };
+
+	for (unsigned int k = 0; k < 3; k++)
+	{
+		setParticleKernel(kernels[k]);
+		if (getParticleKernel() != kernels[k])
+		{
+			std::cout << "[Info] " << kernelNames[k] << " isn't supported by this cpu" << std::endl;
+			continue;
+		}
+
+		// Resetting Particles (same input for every kernel)
+		for (unsigned int i = 0; i < particleCount; i++)
+		{
+			positionsX[i] = positionsY[i] = positionsZ[i] = 0.0f;
+			velocitiesX[i] = (float)(i % 97) / 97.0f;
+			velocitiesY[i] = (float)(i % 89) / 89.0f * 5.0f;
+			velocitiesZ[i] = (float)(i % 83) / 83.0f;
+			ages[i] = 0.0f;
+			lifetimes[i] = 0.5f + (float)(i % 100) / 50.0f;
+		}
+
+		// Integrating
+		Timer timer;
+		unsigned int deadCount = 0;
+
+		for (unsigned int i = 0; i < repeats; i++)
+		{
+			deadIndices.clear();
+			integrateParticles(data, parameters, deadIndices);
+			deadCount += deadIndices.size();
+		}
+
+		float milliseconds = timer.elapsed() * 1000.0f;
+		std::cout << "[Info] " << kernelNames[k] << ": " << (float)particleCount * repeats / milliseconds << " particles per ms, dead: " << deadCount << ", checksum: " << positionsY[particleCount / 2] << std::endl;
+	}
+
+	setParticleKernel(PARTICLE_KERNEL_AUTOMATIC);
+
+
+	return 0;
+}
+#endif
+
+#if 0
+int main() //particle sorting benchmark - 10k particles kept in back to front draw order while camera flies past them
+{
+	using namespace gg;
+
+	const unsigned int particleCount = 10000;
+	const unsigned int frames = 600;
+
+	/* Window Setup (textures need opengl context) */
+	Window window("Gumi Gota Engine v0.0.1 - Tester", 640, 480);
+
+	/* TESTING STUFF */
+	Texture particleTexture("Gumi Gota/Engine Tester/res/textures/particle1.png");
+	Camera3D cam(vector3(50.0f, 50.0f, -20.0f), window.getAspectRatio());
+
+	ParticleGroup pg(&particleTexture);
+	pg.reserve(particleCount);
+
+	// Filling Group
+	for (unsigned int i = 0; i < particleCount; i++)
+	{
+		vector3 position((float)(i % 101), (float)(i % 103), (float)(i % 107));
+		vector3 velocity((float)(i % 7) / 7.0f - 0.5f, (float)(i % 11) / 11.0f - 0.5f, (float)(i % 13) / 13.0f - 0.5f);
+
+		pg.add(Particle(position, velocity, 1000.0f, 0.0f, 0.0f, 1.0f));
+	}
+
+	// Updating
+	Timer timer;
+	unsigned int wrongOrderCount = 0;
+
+	for (unsigned int f = 0; f < frames; f++)
+	{
+		cam.setPosition(vector3(50.0f + f * 0.1f, 50.0f, -20.0f));
+		pg.update(cam, 0.016f);
+
+		// Checking Order
+		for (unsigned int i = 1; i < pg.getParticleCount(); i++)
+		{
+			if ((pg.getPosition(pg.getDrawOrder()[i]) - cam.getPosition()).lengthSquared() > (pg.getPosition(pg.getDrawOrder()[i - 1]) - cam.getPosition()).lengthSquared())
+				wrongOrderCount++;
+		}
+	}
+
+	std::cout << "[Info] " << timer.elapsed() * 1000.0f / frames << " ms per frame (order checking included), wrong order: " << wrongOrderCount << std::endl;
+
+
+	return 0;
+}
+#endif
+
+#if 0
+int main() //gpu particles benchmark - 200k rain particles simulated with transform feedback and drawn straight from gpu buffers
+{
+	using namespace gg;
+
+	const unsigned int particleCount = 200000;
+
+	/* Window Setup */
+	Window window("Gumi Gota Engine v0.0.1 - Tester", 1280, 720);
+
+	/* TESTING STUFF */
+	Renderer3D rr;
+	Camera3D cam(vector3(0.0f, 5.0f, 20.0f), window.getAspectRatio());
+
+	Texture particleTexture("Gumi Gota/Engine Tester/res/textures/particle1.png");
+
+	DirectionParticleSystem rainSystem(vector3(0.5f, -20.0f, 0.0f), &particleTexture);
+	rainSystem.setPositionError(vector3(40.0f, 0.0f, 40.0f));
+	rainSystem.setDirectionError(vector3(0.2f, 2.0f, 0.2f));
+	rainSystem.setGravity(5.0f);
+	rainSystem.setLifetime(1.5f);
+	rainSystem.setScale(0.05f);
+
+	GPUParticleGroup rain(&particleTexture, particleCount, rainSystem.getGPUEmitter(vector3(0.0f, 30.0f, 0.0f)));
+	rr.addGPUParticleGroup(&rain);
+
+	Timer secondTimer;
+	Timer deltaTimeTimer;
+	unsigned int frames = 0;
+
+	/* APPLICATION LOOP */
+	while (!window.closed())
+	{
+		window.clear();
+
+		float deltaTime = deltaTimeTimer.elapsed();
+		deltaTimeTimer.reset();
+
+		rr.update(cam, deltaTime);
+		rr.render(cam);
+
+		window.update();
+		frames++;
+
+		if (secondTimer.elapsed() >= 1.0f)
+		{
+			std::cout << "[Info] " << secondTimer.elapsed() * 1000.0f / frames << " ms per frame with " << particleCount << " gpu particles" << std::endl;
+
+			frames = 0;
+			secondTimer.reset();
+		}
+	}
+
+
+	return 0;
+}
+#endif
+
+#if 0
+int main() //parallel scene update benchmark - 200 groups of 5k particles updated on 1, 2, 4 and 8 threads
+{
+	using namespace gg;
+
+	const unsigned int groupCount = 200;
+	const unsigned int particlesPerGroup = 5000;
+	const unsigned int frames = 100;
+	const unsigned int threadCounts[4] = { 1, 2, 4, 8 };
+
+	/* Window Setup (textures need opengl context) */
+	Window window("Gumi Gota Engine v0.0.1 - Tester", 640, 480);
+
+	/* TESTING STUFF */
+	Texture particleTexture("Gumi Gota/Engine Tester/res/textures/particle1.png");
+	Camera3D cam(vector3(50.0f, 50.0f, -20.0f), window.getAspectRatio());
+
+	for (unsigned int t = 0; t < 4; t++)
+	{
+		// Scene Setup (same particles for every thread count)
+		Scene3D scene;
+		scene.setThreadCount(threadCounts[t]);
+		scene.reserveParticleGroups(groupCount);
+
+		for (unsigned int g = 0; g < groupCount; g++)
+		{
+			ParticleGroup pg(&particleTexture);
+			pg.reserve(particlesPerGroup);
+
+			for (unsigned int i = 0; i < particlesPerGroup; i++)
+			{
+				vector3 position((float)((i + g) % 101), (float)(i % 103), (float)((i * g) % 107));
+				vector3 velocity((float)(i % 7) / 7.0f - 0.5f, (float)(i % 11) / 11.0f - 0.5f, (float)(i % 13) / 13.0f - 0.5f);
+
+				pg.add(Particle(position, velocity, 1000.0f, 0.0f, 0.0f, 1.0f));
+			}
+
+			scene.addParticleGroup(std::move(pg));
+		}
+
+		// Updating
+		Timer timer;
+
+		for (unsigned int f = 0; f < frames; f++)
+		{
+			cam.setPosition(vector3(50.0f + f * 0.1f, 50.0f, -20.0f));
+			scene.update(cam, 0.016f);
+		}
+
+		std::cout << "[Info] " << scene.getThreadCount() << " threads: " << timer.elapsed() * 1000.0f / frames << " ms per frame" << std::endl;
+	}
+
+
+	return 0;
+}
+#endif
+
+#if 0
+int main() //particle budget benchmark - 100 emitters bursting 5k particles each, scene limited to 50k particles
+{
+	using namespace gg;
+
+	const unsigned int emitterCount = 100;
+	const unsigned int frames = 600;
+
+	/* Window Setup (textures need opengl context) */
+	Window window("Gumi Gota Engine v0.0.1 - Tester", 640, 480);
+
+	/* TESTING STUFF */
+	Texture particleTexture("Gumi Gota/Engine Tester/res/textures/particle1.png");
+	Camera3D cam(vector3(0.0f, 0.0f, 0.0f), window.getAspectRatio());
+
+	SpreadParticleSystem ps(&particleTexture);
+	ps.setLifetime(2.0f);
+
+	Scene3D scene;
+	scene.getParticleBudget().setMaxParticles(50000);
+	scene.reserveParticleEmitters(emitterCount);
+
+	// Emitters (some far away, some behind camera, important ones in front)
+	std::vector<ParticleEmitter> emitters;
+	emitters.reserve(emitterCount);
+
+	for (unsigned int i = 0; i < emitterCount; i++)
+	{
+		vector3 position((float)(i % 10) * 10.0f - 45.0f, 0.0f, (i % 3 == 0) ? 20.0f : -(float)(i * 3));
+
+		emitters.push_back(ParticleEmitter(&ps, position, 2000.0f, 5000, 1.0f));
+		emitters.back().setCapacity(10000);
+		emitters.back().setPriority(i % 5 == 0 ? 1 : 0);
+		emitters.back().setRadius(3.0f);
+	}
+
+	for (ParticleEmitter& emitter : emitters)
+		scene.addParticleEmitter(&emitter);
+
+	// Updating
+	Timer timer;
+	float slowestFrame = 0.0f;
+	unsigned int mostParticles = 0;
+
+	for (unsigned int f = 0; f < frames; f++)
+	{
+		// Restarting Emitters (designers keep placing effects)
+		if (f % 120 == 0)
+		{
+			for (ParticleEmitter& emitter : emitters)
+				emitter.restart();
+		}
+
+		Timer frameTimer;
+		scene.update(cam, 0.016f);
+
+		float frameTime = frameTimer.elapsed() * 1000.0f;
+		slowestFrame = frameTime > slowestFrame ? frameTime : slowestFrame;
+		mostParticles = scene.getParticleCount() > mostParticles ? scene.getParticleCount() : mostParticles;
+
+		if (f % 60 == 0)
+			scene.getParticleBudget().logReport();
+	}
+
+	std::cout << "[Info] " << timer.elapsed() * 1000.0f / frames << " ms per frame, slowest: " << slowestFrame << " ms, most particles: " << mostParticles << std::endl;
+
+
+	return 0;
+}
+#endif
+
+#if 0
+int main() //matrix benchmark - simd matrix4/vector4 functions against previous scalar code; build with GUMIGOTA_MATHS_SCALAR defined and checksums have to stay the same
+{
+	using namespace gg;
+
+	const unsigned int count = 1000;
+	const unsigned int repeats = 1000;
+
+	/* TESTING STUFF */
+	std::vector<matrix4> matrices(count);
+	std::vector<vector4> vectors(count);
+
+	for (unsigned int i = 0; i < count; i++)
+	{
+		for (unsigned int e = 0; e < 4 * 4; e++)
+			matrices[i].elements[e] = (float)((i * 7 + e * 13) % 23) / 23.0f - 0.5f + (e % 5 == 0 ? 2.0f : 0.0f);
+
+		vectors[i] = vector4((float)(i % 11), (float)(i % 13), (float)(i % 17), 1.0f);
+	}
+
+	// Previous Scalar Code (argument copied, triple loop)
+	auto oldMultiply = [](matrix4 left, const matrix4 right)
+	{
+		matrix4 result;
+
+		for (int y = 0; y < 4; y++)
+		{
+			for (int x = 0; x < 4; x++)
+			{
+				float sum = 0.0f;
+
+				for (int i = 0; i < 4; i++)
+					sum += left.elements[x + i * 4] * right.elements[i + y * 4];
+
+				result.elements[x + y * 4] = sum;
+			}
+		}
+
+		return result;
+	};
+
+	auto oldTransform = [](const vector4& vector, const matrix4& matrix)
+	{
+		return vector4(
+			matrix.elements[0 + 0 * 4] * vector.x + matrix.elements[0 + 1 * 4] * vector.y + matrix.elements[0 + 2 * 4] * vector.z + matrix.elements[0 + 3 * 4] * vector.w,
+			matrix.elements[1 + 0 * 4] * vector.x + matrix.elements[1 + 1 * 4] * vector.y + matrix.elements[1 + 2 * 4] * vector.z + matrix.elements[1 + 3 * 4] * vector.w,
+			matrix.elements[2 + 0 * 4] * vector.x + matrix.elements[2 + 1 * 4] * vector.y + matrix.elements[2 + 2 * 4] * vector.z + matrix.elements[2 + 3 * 4] * vector.w,
+			matrix.elements[3 + 0 * 4] * vector.x + matrix.elements[3 + 1 * 4] * vector.y + matrix.elements[3 + 2 * 4] * vector.z + matrix.elements[3 + 3 * 4] * vector.w
+		);
+	};
+
+	// Multiplying
+	{
+		matrix4 oldResult(1.0f), newResult(1.0f);
+
+		Timer timer;
+		for (unsigned int r = 0; r < repeats; r++)
+			for (unsigned int i = 0; i < count; i++)
+				oldResult = oldMultiply(matrices[i], matrices[(i + r) % count]);
+		float oldTime = timer.elapsed();
+
+		timer.reset();
+		for (unsigned int r = 0; r < repeats; r++)
+			for (unsigned int i = 0; i < count; i++)
+				newResult = matrices[i] * matrices[(i + r) % count];
+		float newTime = timer.elapsed();
+
+		std::cout << "[Info] multiply: old " << oldTime * 1000.0f << " ms, new " << newTime * 1000.0f << " ms, checksum " << newResult.elements[5] << std::endl;
+	}
+
+	// Transforming
+	{
+		vector4 oldSum, newSum;
+
+		Timer timer;
+		for (unsigned int r = 0; r < repeats; r++)
+			for (unsigned int i = 0; i < count; i++)
+				oldSum += oldTransform(vectors[i], matrices[(i + r) % count]);
+		float oldTime = timer.elapsed();
+
+		timer.reset();
+		for (unsigned int r = 0; r < repeats; r++)
+			for (unsigned int i = 0; i < count; i++)
+				newSum += vectors[i] * matrices[(i + r) % count];
+		float newTime = timer.elapsed();
+
+		std::cout << "[Info] transform: old " << oldTime * 1000.0f << " ms, new " << newTime * 1000.0f << " ms, checksum " << newSum.x << " (old " << oldSum.x << ")" << std::endl;
+	}
+
+	// Inverting
+	{
+		float sum = 0.0f;
+
+		Timer timer;
+		for (unsigned int r = 0; r < repeats; r++)
+			for (unsigned int i = 0; i < count; i++)
+				sum += matrix4::invert(matrices[i]).elements[r % 16] + matrices[i].determinant();
+		float time = timer.elapsed();
+
+		std::cout << "[Info] invert + determinant: " << time * 1000.0f << " ms, checksum " << sum << std::endl;
+	}
+
+
+	return 0;
+}
+#endif
+
+#if 0
+int main() //batch transforms benchmark - model matrices one by one against batched soa version
+{
+	using namespace gg;
+
+	const unsigned int count = 100000;
+
+	/* TESTING STUFF */
+	std::vector<float> transforms[7]; //position x, y, z, rotation x, y, z, scale
+	for (unsigned int i = 0; i < 7; i++)
+		transforms[i].resize(count);
+
+	for (unsigned int i = 0; i < count; i++)
+	{
+		for (unsigned int j = 0; j < 7; j++)
+			transforms[j][i] = (float)((i * 31 + j * 17) % 101) / 10.0f;
+	}
+
+	std::vector<matrix4> matrices(count);
+	EulerTransformArrays arrays = { transforms[0].data(), transforms[1].data(), transforms[2].data(), transforms[3].data(), transforms[4].data(), transforms[5].data(), transforms[6].data(), nullptr, nullptr };
+
+	// One by One
+	Timer timer;
+	for (unsigned int i = 0; i < count; i++)
+		matrices[i] = matrix4::model(vector3(transforms[0][i], transforms[1][i], transforms[2][i]), transforms[3][i], transforms[4][i], transforms[5][i], transforms[6][i]);
+	float singleTime = timer.elapsed();
+	float singleChecksum = matrices[count - 1].elements[5];
+
+	// Batched
+	timer.reset();
+	modelMatrices(matrices.data(), arrays, 0, count);
+	float batchTime = timer.elapsed();
+
+	// Batched on Threads
+	ThreadPool pool;
+
+	timer.reset();
+	modelMatrices(matrices.data(), arrays, count, pool);
+	float parallelTime = timer.elapsed();
+
+	std::cout << "[Info] " << count << " model matrices: one by one " << singleTime * 1000.0f << " ms, batched " << batchTime * 1000.0f << " ms, batched on " << pool.getThreadCount() << " threads " << parallelTime * 1000.0f << " ms" << std::endl;
+	std::cout << "[Info] checksums: " << singleChecksum << " " << matrices[count - 1].elements[5] << std::endl;
+
+
+	return 0;
+}
+#endif
+
+#if 0
+int main() //fast math test - accuracy (max error against double precision libm) and speed of both tiers
+{
+	using namespace gg;
+
+	const unsigned int count = 1 << 20;
+
+	/* TESTING STUFF */
+	std::vector<float> angles(count), positives(count), exponents(count);
+	std::vector<float> sines(count), cosines(count), results(count);
+
+	for (unsigned int i = 0; i < count; i++)
+	{
+		angles[i] = -8192.0f + 16384.0f * i / count;
+		positives[i] = std::ldexp(1.0f + (float)(i % 1024) / 1024.0f, (int)((i / 1024) % 250) - 125);
+		exponents[i] = -87.0f + 175.0f * i / count;
+	}
+
+	const FastMathAccuracy tiers[2] = { FAST_MATH_LOW, FAST_MATH_HIGH };
+	const char* tierNames[2] = { "low", "high" };
+
+	for (unsigned int t = 0; t < 2; t++)
+	{
+		// Sine and Cosine
+		Timer timer;
+		fastSineCosine(angles.data(), sines.data(), cosines.data(), count, tiers[t]);
+		float time = timer.elapsed();
+
+		double maxError = 0.0;
+		for (unsigned int i = 0; i < count; i++)
+			maxError = std::max(maxError, std::max(std::abs(sines[i] - std::sin((double)angles[i])), std::abs(cosines[i] - std::cos((double)angles[i]))));
+
+		std::cout << "[Info] " << tierNames[t] << " sine and cosine: " << time * 1000.0f << " ms, max absolute error " << maxError << std::endl;
+
+		// Inverse Square Root
+		timer.reset();
+		fastInverseSquareRoot(positives.data(), results.data(), count, tiers[t]);
+		time = timer.elapsed();
+
+		maxError = 0.0;
+		for (unsigned int i = 0; i < count; i++)
+			maxError = std::max(maxError, std::abs(results[i] * std::sqrt((double)positives[i]) - 1.0));
+
+		std::cout << "[Info] " << tierNames[t] << " inverse square root: " << time * 1000.0f << " ms, max relative error " << maxError << std::endl;
+
+		// Exponential
+		timer.reset();
+		fastExponential(exponents.data(), results.data(), count, tiers[t]);
+		time = timer.elapsed();
+
+		maxError = 0.0;
+		for (unsigned int i = 0; i < count; i++)
+			maxError = std::max(maxError, std::abs(results[i] / std::exp((double)exponents[i]) - 1.0));
+
+		std::cout << "[Info] " << tierNames[t] << " exponential: " << time * 1000.0f << " ms, max relative error " << maxError << std::endl;
+	}
+
+	// Libm for Comparison
+	Timer timer;
+	for (unsigned int i = 0; i < count; i++)
+	{
+		sines[i] = (float)std::sin((double)angles[i]);
+		cosines[i] = (float)std::cos((double)angles[i]);
+	}
+	float sineTime = timer.elapsed();
+
+	timer.reset();
+	for (unsigned int i = 0; i < count; i++)
+		results[i] = 1.0f / squareRoot(positives[i]);
+	float squareRootTime = timer.elapsed();
+
+	timer.reset();
+	for (unsigned int i = 0; i < count; i++)
+		results[i] = std::exp(exponents[i]);
+	float exponentialTime = timer.elapsed();
+
+	std::cout << "[Info] libm: sine and cosine " << sineTime * 1000.0f << " ms, inverse square root " << squareRootTime * 1000.0f << " ms, exponential " << exponentialTime * 1000.0f << " ms" << std::endl;
+
+
+	return 0;
+}
+#endif
+
+#if 0
+int main() //quaternion test - euler model matrix built from matrix products vs closed form vs quaternion transform, and interpolation speed
+{
+	using namespace gg;
+
+	const unsigned int count = 100000;
+
+	/* TESTING STUFF */
+	std::vector<vector3> rotations(count);
+	std::vector<transform> transforms(count);
+	std::vector<matrix4> results(count);
+
+	for (unsigned int i = 0; i < count; i++)
+	{
+		rotations[i] = vector3(0.001f * i, 0.002f * i, 0.003f * i);
+		transforms[i] = transform(vector3((float)i, 1.0f, 2.0f), quaternion::euler(rotations[i].x, rotations[i].y, rotations[i].z), 1.5f);
+	}
+
+	// Matrix Products (old model)
+	Timer timer;
+	for (unsigned int i = 0; i < count; i++)
+	{
+		results[i] = matrix4::translation(transforms[i].position) *
+			matrix4::rotation(rotations[i].x, vector3(1.0f, 0.0f, 0.0f)) *
+			matrix4::rotation(rotations[i].y, vector3(0.0f, 1.0f, 0.0f)) *
+			matrix4::rotation(rotations[i].z, vector3(0.0f, 0.0f, 1.0f)) *
+			matrix4::scale(1.5f);
+	}
+	float productsTime = timer.elapsed();
+	matrix4 reference = results[count / 2];
+
+	// Closed Form Euler
+	timer.reset();
+	for (unsigned int i = 0; i < count; i++)
+		results[i] = matrix4::model(transforms[i].position, rotations[i].x, rotations[i].y, rotations[i].z, 1.5f);
+	float eulerTime = timer.elapsed();
+
+	// Quaternion Transform
+	timer.reset();
+	for (unsigned int i = 0; i < count; i++)
+		results[i] = transforms[i].toMatrix();
+	float quaternionTime = timer.elapsed();
+
+	float maxError = 0.0f;
+	for (unsigned int i = 0; i < 16; i++)
+		maxError = std::max(maxError, std::abs(results[count / 2].elements[i] - reference.elements[i]));
+
+	std::cout << "[Info] model matrices: products " << productsTime * 1000.0f << " ms, closed form euler " << eulerTime * 1000.0f << " ms, quaternion " << quaternionTime * 1000.0f << " ms (difference " << maxError << ")" << std::endl;
+
+	// Interpolation
+	float checksum = 0.0f;
+
+	timer.reset();
+	for (unsigned int i = 1; i < count; i++)
+		checksum += transform::interpolate(transforms[i - 1], transforms[i], 0.25f).rotation.w;
+	float slerpTime = timer.elapsed();
+
+	timer.reset();
+	for (unsigned int i = 1; i < count; i++)
+		checksum += transform::fastInterpolate(transforms[i - 1], transforms[i], 0.25f).rotation.w;
+	float nlerpTime = timer.elapsed();
+
+	std::cout << "[Info] interpolation: slerp " << slerpTime * 1000.0f << " ms, nlerp " << nlerpTime * 1000.0f << " ms (checksum " << checksum << ")" << std::endl;
+
+
+	return 0;
+}
+#endif
+
 #if 1
 int main()
 {
@@ -177,38 +1024,39 @@ int main()
 	Font font("Gumi Gota/Engine Tester/res/fonts/test font.ttf", 20);
 
 
+	Renderer3D rr; //created before models, so they're stored in its geometry pool
 
-	Model model1 = loadModelFromFile("Gumi Gota/Engine Tester/res/models/monkey.obj", "Gumi Gota/Engine Tester/res/textures/wood texture.jpg");
+	Model model1 = loadModelFromFile(rr.getGeometryPool(), "Gumi Gota/Engine Tester/res/models/monkey.obj", "Gumi Gota/Engine Tester/res/textures/wood texture.jpg");
 	Renderable3D entity1(&model1, vector3(0.0f));
 	Renderable3D entity2(&model1, vector3(1.5f, 2.0f, 0.0f));
 	Renderable3D entity3(&model1, vector3(-1.5f, 2.0f, 0.0f));
 
-	Model grassModel = loadModelFromFile("Gumi Gota/Engine Tester/res/models/grass.obj", "Gumi Gota/Engine Tester/res/textures/insane grass.png");
+	Model grassModel = loadModelFromFile(rr.getGeometryPool(), "Gumi Gota/Engine Tester/res/models/grass.obj", "Gumi Gota/Engine Tester/res/textures/insane grass.png");
 	Renderable3D grassEntity(&grassModel, vector3(-3.0f, 1.5f, 2.0f));
 	grassModel.setHasFakeLighting(true);
 	grassModel.setHasTransparency(true);
 	grassEntity.setRotation(vector3(toRadians(-90.0f), 0.0f, 0.0f));
 
-	Model metalModel = loadModelFromFile("Gumi Gota/Engine Tester/res/models/logo cube.obj", "Gumi Gota/Engine Tester/res/textures/MetalPlate/Metal_plate_006_COLOR.jpg");
+	Model metalModel = loadModelFromFile(rr.getGeometryPool(), "Gumi Gota/Engine Tester/res/models/logo cube.obj", "Gumi Gota/Engine Tester/res/textures/MetalPlate/Metal_plate_006_COLOR.jpg");
 	Renderable3D metalEntity(&metalModel, vector3(4.0, 10.0f, -1.0f));
 
-	Model taModel = loadModelFromFile("Gumi Gota/Engine Tester/res/models/logo cube.obj", "Gumi Gota/Engine Tester/res/textures/best texture atlas ever.png");
+	Model taModel = loadModelFromFile(rr.getGeometryPool(), "Gumi Gota/Engine Tester/res/models/logo cube.obj", "Gumi Gota/Engine Tester/res/textures/best texture atlas ever.png");
 	taModel.setTextureRows(2);
 	Renderable3D taEntity(&taModel, vector3(10.0, 2.0f, 4.0f));
 	taEntity.setTextureAtlasIndex(3);
 
-	Model donutModel = loadModelFromFile("Gumi Gota/Engine Tester/res/models/Wooden Donut Model.obj", "Gumi Gota/Engine Tester/res/textures/MetalPlate/Metal_plate_006_COLOR.jpg");
+	Model donutModel = loadModelFromFile(rr.getGeometryPool(), "Gumi Gota/Engine Tester/res/models/Wooden Donut Model.obj", "Gumi Gota/Engine Tester/res/textures/MetalPlate/Metal_plate_006_COLOR.jpg");
 	Renderable3D donutEntity(&donutModel, vector3(-5.0, 3.0f, 16.0f));
 
-	Model groundModel = loadModelFromFile("Gumi Gota/Engine Tester/res/models/logo cube.obj", "Gumi Gota/Engine Tester/res/textures/MetalPlate/Metal_plate_006_COLOR.jpg");
+	Model groundModel = loadModelFromFile(rr.getGeometryPool(), "Gumi Gota/Engine Tester/res/models/logo cube.obj", "Gumi Gota/Engine Tester/res/textures/MetalPlate/Metal_plate_006_COLOR.jpg");
 	Renderable3D groundEntity(&groundModel, vector3(0.0, -34.0f, 0.0f));
 	groundEntity.setScale(32.0f);
 
-	Model simpleLampModel = loadModelFromFile("Gumi Gota/Engine Tester/res/models/simple light model.obj", "Gumi Gota/Engine Tester/res/textures/simple lamp texture.png");
+	Model simpleLampModel = loadModelFromFile(rr.getGeometryPool(), "Gumi Gota/Engine Tester/res/models/simple light model.obj", "Gumi Gota/Engine Tester/res/textures/simple lamp texture.png");
 	Renderable3D simpleLampEntity(&simpleLampModel, vector3(8.0, 4.0f, 8.0f));
 	Light3D simpleLampLight(simpleLampEntity.getPosition(), COLOR_GREEN, vector3(1.0f, 0.01f, 0.005f));
 
-	Model bigDonutModel = loadModelFromFile("Gumi Gota/Engine Tester/res/models/Wooden Donut Model.obj", "Gumi Gota/Engine Tester/res/textures/MetalPlate/Metal_plate_006_COLOR.jpg");
+	Model bigDonutModel = loadModelFromFile(rr.getGeometryPool(), "Gumi Gota/Engine Tester/res/models/Wooden Donut Model.obj", "Gumi Gota/Engine Tester/res/textures/MetalPlate/Metal_plate_006_COLOR.jpg");
 	Renderable3D bigDonutEntity(&bigDonutModel, vector3(-4.0, -5.0f, 4.0f));
 	bigDonutEntity.setScale(36.0f);
 
@@ -264,7 +1112,6 @@ int main()
 	float waterSpeed = 0.0002f;
 
 
-	Renderer3D rr;
 	rr.setSkyColor(Color(0.098f, 0.149f, 0.271f), window);
 
 	rr.addRenderable(&entity1);
@@ -285,6 +1132,9 @@ int main()
 
 	rr.reserveParticleGroups(300);
 
+	ParticleEmitter metalEmitter(&ps3, metalEntity.getPosition(), 60.0f);
+	rr.addParticleEmitter(&metalEmitter);
+
 
 	PhysicsScene3D physicsScene;
 	physicsScene.addCamera(&cam);
@@ -292,7 +1142,7 @@ int main()
 
 	Layer2D textLayer(window);
 	Font testFont("Gumi Gota/Engine Tester/res/fonts/test font.ttf", 128.0f);
-	Label2D testText("text", vector2(400.0f, 400.0f), vector2(500.0f, 500.0f), &testFont);
+	Label2D testText("text", vector2(400.0f, 400.0f), &testFont);
 	textLayer.addLabel(&testText);
 
 
@@ -406,7 +1256,7 @@ int main()
 		
 
 		
-		rr.addParticleGroup(ps3.generateParticles(metalEntity.getPosition(), 1));
+		metalEmitter.setPosition(metalEntity.getPosition());
 		
 		
 
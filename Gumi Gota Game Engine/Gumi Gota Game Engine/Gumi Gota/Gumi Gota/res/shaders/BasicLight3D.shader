@@ -3,80 +3,136 @@
 
 /*
 *	MAX_RENDERED_LIGHTS = 16
+*
+*	Variant defines (injected by ShaderVariants):
+*	LIGHT_COUNT	  - amount of lights looped over (0, 4, 8 or 16)
+*	FAKE_LIGHTING - all normals point up
+*	FOG			  - distance fog mixed with sky color
+*	CLIPPING	  - writes gl_ClipDistance[0] (water passes)
+*	INSTANCING	  - model matrix and material come from per instance attributes (geometry pool)
 */
 
+#ifndef LIGHT_COUNT
+#define LIGHT_COUNT 16
+#endif
+
 
 /* In Variables */
 layout(location = 0) in vec3 in_vertex;
 layout(location = 1) in vec2 in_textureCoordinates;
 layout(location = 2) in vec3 in_normal;
 
+#ifdef INSTANCING
+layout(location = 3) in mat4 in_modelMatrix; //per instance; takes locations 3 - 6
+layout(location = 7) in vec4 in_textureData; //per instance; texture offset (xy), texture rows (z), fake lighting (w)
+layout(location = 8) in vec2 in_materialData; //per instance; shine damper (x), reflectivity (y)
+#endif
+
 
 /* Out Variables */
 out vec2 pass_textureCoordinates;
 
-out vec3 pass_toLightVector[16];
+#if LIGHT_COUNT > 0
+out vec3 pass_toLightVector[LIGHT_COUNT];
+#endif
 out vec3 pass_surfaceNormal;
 out vec3 pass_toCameraVector;
 
+#ifdef FOG
 out float pass_visibility;
+#endif
+
+#ifdef INSTANCING
+flat out vec2 pass_materialData;
+#endif
 
 
 /* Uniforms */
 uniform mat4 u_projectionMatrix;
 uniform mat4 u_viewMatrix;
+#ifndef INSTANCING
 uniform mat4 u_modelMatrix;
+#endif
 
-uniform vec3 u_lightPosition[16];
+uniform vec3 u_cameraPosition;
 
-uniform float u_hasFakeLighting;
+#if LIGHT_COUNT > 0
+uniform vec3 u_lightPosition[LIGHT_COUNT];
+#endif
 
+#ifdef FOG
 uniform float u_fogDensity;
 uniform float u_fogGradient;
+#endif
 
+#ifndef INSTANCING
 uniform float u_textureRows;
 uniform vec2 u_textureCoordinatesOffset;
+#endif
 
+#ifdef CLIPPING
 uniform vec4 u_clippingPlane;
+#endif
 
 
 /* Main Loop */
 void main()
 {
 	/* CALCULATIONS */
+#ifdef INSTANCING
+	mat4 modelMatrix = in_modelMatrix;
+#else
+	mat4 modelMatrix = u_modelMatrix;
+#endif
+
 	// Calculating World Position
-	vec4 worldPosition = u_modelMatrix * vec4(in_vertex, 1.0);
+	vec4 worldPosition = modelMatrix * vec4(in_vertex, 1.0);
 
 	// Calculating Position Relative to Camera
 	vec4 positionRelativeToCamera = u_viewMatrix * worldPosition;
 
 	// Transformating Normal
+#if defined(INSTANCING)
+	vec3 actualNormal = in_textureData.w > 0.5 ? vec3(0.0, 1.0, 0.0) : in_normal; //fake lighting is per instance here, so all pooled models can share one variant
+#elif defined(FAKE_LIGHTING)
+	vec3 actualNormal = vec3(0.0, 1.0, 0.0);
+#else
 	vec3 actualNormal = in_normal;
-	if (u_hasFakeLighting > 0.5)
-	{
-		actualNormal = vec3(0.0, 1.0, 0.0);
-	}
+#endif
 
 	// Light Calculations
-	pass_surfaceNormal = (u_modelMatrix * vec4(actualNormal, 0.0)).xyz;
+	pass_surfaceNormal = (modelMatrix * vec4(actualNormal, 0.0)).xyz;
 
-	for (int i = 0; i < 16; i++)
+#if LIGHT_COUNT > 0
+	for (int i = 0; i < LIGHT_COUNT; i++)
 	{
 		pass_toLightVector[i] = u_lightPosition[i] - worldPosition.xyz;
 	}
+#endif
 
-	pass_toCameraVector = (inverse(u_viewMatrix) * vec4(0.0, 0.0, 0.0, 1.0)).xyz - worldPosition.xyz;
+	pass_toCameraVector = u_cameraPosition - worldPosition.xyz;
 
 	// Clipping Calculations
+#ifdef CLIPPING
 	gl_ClipDistance[0] = dot(worldPosition, u_clippingPlane);
+#endif
 
 	// Fog Calculations
+#ifdef FOG
 	float distance = length(positionRelativeToCamera.xyz);
 	pass_visibility = exp(-pow((distance * u_fogDensity), u_fogGradient));
 	pass_visibility = clamp(pass_visibility, 0.0, 1.0);
+#endif
 	
 	// Texture Coordinates Calculations
+#ifdef INSTANCING
+	pass_textureCoordinates = (in_textureCoordinates / in_textureData.z) + in_textureData.xy;
+
+	// Material Data
+	pass_materialData = in_materialData;
+#else
 	pass_textureCoordinates = (in_textureCoordinates / u_textureRows) + u_textureCoordinatesOffset;
+#endif
 
 	/* POSITION SETTING */
 	gl_Position = u_projectionMatrix * positionRelativeToCamera;
@@ -90,15 +146,27 @@ void main()
 #shader fragment
 #version 330 core
 
+#ifndef LIGHT_COUNT
+#define LIGHT_COUNT 16
+#endif
+
 
 /* In Variables */
 in vec2 pass_textureCoordinates;
 
-in vec3 pass_toLightVector[16];
+#if LIGHT_COUNT > 0
+in vec3 pass_toLightVector[LIGHT_COUNT];
+#endif
 in vec3 pass_surfaceNormal;
 in vec3 pass_toCameraVector;
 
+#ifdef FOG
 in float pass_visibility;
+#endif
+
+#ifdef INSTANCING
+flat in vec2 pass_materialData;
+#endif
 
 
 /* Out Variables */
@@ -108,18 +176,32 @@ out vec4 out_color;
 /* Uniforms */
 uniform sampler2D u_textureSampler;
 
-uniform vec3 u_lightColor[16];
-uniform vec3 u_lightAttenuation[16];
+#if LIGHT_COUNT > 0
+uniform vec3 u_lightColor[LIGHT_COUNT];
+uniform vec3 u_lightAttenuation[LIGHT_COUNT];
+#endif
+#ifndef INSTANCING
 uniform float u_shineDamper;
 uniform float u_reflectivity;
+#endif
 
+#ifdef FOG
 uniform vec3 u_skyColor;
+#endif
 
 
 /* Main Loop */
 void main()
 {
 	/* CALCULATIONS */
+#ifdef INSTANCING
+	float shineDamper = pass_materialData.x;
+	float reflectivity = pass_materialData.y;
+#else
+	float shineDamper = u_shineDamper;
+	float reflectivity = u_reflectivity;
+#endif
+
 	// Light Calculations
 	vec3 unitNormal = normalize(pass_surfaceNormal);
 	vec3 unitVectorToCamera = normalize(pass_toCameraVector);
@@ -127,14 +209,9 @@ void main()
 	vec3 totalDiffuse = vec3(0.0);
 	vec3 totalSpecular = vec3(0.0);
 
-	for (int i = 0; i < 16; i++)
+#if LIGHT_COUNT > 0
+	for (int i = 0; i < LIGHT_COUNT; i++) //unused slots have black color and attenuation (1, 0, 0), so they add nothing
 	{
-		if (u_lightAttenuation[i] == vec3(0.0) && u_lightColor[i] == vec3(0.0))
-		{
-			break;
-		}
-
-
 		float lightDistance = length(pass_toLightVector[i]);
 		float attenuationFactor = u_lightAttenuation[i].x + (u_lightAttenuation[i].y * lightDistance) + (u_lightAttenuation[i].z * lightDistance * lightDistance);
 
@@ -148,10 +225,11 @@ void main()
 
 		float specularFactor = dot(reflectedLightDirection, unitVectorToCamera);
 		specularFactor = max(specularFactor, 0.0);
-		float dampedFactor = pow(specularFactor, u_shineDamper);
+		float dampedFactor = pow(specularFactor, shineDamper);
 		totalDiffuse = totalDiffuse + (brightness * u_lightColor[i]) / attenuationFactor;
-		totalSpecular = totalSpecular + (dampedFactor * u_reflectivity * u_lightColor[i]) / attenuationFactor;
+		totalSpecular = totalSpecular + (dampedFactor * reflectivity * u_lightColor[i]) / attenuationFactor;
 	}
+#endif
 
 	totalDiffuse = max(totalDiffuse, 0.2);
 
@@ -164,6 +242,8 @@ void main()
 
 	/* COLOR SETTING */
 	out_color = vec4(totalDiffuse, 1.0) * textureColor + vec4(totalSpecular, 1.0);
+#ifdef FOG
 	out_color = mix(vec4(u_skyColor, 1.0), out_color, pass_visibility);
+#endif
 
 }
\ No newline at end of file
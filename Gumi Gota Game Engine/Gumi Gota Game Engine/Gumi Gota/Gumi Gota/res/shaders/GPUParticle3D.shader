@@ -0,0 +1,92 @@
+#shader vertex
+#version 330 core
+
+
+/* In Variables (one instance per particle) */
+layout(location = 0) in vec3 in_position;
+layout(location = 1) in vec4 in_data; //age, lifetime, gravity, rotation
+layout(location = 2) in float in_scale;
+
+
+/* Out Variables */
+out vec2 pass_textureCoordinates;
+
+
+/* Uniforms */
+uniform mat4 u_projectionMatrix;
+uniform mat4 u_viewMatrix;
+
+uniform float u_textureAtlasRows;
+uniform float u_startingTextureAtlasIndex;
+uniform float u_texturePhaseCount;
+
+uniform vec4 u_clippingPlane;
+
+
+/* Main Loop */
+void main()
+{
+	/* INIT */
+	vec2 corner = vec2(float(gl_VertexID / 2) - 0.5, 0.5 - float(gl_VertexID % 2)); //same triangle strip as cpu particles' vbo
+
+	float age = in_data.x;
+	float lifetime = in_data.y;
+
+	// Hiding Dead and Waiting Particles
+	if (age < 0.0 || age >= lifetime)
+	{
+		pass_textureCoordinates = vec2(0.0);
+		gl_ClipDistance[0] = 0.0;
+		gl_Position = vec4(2.0, 2.0, 2.0, 1.0); //every vertex in the same place outside of screen, so nothing gets rasterized
+
+		return;
+	}
+
+	/* CALCULATIONS */
+	// Position Calculations (quad faces camera, rotated around view direction)
+	float s = sin(in_data.w);
+	float c = cos(in_data.w);
+
+	vec4 viewPosition = u_viewMatrix * vec4(in_position, 1.0);
+	viewPosition.xy += vec2(corner.x * c - corner.y * s, corner.x * s + corner.y * c) * in_scale;
+
+	// Texture Coordinates Calculations
+	float phase = u_startingTextureAtlasIndex + min(floor(age / lifetime * u_texturePhaseCount), u_texturePhaseCount - 1.0);
+	vec2 textureOffset = vec2(mod(phase, u_textureAtlasRows), floor(phase / u_textureAtlasRows)) / u_textureAtlasRows;
+
+	pass_textureCoordinates = (corner + vec2(0.5, 0.5)) / u_textureAtlasRows + textureOffset;
+
+	// Clipping Calculations (whole particle is on one side of water, like its center)
+	gl_ClipDistance[0] = dot(vec4(in_position, 1.0), u_clippingPlane);
+
+	/* POSITION SETTING */
+	gl_Position = u_projectionMatrix * viewPosition;
+}
+
+
+
+
+
+
+#shader fragment
+#version 330 core
+
+
+/* In Variables */
+in vec2 pass_textureCoordinates;
+
+
+/* Out Variables */
+out vec4 out_color;
+
+
+/* Uniforms */
+uniform sampler2D u_textureSampler;
+
+
+/* Main Loop */
+void main()
+{
+	// Color Setting
+	out_color = texture(u_textureSampler, pass_textureCoordinates);
+}
\ No newline at end of file
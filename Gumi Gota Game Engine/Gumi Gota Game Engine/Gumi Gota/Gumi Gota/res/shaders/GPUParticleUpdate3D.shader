@@ -0,0 +1,104 @@
+#shader vertex
+#version 330 core
+
+
+/* In Variables */
+layout(location = 0) in vec3 in_position;
+layout(location = 1) in vec3 in_velocity;
+layout(location = 2) in vec4 in_data; //age, lifetime, gravity, rotation
+layout(location = 3) in float in_scale;
+
+
+/* Out Variables (captured by transform feedback, same layout as in variables) */
+out vec3 out_position;
+out vec3 out_velocity;
+out vec4 out_data;
+out float out_scale;
+
+
+/* Uniforms */
+uniform float u_deltaTime;
+uniform int u_randomSeed;
+uniform int u_looping;
+
+uniform int u_emitterType; //0 - direction, 1 - spread
+uniform vec3 u_emitterPosition;
+uniform vec3 u_positionError;
+uniform vec3 u_direction;
+uniform vec3 u_directionError;
+uniform float u_speed;
+uniform float u_speedError;
+uniform float u_lifetime;
+uniform float u_lifetimeError;
+uniform float u_gravity;
+uniform float u_gravityError;
+uniform float u_rotation;
+uniform float u_rotationError;
+uniform float u_scale;
+uniform float u_scaleError;
+
+
+/* Functions */
+uint hash(uint value) //pcg hash
+{
+	uint state = value * 747796405u + 2891336453u;
+	uint word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+
+	return (word >> 22u) ^ word;
+}
+
+float randomError(inout uint state, float error) //random value from -error to error
+{
+	state = hash(state);
+
+	return (float(state) / 4294967295.0 * 2.0 - 1.0) * error;
+}
+
+
+/* Main Loop */
+void main()
+{
+	/* INIT */
+	vec3 position = in_position;
+	vec3 velocity = in_velocity;
+	float age = in_data.x + u_deltaTime;
+	float lifetime = in_data.y;
+	float gravity = in_data.z;
+	float rotation = in_data.w;
+	float scale = in_scale;
+
+	/* CALCULATIONS */
+	if (age >= lifetime && age >= 0.0 && (u_looping != 0 || lifetime == 0.0)) // Respawning (lifetime is 0 only before first spawn)
+	{
+		uint state = hash(uint(gl_VertexID) ^ hash(uint(u_randomSeed)));
+
+		position = u_emitterPosition + vec3(randomError(state, u_positionError.x), randomError(state, u_positionError.y), randomError(state, u_positionError.z));
+
+		if (u_emitterType == 0) // Direction Emitter
+		{
+			velocity = u_direction + vec3(randomError(state, u_directionError.x), randomError(state, u_directionError.y), randomError(state, u_directionError.z));
+		}
+		else // Spread Emitter
+		{
+			float speed = u_speed + randomError(state, u_speedError);
+			velocity = vec3(randomError(state, 1.0), randomError(state, 1.0), randomError(state, 1.0)) * speed;
+		}
+
+		age = 0.0;
+		lifetime = max(u_lifetime + randomError(state, u_lifetimeError), 0.001);
+		gravity = u_gravity + randomError(state, u_gravityError);
+		rotation = u_rotation + randomError(state, u_rotationError);
+		scale = u_scale + randomError(state, u_scaleError);
+	}
+	else if (age >= 0.0 && age < lifetime) // Moving (same integration as cpu particles)
+	{
+		velocity.y -= gravity * u_deltaTime;
+		position += velocity * u_deltaTime;
+	}
+
+	/* OUTPUT SETTING */
+	out_position = position;
+	out_velocity = velocity;
+	out_data = vec4(age, lifetime, gravity, rotation);
+	out_scale = scale;
+}
\ No newline at end of file
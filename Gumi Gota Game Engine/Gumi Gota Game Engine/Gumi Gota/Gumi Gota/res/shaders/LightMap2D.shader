@@ -0,0 +1,65 @@
+#shader vertex
+#version 330 core
+
+/* In Variables */
+layout(location = 0) in vec2 in_position; //corner of area lit by light in world space
+layout(location = 1) in vec2 in_lightPosition;
+layout(location = 2) in vec3 in_lightColor;
+layout(location = 3) in vec3 in_lightAttenuation;
+
+
+/* Out Variables */
+out vec2 pass_position;
+flat out vec2 pass_lightPosition;
+flat out vec3 pass_lightColor;
+flat out vec3 pass_lightAttenuation;
+
+
+/* Uniforms */
+uniform mat4 u_projectionMatrix;
+uniform mat4 u_viewMatrix;
+
+
+/* Main Loop */
+void main()
+{
+	// Passing
+	pass_position = in_position;
+	pass_lightPosition = in_lightPosition;
+	pass_lightColor = in_lightColor;
+	pass_lightAttenuation = in_lightAttenuation;
+
+	// Position Setting
+	gl_Position = u_projectionMatrix * u_viewMatrix * vec4(in_position, 0.0, 1.0);
+}
+
+
+
+
+
+
+#shader fragment
+#version 330 core
+
+
+/* In Variables */
+in vec2 pass_position;
+flat in vec2 pass_lightPosition;
+flat in vec3 pass_lightColor;
+flat in vec3 pass_lightAttenuation;
+
+
+/* Out Variables */
+out vec4 out_color;
+
+
+/* Main Loop */
+void main()
+{
+	// Light Calculating (added to light map with additive blending)
+	float lightDistance = length(pass_position - pass_lightPosition);
+	float attenuationFactor = (pass_lightAttenuation.x) + (pass_lightAttenuation.y * lightDistance) + (pass_lightAttenuation.z * lightDistance * lightDistance);
+
+	// Color Setting
+	out_color = vec4(pass_lightColor / attenuationFactor, 1.0);
+}
\ No newline at end of file
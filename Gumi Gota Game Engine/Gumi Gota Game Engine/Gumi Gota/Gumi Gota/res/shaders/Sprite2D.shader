@@ -0,0 +1,132 @@
+#shader vertex
+#version 330 core
+
+/*
+*	MAX_TEXTURES = 16
+*
+*	Texture slot ranges:
+*	-1      - no texture, vertex color only
+*	0 - 15  - texture only
+*	16 - 31 - glyph; texture alpha is coverage of vertex color
+*	32 - 47 - sdf glyph; texture alpha is distance to edge (0.5 on edge)
+*
+*	Variant defines (injected by ShaderVariants):
+*	LIGHTING - sprites are multiplied by light map (accumulated by LightMap2D in screen space)
+*/
+
+/* In Variables */
+layout(location = 0) in vec2 in_position; //already transformed to world space on cpu
+layout(location = 1) in vec2 in_textureCoordinates;
+layout(location = 2) in vec4 in_color;
+layout(location = 3) in float in_textureSlot; //-1 for sprites without texture; see slot ranges above
+
+
+/* Out Variables */
+out vec2 pass_textureCoordinates;
+out vec4 pass_color;
+flat out int pass_textureSlot;
+
+
+/* Uniforms */
+uniform mat4 u_projectionMatrix;
+uniform mat4 u_viewMatrix;
+
+
+/* Main Loop */
+void main()
+{
+	// Passing
+	pass_textureCoordinates = in_textureCoordinates;
+	pass_color = in_color;
+	pass_textureSlot = int(floor(in_textureSlot + 0.5));
+
+	// Position Setting
+	gl_Position = u_projectionMatrix * u_viewMatrix * vec4(in_position, 0.0, 1.0);
+}
+
+
+
+
+
+
+#shader fragment
+#version 330 core
+
+
+/* In Variables */
+in vec2 pass_textureCoordinates;
+in vec4 pass_color;
+flat in int pass_textureSlot;
+
+
+/* Out Variables */
+out vec4 out_color;
+
+
+/* Uniforms */
+uniform sampler2D u_textures[16];
+
+#ifdef LIGHTING
+uniform sampler2D u_lightMap;
+uniform vec2 u_screenSize;
+#endif
+
+
+/* Functions */
+vec4 sampleTexture(int slot, vec2 coordinates) //glsl 3.30 doesn't allow indexing sampler arrays with non constant values
+{
+	switch (slot)
+	{
+	case 0:  return texture(u_textures[0], coordinates);
+	case 1:  return texture(u_textures[1], coordinates);
+	case 2:  return texture(u_textures[2], coordinates);
+	case 3:  return texture(u_textures[3], coordinates);
+	case 4:  return texture(u_textures[4], coordinates);
+	case 5:  return texture(u_textures[5], coordinates);
+	case 6:  return texture(u_textures[6], coordinates);
+	case 7:  return texture(u_textures[7], coordinates);
+	case 8:  return texture(u_textures[8], coordinates);
+	case 9:  return texture(u_textures[9], coordinates);
+	case 10: return texture(u_textures[10], coordinates);
+	case 11: return texture(u_textures[11], coordinates);
+	case 12: return texture(u_textures[12], coordinates);
+	case 13: return texture(u_textures[13], coordinates);
+	case 14: return texture(u_textures[14], coordinates);
+	case 15: return texture(u_textures[15], coordinates);
+	}
+
+	return vec4(1.0);
+}
+
+
+/* Main Loop */
+void main()
+{
+	// Base Color Calculating (textured sprites use only texture, like before batching)
+	vec4 color = pass_color;
+	if (pass_textureSlot >= 32)
+	{
+		float distance = sampleTexture(pass_textureSlot - 32, pass_textureCoordinates).a;
+		float smoothing = fwidth(distance) * 0.5;
+
+		color.a *= smoothstep(0.5 - smoothing, 0.5 + smoothing, distance);
+	}
+	else if (pass_textureSlot >= 16)
+	{
+		color.a *= sampleTexture(pass_textureSlot - 16, pass_textureCoordinates).a;
+	}
+	else if (pass_textureSlot >= 0)
+	{
+		color = sampleTexture(pass_textureSlot, pass_textureCoordinates);
+	}
+
+#ifdef LIGHTING
+	// Light Sampling
+	vec3 totalLightColor = texture(u_lightMap, gl_FragCoord.xy / u_screenSize).rgb;
+
+	color = color * vec4(totalLightColor, 1.0);
+#endif
+
+	// Color Setting
+	out_color = color;
+}
\ No newline at end of file
@@ -7,26 +7,33 @@
 // Header Includes
 #include "graphics/Window.h"
 #include "graphics/Shader.h"
+#include "graphics/ShaderVariants.h"
 #include "graphics/Texture.h"
+#include "graphics/TextureAtlas.h"
 #include "graphics/OpenGLHelpFunctions.h"
 #include "graphics/Color.h"
 #include "graphics/ErrorHandling.h"
-///#include "graphics/Font.h"
+#include "graphics/GLStateCache.h"
+#include "graphics/Font.h"
 
 
 #include "graphics/buffers/VertexArray.h"
 #include "graphics/buffers/VertexBuffer.h"
 #include "graphics/buffers/IndexBuffer.h"
 #include "graphics/buffers/FrameBuffer.h"
+#include "graphics/buffers/GeometryPool.h"
 
 
 #include "graphics/2D/Camera2D.h"
 #include "graphics/2D/Renderable2D.h"
 #include "graphics/2D/Sprite2D.h"
+#include "graphics/2D/SpriteBatch2D.h"
 #include "graphics/2D/Layer2D.h"
 #include "graphics/2D/Light2D.h"
+#include "graphics/2D/LightMap2D.h"
 #include "graphics/2D/Group2D.h"
 #include "graphics/2D/Scene2D.h"
+#include "graphics/2D/SpatialHash2D.h"
 #include "graphics/2D/Label2D.h"
 
 
@@ -35,6 +42,7 @@
 #include "graphics/3D/Group3D.h"
 #include "graphics/3D/Camera3D.h"
 #include "graphics/3D/Light3D.h"
+#include "graphics/3D/LightGrid3D.h"
 #include "graphics/3D/Renderer3D.h"
 #include "graphics/3D/Scene3D.h"
 
@@ -42,9 +50,13 @@
 
 #include "graphics/3D/particles/Particle.h"
 #include "graphics/3D/particles/ParticleGroup.h"
+#include "graphics/3D/particles/ParticleKernels.h"
+#include "graphics/3D/particles/GPUParticleGroup.h"
 #include "graphics/3D/particles/ParticleSystem.h"
 #include "graphics/3D/particles/DirectionParticleSystem.h"
 #include "graphics/3D/particles/SpreadParticleSystem.h"
+#include "graphics/3D/particles/ParticleEmitter.h"
+#include "graphics/3D/particles/ParticleBudget.h"
 
 #include "graphics/3D/water/WaterTile.h"
 
@@ -7,15 +7,23 @@
 // Header Includes
 #include "maths/general/BasicOperations.h"
 #include "maths/general/Constants.h"
+#include "maths/general/FastMath.h"
 
+#include "maths/vectors/vec.h"
 #include "maths/vectors/vector2.h"
 #include "maths/vectors/vector3.h"
 #include "maths/vectors/vector4.h"
 
+#include "maths/matrices/mat.h"
 #include "maths/matrices/matrix4.h"
 
+#include "maths/quaternions/quaternion.h"
+
+#include "maths/transforms/transform.h"
+
 #include "maths/geometry/AngleTransformations.h"
 #include "maths/geometry/VectorTransformations.h"
+#include "maths/geometry/BatchTransformations.h"
 
 #include "maths/trigonometry/Trigonometry.h"
 
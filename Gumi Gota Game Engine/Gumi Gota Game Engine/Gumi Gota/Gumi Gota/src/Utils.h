@@ -6,6 +6,9 @@
 /* INCLUDES */
 #include "utils/Timer.h"
 #include "utils/Sorting.h"
+#include "utils/CPUFeatures.h"
+#include "utils/Random.h"
+#include "utils/ThreadPool.h"
 
 #include "utils/ModelLoader.h"
 
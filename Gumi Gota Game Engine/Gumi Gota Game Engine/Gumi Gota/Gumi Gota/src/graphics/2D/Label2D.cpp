@@ -8,19 +8,147 @@
 namespace gg
 {
 
+	/* ADDITIONAL FUNCTIONS */
+	static unsigned int s_decodeUTF8(const std::string& text, unsigned int& index) //returns codepoint starting at index and moves index past it
+	{
+		unsigned char first = (unsigned char)text[index++];
+
+		// Getting Sequence Length
+		unsigned int codepoint = first;
+		unsigned int continuationBytes = 0;
+
+		if ((first & 0xE0) == 0xC0)
+		{
+			codepoint = first & 0x1F;
+			continuationBytes = 1;
+		}
+		else if ((first & 0xF0) == 0xE0)
+		{
+			codepoint = first & 0x0F;
+			continuationBytes = 2;
+		}
+		else if ((first & 0xF8) == 0xF0)
+		{
+			codepoint = first & 0x07;
+			continuationBytes = 3;
+		}
+
+		// Reading Continuation Bytes
+		for (unsigned int i = 0; i < continuationBytes && index < text.size(); i++)
+		{
+			unsigned char next = (unsigned char)text[index];
+			if ((next & 0xC0) != 0x80)
+				break; //invalid sequence; stopping before byte, so it's read as next character
+
+			codepoint = (codepoint << 6) | (next & 0x3F);
+			index++;
+		}
+
+
+		return codepoint;
+	}
+
+
+
 	/* Constructors */
-	Label2D::Label2D(const std::string& text, const vector2& pos)
-		: Renderable2D(pos, vector2(1.0f, 1.0f))
-	{}
+	Label2D::Label2D(const std::string& text, const vector2& pos, Font* font)
+		: Renderable2D(pos, vector2(0.0f, 0.0f)),
+		  m_text(text), m_color(COLOR_WHITE), m_font(font)
+	{
+		m_layout();
+	}
 
-	Label2D::Label2D(const std::string& text, const vector2& pos, const Color& color)
-		: Renderable2D(pos, vector2(1.0f, 1.0f)), m_color(color)
-	{}
+	Label2D::Label2D(const std::string& text, const vector2& pos, Font* font, const Color& color)
+		: Renderable2D(pos, vector2(0.0f, 0.0f)),
+		  m_text(text), m_color(color), m_font(font)
+	{
+		m_layout();
+	}
 
 	/* Functions */
+	// Setters
+	void Label2D::setText(const std::string& text)
+	{
+		if (m_text == text)
+			return;
+
+		m_text = text;
+		m_layout();
+	}
+
 	void Label2D::setColor(const Color& color)
 	{
 		m_color = color;
 	}
 
+	void Label2D::setFont(Font* font)
+	{
+		m_font = font;
+		m_layout();
+	}
+
+	// Private Functions
+	void Label2D::m_layout()
+	{
+		m_quads.clear();
+
+		if (m_font == nullptr)
+		{
+			setSize(vector2(0.0f, 0.0f));
+			return;
+		}
+
+		// Counting Lines (box is measured from descender of last line)
+		unsigned int lines = 1;
+		for (char character : m_text)
+		{
+			if (character == '\n')
+				lines++;
+		}
+
+		float height = m_font->getLineHeight() * (lines - 1) + m_font->getAscender() - m_font->getDescender();
+
+		// Placing Glyphs
+		vector2 pen(0.0f, height - m_font->getAscender());
+		float width = 0.0f;
+		unsigned int previous = 0;
+
+		for (unsigned int i = 0; i < m_text.size();)
+		{
+			unsigned int codepoint = s_decodeUTF8(m_text, i);
+
+			// New Line
+			if (codepoint == '\n')
+			{
+				pen = vector2(0.0f, pen.y - m_font->getLineHeight());
+				previous = 0;
+				continue;
+			}
+
+			// Glyph Quad
+			if (previous != 0)
+				pen.x += m_font->getKerning(previous, codepoint);
+
+			const FontGlyph& glyph = m_font->getGlyph(codepoint);
+
+			if (glyph.region != nullptr)
+			{
+				Label2DQuad quad;
+				quad.min = pen + glyph.offset;
+				quad.max = quad.min + glyph.size;
+				quad.region = glyph.region;
+
+				m_quads.push_back(quad);
+			}
+
+			pen.x += glyph.advance;
+			width = pen.x > width ? pen.x : width;
+
+			previous = codepoint;
+		}
+
+		// Updating Bounding Box
+		setSize(vector2(width, height));
+	}
+
 }
\ No newline at end of file
@@ -6,31 +6,59 @@
 /* INCLUDES */
 // Normal Includes
 #include <string>
+#include <vector>
 
 // Header Includes
 #include "Renderable2D.h"
 
 #include "../Color.h"
+#include "../Font.h"
 
 
 
 namespace gg
 {
 
+	/* ADDITIONAL STUFF */
+	struct Label2DQuad
+	{
+		vector2 min, max; //relative to label position (bottom left corner of text)
+		const TextureAtlasRegion* region;
+	};
+
+
+
 	class Label2D : public Renderable2D
 	{
 	protected:
 		/* Variables */
-		std::string m_text;
+		std::string m_text; //utf-8
 		Color m_color;
+		Font* m_font;
+
+		std::vector<Label2DQuad> m_quads; //laid out glyphs; rebuilt only when text or font changes
 
 	public:
 		/* Constructors */
-		Label2D(const std::string& text, const vector2& pos);
-		Label2D(const std::string& text, const vector2& pos, const Color& color);
+		Label2D(const std::string& text, const vector2& pos, Font* font);
+		Label2D(const std::string& text, const vector2& pos, Font* font, const Color& color);
 
 		/* Functions */
+		// Setters
+		void setText(const std::string& text); //doesn't do anything if text is the same
 		void setColor(const Color& color);
+		void setFont(Font* font);
+
+		// Getters
+		inline const std::string& getText()  const { return m_text;  }
+		inline const Color&       getColor() const { return m_color; }
+		inline Font*              getFont()  const { return m_font;  }
+
+		inline const std::vector<Label2DQuad>& getQuads() const { return m_quads; }
+
+	private:
+		// Private Functions
+		void m_layout();
 
 	};
 
@@ -6,13 +6,9 @@
 // OpenGL Includes
 #include <GL/glew.h>
 
-// Normal Includes
-#include <sstream>
-
 // Header Includes
-#include "../buffers/VertexBuffer.h"
-
 #include "../ErrorHandling.h"
+#include "../GLStateCache.h"
 
 #include <iostream> ///remove l8r
 
@@ -21,6 +17,10 @@
 /* MACROS */
 #define RENDERER2D_DEFAULT_LIGHT_UPDATE_INTERVAL 0.1f
 #define RENDERER2D_MAX_RENDERED_LIGHTS 512
+#define RENDERER2D_DEFAULT_LIGHT_MAP_SCALE 0.5f
+#define RENDERER2D_LIGHT_MAP_SLOT SPRITE_BATCH2D_MAX_TEXTURES //first slot after sprite textures
+
+#define RENDERER2D_FEATURE_LIGHTING (1 << 0)
 
 
 
@@ -28,36 +28,34 @@ namespace gg
 {
 
 	/* ADDITIONAL STUFF */
-	static float s_vboData[] = {
-		0.0f, 0.0f,
-		1.0f, 0.0f,
-		0.0f, 1.0f,
-		1.0f, 1.0f,
-	};
+	const static std::vector<std::string> s_spriteFeatureDefines = { "LIGHTING" };
 
 
 
 	/* Constructors */
 	Layer2D::Layer2D(const Window& window)
-		: m_colorShader("Gumi Gota/Gumi Gota/res/shaders/Color2D.shader"),
-		  m_textureShader("Gumi Gota/Gumi Gota/res/shaders/Texture2D.shader"),
-		  m_colorLightShader("Gumi Gota/Gumi Gota/res/shaders/ColorLight2D.shader"),
-		  m_textureLightShader("Gumi Gota/Gumi Gota/res/shaders/TextureLight2D.shader"),
-		  m_projectionMatrix(matrix4::orthographic(0.0f, (float)window.getWidth(), 0.0f, (float)window.getHeight(), -1.0f, 1.0f)),
-		  m_vao(),
+		: m_projectionMatrix(matrix4::orthographic(0.0f, (float)window.getWidth(), 0.0f, (float)window.getHeight(), -1.0f, 1.0f)),
+		  m_screenSize((float)window.getWidth(), (float)window.getHeight()),
+		  m_spriteShaders("Gumi Gota/Gumi Gota/res/shaders/Sprite2D.shader", s_spriteFeatureDefines, ""),
+		  m_spriteBatch(),
+		  m_lightMap((unsigned int)(window.getWidth() * RENDERER2D_DEFAULT_LIGHT_MAP_SCALE), (unsigned int)(window.getHeight() * RENDERER2D_DEFAULT_LIGHT_MAP_SCALE)),
+		  m_lightGridChangeCount(0), m_areLightsChosen(false),
 		  m_lightUpdateInterval(RENDERER2D_DEFAULT_LIGHT_UPDATE_INTERVAL)
 	{
+		// Uniform Handles
+		m_projectionMatrixHandle = Shader::getUniformHandle("u_projectionMatrix");
+		m_viewMatrixHandle = Shader::getUniformHandle("u_viewMatrix");
+		m_screenSizeHandle = Shader::getUniformHandle("u_screenSize");
+
 		// Shader Setup
-		m_textureShader.start();
-		m_textureShader.setUniform1i("u_textureSampler", 0);
-		
-		m_textureLightShader.start();
-		m_textureLightShader.setUniform1i("u_textureSampler", 0);
-		m_textureLightShader.stop();
-
-		// VAO Setup
-		VertexBuffer* dataVBO = new VertexBuffer(s_vboData, 8, 2);
-		m_vao.addAttribute(dataVBO, 0);
+		std::vector<unsigned int> textureHandles = Shader::getUniformArrayHandles("u_textures", SPRITE_BATCH2D_MAX_TEXTURES);
+
+		for (unsigned int i = 0; i < SPRITE_BATCH2D_MAX_TEXTURES; i++)
+			m_spriteShaders.setUniform1i(textureHandles[i], i);
+
+		m_spriteShaders.setUniform1i(Shader::getUniformHandle("u_lightMap"), RENDERER2D_LIGHT_MAP_SLOT);
+
+		// Finishing
 		VertexArray::unbind();
 	}
 
@@ -90,68 +88,48 @@ namespace gg
 		{
 			m_lightTimer.reset(); // Resetting Timer
 
+			vector2 viewMin = cam.getPosition();
+			vector2 viewMax = cam.getPosition() + cam.getHalfOfDisplaySize() * 2.0f;
+
+			// Skipping If Neither View nor Lights Changed
+			if (m_areLightsChosen && viewMin == m_lightViewMin && viewMax == m_lightViewMax && m_lightGrid.getChangeCount() == m_lightGridChangeCount)
+				return;
+
+			m_lightViewMin = viewMin;
+			m_lightViewMax = viewMax;
+			m_lightGridChangeCount = m_lightGrid.getChangeCount();
+			m_areLightsChosen = true;
+
 			// Init
-			unsigned int loadedLights = 0;
+			m_renderedLightsIndices.clear();
+
+			// Getting Lights Lighting Up View
+			m_visibleLightsIndices.clear();
+			getVisibleLightsIndices(viewMin, viewMax, m_visibleLightsIndices);
+
+			m_visibleLights.clear();
+
+			for (unsigned int index : m_visibleLightsIndices)
+				m_visibleLights.push_back(m_lights[index]);
 
 			// Getting Closest Lights Indices
-			std::vector<unsigned int> closestLightsIndices = getClosestLightsIndices(m_lights, cam, RENDERER2D_MAX_RENDERED_LIGHTS);
+			std::vector<unsigned int> closestLightsIndices = getClosestLightsIndices(m_visibleLights, cam, RENDERER2D_MAX_RENDERED_LIGHTS);
 
 			// Important Lights
-			for (unsigned int i = 0; i < m_isImportantLight.size() && loadedLights < RENDERER2D_MAX_RENDERED_LIGHTS; i++)
+			for (unsigned int i = 0; i < m_isImportantLight.size() && m_renderedLightsIndices.size() < RENDERER2D_MAX_RENDERED_LIGHTS; i++)
 			{
 				if (m_isImportantLight[i])
-				{
-					// Getting Light Pointer
-					Light2D* light = m_lights[i];
-
-					// Preparing String
-					std::stringstream ss;
-					ss << loadedLights;
-
-					// Uniforms Setting
-					m_colorLightShader.start();
-					m_colorLightShader.setUniform2f("u_lightPosition[" + ss.str() + "]", light->getPosition());
-					m_colorLightShader.setUniform3f("u_lightColor[" + ss.str() + "]", light->getColor());
-					m_colorLightShader.setUniform3f("u_lightAttenuation[" + ss.str() + "]", light->getAttenuation());
-
-					m_textureLightShader.start();
-					m_textureLightShader.setUniform2f("u_lightPosition[" + ss.str() + "]", light->getPosition());
-					m_textureLightShader.setUniform3f("u_lightColor[" + ss.str() + "]", light->getColor());
-					m_textureLightShader.setUniform3f("u_lightAttenuation[" + ss.str() + "]", light->getAttenuation());
-
-					loadedLights++; // Updating Loaded Lights Amount
-				}
+					m_renderedLightsIndices.push_back(i);
 			}
 
 			// Closest Lights
-			for (unsigned int i = 0; i < closestLightsIndices.size() && loadedLights < RENDERER2D_MAX_RENDERED_LIGHTS; i++)
+			for (unsigned int i = 0; i < closestLightsIndices.size() && m_renderedLightsIndices.size() < RENDERER2D_MAX_RENDERED_LIGHTS; i++)
 			{
-				if (!m_isImportantLight[closestLightsIndices[i]])
-				{
-					// Getting Light Pointer
-					Light2D* light = m_lights[closestLightsIndices[i]];
-
-					// Preparing String
-					std::stringstream ss;
-					ss << loadedLights;
-
-					// Uniforms Setting
-					m_colorLightShader.start();
-					m_colorLightShader.setUniform2f("u_lightPosition[" + ss.str() + "]", light->getPosition());
-					m_colorLightShader.setUniform3f("u_lightColor[" + ss.str() + "]", light->getColor());
-					m_colorLightShader.setUniform3f("u_lightAttenuation[" + ss.str() + "]", light->getAttenuation());
-
-					m_textureLightShader.start();
-					m_textureLightShader.setUniform2f("u_lightPosition[" + ss.str() + "]", light->getPosition());
-					m_textureLightShader.setUniform3f("u_lightColor[" + ss.str() + "]", light->getColor());
-					m_textureLightShader.setUniform3f("u_lightAttenuation[" + ss.str() + "]", light->getAttenuation());
-
-					loadedLights++; // Updating Loaded Lights Amount
-				}
+				unsigned int index = m_visibleLightsIndices[closestLightsIndices[i]];
 
+				if (!m_isImportantLight[index])
+					m_renderedLightsIndices.push_back(index);
 			}
-
-			Shader::stop();
 		}
 	}
 
@@ -160,143 +138,86 @@ namespace gg
 		m_lightUpdateInterval = value;
 	}
 
+	void Layer2D::setLightMapScale(const float scale)
+	{
+		m_lightMap.setResolution((unsigned int)(m_screenSize.x * scale), (unsigned int)(m_screenSize.y * scale));
+	}
+
+	void Layer2D::setAmbientLight(const Color& color)
+	{
+		m_lightMap.setAmbientColor(color);
+	}
+
 	// Private Functions
 	void Layer2D::m_render(const vector2& camPos, const bool renderLighting)
 	{
-		// Blending Setup
-		GLcall(glEnable(GL_BLEND));
-		GLcall(glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA));
-
-		// Main Setup
 		matrix4 viewMatrix = matrix4::fpsView(vector3(camPos.x, camPos.y, -0.5f), 0.0f, 0.0f);
 
-		bool colorShaderUniformsLoaded = false;
-		bool textureShaderUniformsLoaded = false;
-		bool colorLightShaderUniformsLoaded = false;
-		bool textureLightShaderUniformsLoaded = false;
-
-		// Rendering Renderables from List
-		for (Sprite2D* sprite : m_sprites)
+		// Light Map Rendering (cost depends on screen area covered by lights, not on lights amount times pixels)
+		if (renderLighting)
 		{
-			// Binding
-			m_vao.bind();
+			// Gathering Chosen Lights (skipping ones removed since last update)
+			m_renderedLights.clear();
 
-			// Shader Setup
-			if (sprite->getTexture() == nullptr)
+			for (unsigned int index : m_renderedLightsIndices)
 			{
-				// Texture Setup
-				Texture::unbind();
-
-				// Uniforms Setup
-				if (renderLighting)
-				{
-					m_colorLightShader.start();
+				if (index < m_lights.size())
+					m_renderedLights.push_back(m_lights[index]);
+			}
 
-					// First Time Uniforms Setup
-					if (!colorLightShaderUniformsLoaded)
-					{
-						colorLightShaderUniformsLoaded = true;
+			m_lightMap.render(m_renderedLights, m_projectionMatrix, viewMatrix, camPos, camPos + m_screenSize);
+			m_lightMap.bindTexture(RENDERER2D_LIGHT_MAP_SLOT);
+		}
 
-						m_colorLightShader.setUniformMatrix4f("u_projectionMatrix", m_projectionMatrix);
-						m_colorLightShader.setUniformMatrix4f("u_viewMatrix", viewMatrix);
-					}
+		// Blending Setup
+		GLStateCache::setBlend(true);
+		GLStateCache::setBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-					// Uniforms Setup
-					matrix4 model = matrix4::translation(vector3(sprite->getOrigin(), 0.0f))
-						* matrix4::rotation(sprite->getRotation(), vector3(0.0f, 0.0f, 1.0f))
-						* matrix4::translation(vector3(sprite->getPosition() - sprite->getOrigin(), 0.0f))
-						* matrix4::scale(vector3(sprite->getSize().x, sprite->getSize().y, 1.0f));
+		// Shader Setup
+		Shader& shader = m_spriteShaders.get(renderLighting ? RENDERER2D_FEATURE_LIGHTING : 0, 0);
+		shader.start();
+		shader.setUniformMatrix4f(m_projectionMatrixHandle, m_projectionMatrix);
+		shader.setUniformMatrix4f(m_viewMatrixHandle, viewMatrix);
 
-					m_colorLightShader.setUniformMatrix4f("u_modelMatrix", model);
+		if (renderLighting)
+			shader.setUniform2f(m_screenSizeHandle, m_screenSize);
 
+		// Culling Sprites
+		m_visibleSprites.clear();
+		getVisibleSprites(camPos, camPos + m_screenSize, m_visibleSprites);
 
-					const Color& renderableColor = sprite->getColor();
-					m_colorLightShader.setUniform4f("u_color", renderableColor.r, renderableColor.g, renderableColor.b, renderableColor.a);
-				}
-				else
-				{
-					m_colorShader.start();
+		// Rendering Sprites in Batches
+		m_spriteBatch.begin(shader);
 
-					// First Time Uniforms Setup
-					if (!colorShaderUniformsLoaded)
-					{
-						colorShaderUniformsLoaded = true;
+		for (Sprite2D* sprite : m_visibleSprites)
+			m_spriteBatch.submit(*sprite);
 
-						m_colorShader.setUniformMatrix4f("u_projectionMatrix", m_projectionMatrix);
-						m_colorShader.setUniformMatrix4f("u_viewMatrix", viewMatrix);
-					}
+		m_spriteBatch.end();
 
-					// Uniforms Setup
-					matrix4 model = matrix4::translation(vector3(sprite->getOrigin(), 0.0f))
-						* matrix4::rotation(sprite->getRotation(), vector3(0.0f, 0.0f, 1.0f))
-						* matrix4::translation(vector3(sprite->getPosition() - sprite->getOrigin(), 0.0f))
-						* matrix4::scale(vector3(sprite->getSize().x, sprite->getSize().y, 1.0f));
+		// Rendering Labels (never lit, so they can be used for hud)
+		m_visibleLabels.clear();
+		getVisibleLabels(camPos, camPos + m_screenSize, m_visibleLabels);
 
-					m_colorShader.setUniformMatrix4f("u_modelMatrix", model);
+		if (m_visibleLabels.size() > 0)
+		{
+			Shader& labelShader = m_spriteShaders.get(0, 0);
+			labelShader.start();
+			labelShader.setUniformMatrix4f(m_projectionMatrixHandle, m_projectionMatrix);
+			labelShader.setUniformMatrix4f(m_viewMatrixHandle, viewMatrix);
 
+			m_spriteBatch.begin(labelShader);
 
-					const Color& renderableColor = sprite->getColor();
-					m_colorShader.setUniform4f("u_color", renderableColor.r, renderableColor.g, renderableColor.b, renderableColor.a);
-				}
-			}
-			else
-			{
-				// Texture Setup
-				sprite->getTexture()->bind();
-
-				// Uniforms Setup
-				if (renderLighting)
-				{
-					m_textureLightShader.start();
-
-					// First Time Uniforms Setup
-					if (!textureLightShaderUniformsLoaded)
-					{
-						textureLightShaderUniformsLoaded = true;
-
-						m_textureLightShader.setUniformMatrix4f("u_projectionMatrix", m_projectionMatrix);
-						m_textureLightShader.setUniformMatrix4f("u_viewMatrix", viewMatrix);
-					}
-
-					// Uniforms Setup
-					matrix4 model = matrix4::translation(vector3(sprite->getOrigin(), 0.0f))
-						* matrix4::rotation(sprite->getRotation(), vector3(0.0f, 0.0f, 1.0f))
-						* matrix4::translation(vector3(sprite->getPosition() - sprite->getOrigin(), 0.0f))
-						* matrix4::scale(vector3(sprite->getSize().x, sprite->getSize().y, 1.0f));
-
-					m_textureLightShader.setUniformMatrix4f("u_modelMatrix", model);
-				}
-				else
-				{
-					m_textureShader.start();
-
-					// First Time Uniforms Setup
-					if (!textureShaderUniformsLoaded)
-					{
-						textureShaderUniformsLoaded = true;
-
-						m_textureShader.setUniformMatrix4f("u_projectionMatrix", m_projectionMatrix);
-						m_textureShader.setUniformMatrix4f("u_viewMatrix", viewMatrix);
-					}
-
-					// Uniforms Setup
-					matrix4 model = matrix4::translation(vector3(sprite->getOrigin(), 0.0f))
-						* matrix4::rotation(sprite->getRotation(), vector3(0.0f, 0.0f, 1.0f))
-						* matrix4::translation(vector3(sprite->getPosition() - sprite->getOrigin(), 0.0f))
-						* matrix4::scale(vector3(sprite->getSize().x, sprite->getSize().y, 1.0f));
-
-					m_textureShader.setUniformMatrix4f("u_modelMatrix", model);
-				}
-			}
+			for (Label2D* label : m_visibleLabels)
+				m_spriteBatch.submit(*label);
 
-			// Rendering
-			GLcall(glDrawArrays(GL_TRIANGLE_STRIP, 0, 8));
+			m_spriteBatch.end();
 		}
 
 		// Main Finishing
-		GLcall(glDisable(GL_BLEND));
+		GLStateCache::setBlend(false);
 
 		VertexArray::unbind();
+		Texture::unbind();
 
 		Shader::stop();
 	}
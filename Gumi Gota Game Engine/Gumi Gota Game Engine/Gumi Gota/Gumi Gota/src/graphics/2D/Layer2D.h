@@ -10,11 +10,11 @@
 // Header Includes
 #include "Sprite2D.h"
 #include "Camera2D.h"
+#include "SpriteBatch2D.h"
+#include "LightMap2D.h"
 
 #include "../Shader.h"
-
-#include "../buffers/VertexArray.h"
-#include "../buffers/Indexbuffer.h"
+#include "../ShaderVariants.h"
 
 #include "../../maths/matrices/matrix4.h"
 
@@ -31,13 +31,29 @@ namespace gg
 	{
 	protected:
 		/* Variables */
-		VertexArray m_vao;
 		matrix4 m_projectionMatrix;
+		vector2 m_screenSize;
+
+		ShaderVariants m_spriteShaders; //lit and unlit variant; colored and textured sprites share a shader
+		SpriteBatch2D m_spriteBatch;
+
+		LightMap2D m_lightMap;
+		std::vector<unsigned int> m_renderedLightsIndices; //chosen in updateLights; indices instead of pointers, so lights removed before next update are just skipped
+		std::vector<Light2D*> m_renderedLights; //gathered from indices every frame
+		std::vector<unsigned int> m_visibleLightsIndices;
+		std::vector<Light2D*> m_visibleLights;
+
+		vector2 m_lightViewMin, m_lightViewMax; //view and light grid state lights were chosen for; nothing is recalculated until one of them changes
+		unsigned int m_lightGridChangeCount;
+		bool m_areLightsChosen;
+
+		std::vector<Sprite2D*> m_visibleSprites; //reused every frame
+		std::vector<Label2D*> m_visibleLabels;
 
-		Shader m_colorShader;
-		Shader m_textureShader;
-		Shader m_colorLightShader;
-		Shader m_textureLightShader;
+		// Uniform Handles
+		unsigned int m_projectionMatrixHandle;
+		unsigned int m_viewMatrixHandle;
+		unsigned int m_screenSizeHandle;
 
 		float m_lightUpdateInterval;
 
@@ -53,6 +69,8 @@ namespace gg
 
 		void updateLights(const Camera2D& cam);
 		void setLightUpdateInterval(const float value);
+		void setLightMapScale(const float scale); //resolution of light map relative to window; lower is faster, but blurrier
+		void setAmbientLight(const Color& color);
 
 	private:
 		// Private Functions
@@ -3,12 +3,18 @@
 // Self Include
 #include "Light2D.h"
 
+// Header Includes
+#include "../../maths/general/BasicOperations.h"
+
 
 
 /* MACROS */
 #define LIGHT2D_DEFAULT_ATTENUATION vector3(1.0f, 0.01f, 0.0001f)
 #define LIGHT2D_DEFAULT_COLOR COLOR_WHITE
 
+#define LIGHT2D_CUTOFF (1.0f / 256.0f) //light contribution below this value is invisible in 8 bit output
+#define LIGHT2D_INFINITE_BOUNDS 1.0e30f
+
 
 
 namespace gg
@@ -16,43 +22,121 @@ namespace gg
 
 	/* Constructors */
 	Light2D::Light2D(const vector2& pos)
-		: m_position(pos), m_color(LIGHT2D_DEFAULT_COLOR), m_attenuation(LIGHT2D_DEFAULT_ATTENUATION)
+		: m_position(pos), m_color(LIGHT2D_DEFAULT_COLOR), m_attenuation(LIGHT2D_DEFAULT_ATTENUATION),
+		  m_spatialHash(nullptr), m_spatialHashID(0)
 	{}
 
 	Light2D::Light2D(const vector2& pos, const Color& color)
-		: m_position(pos), m_color(color), m_attenuation(LIGHT2D_DEFAULT_ATTENUATION)
+		: m_position(pos), m_color(color), m_attenuation(LIGHT2D_DEFAULT_ATTENUATION),
+		  m_spatialHash(nullptr), m_spatialHashID(0)
 	{}
 
 	Light2D::Light2D(const vector2& pos, const Color& color, const vector3& attenuation)
-		: m_position(pos), m_color(color), m_attenuation(attenuation)
+		: m_position(pos), m_color(color), m_attenuation(attenuation),
+		  m_spatialHash(nullptr), m_spatialHashID(0)
 	{}
 
 	/* Functions */
 	void Light2D::move(const vector2& movement)
 	{
 		m_position += movement;
+
+		m_updateSpatialHash();
 	}
 
 	void Light2D::setPosition(const vector2& pos)
 	{
 		m_position = pos;
+
+		m_updateSpatialHash();
 	}
 
 
 	void Light2D::setColor(const Color& color)
 	{
 		m_color = color;
+
+		m_updateSpatialHash();
 	}
 
 
 	void Light2D::increaseAttenuation(const vector3& value)
 	{
 		m_attenuation += value;
+
+		m_updateSpatialHash();
 	}
 
 	void Light2D::setAttenuation(const vector3& value)
 	{
 		m_attenuation = value;
+
+		m_updateSpatialHash();
+	}
+
+
+	void Light2D::setSpatialHash(SpatialHash2D* hash, const unsigned int id)
+	{
+		m_spatialHash = hash;
+		m_spatialHashID = id;
+
+		m_updateSpatialHash();
+	}
+
+	// Getters
+	float Light2D::getRadius() const
+	{
+		float brightest = m_color.r > m_color.g ? m_color.r : m_color.g;
+		brightest = brightest > m_color.b ? brightest : m_color.b;
+
+		// Solving attenuation.z * d^2 + attenuation.y * d + attenuation.x = brightest / cutoff
+		float constant = m_attenuation.x - brightest / LIGHT2D_CUTOFF;
+
+		if (constant >= 0.0f)
+			return 0.0f; //light is below cutoff even at its center, so it lights up nothing
+
+		if (m_attenuation.z > 0.0f)
+		{
+			float delta = m_attenuation.y * m_attenuation.y - 4.0f * m_attenuation.z * constant;
+			if (delta < 0.0f)
+				return 0.0f;
+
+			return (-m_attenuation.y + squareRoot(delta)) / (2.0f * m_attenuation.z);
+		}
+		else if (m_attenuation.y > 0.0f)
+		{
+			return -constant / m_attenuation.y;
+		}
+
+		return -1.0f; //no attenuation
+	}
+
+	void Light2D::getBounds(vector2& min, vector2& max) const
+	{
+		float radius = getRadius();
+
+		if (radius < 0.0f)
+		{
+			min = vector2(-LIGHT2D_INFINITE_BOUNDS);
+			max = vector2(LIGHT2D_INFINITE_BOUNDS);
+		}
+		else
+		{
+			min = vector2(m_position.x - radius, m_position.y - radius);
+			max = vector2(m_position.x + radius, m_position.y + radius);
+		}
+	}
+
+	// Private Functions
+	void Light2D::m_updateSpatialHash()
+	{
+		if (m_spatialHash == nullptr)
+			return;
+
+		vector2 min, max;
+		getBounds(min, max);
+
+		m_spatialHash->update(m_spatialHashID, min, max);
 	}
 
 }
\ No newline at end of file
@@ -10,6 +10,8 @@
 
 #include "../Color.h"
 
+#include "SpatialHash2D.h"
+
 
 
 namespace gg
@@ -23,6 +25,9 @@ namespace gg
 		Color m_color;
 		vector3 m_attenuation;
 
+		SpatialHash2D* m_spatialHash; //grid of scene this light was added to
+		unsigned int m_spatialHashID;
+
 	public:
 		/* Constructors */
 		Light2D(const vector2& pos);
@@ -39,11 +44,20 @@ namespace gg
 		void increaseAttenuation(const vector3& value);
 		void setAttenuation(const vector3& value);
 
+		void setSpatialHash(SpatialHash2D* hash, const unsigned int id); //used by Scene2D, so grid gets updated on every change
+
 		// Getters
 		inline const vector2& getPosition()    const { return m_position;    }
 		inline const Color&   getColor()       const { return m_color;       }
 		inline const vector3& getAttenuation() const { return m_attenuation; }
 
+		float getRadius() const; //distance at which light becomes invisible; zero if light is too dim to be seen, negative if light isn't attenuated and reaches infinitely far
+		void getBounds(vector2& min, vector2& max) const; //area lit by light
+
+	private:
+		// Private Functions
+		void m_updateSpatialHash();
+
 	};
 
 }
@@ -0,0 +1,183 @@
+
+/* INCLUDES */
+// Self Include
+#include "LightMap2D.h"
+
+// OpenGL Includes
+#include <GL/glew.h>
+
+// Header Includes
+#include "../ErrorHandling.h"
+#include "../GLStateCache.h"
+
+
+
+namespace gg
+{
+
+	/* Constructors */
+	LightMap2D::LightMap2D(const unsigned int width, const unsigned int height)
+		: m_fbo(nullptr), m_width(width), m_height(height),
+		  m_shader("Gumi Gota/Gumi Gota/res/shaders/LightMap2D.shader"),
+		  m_vao(),
+		  m_ambientColor(COLOR_BLACK)
+	{
+		// Light Map Setup
+		m_createFrameBuffer();
+
+		// VBO Setup
+		m_vbo = new VertexBuffer(nullptr, LIGHT_MAP2D_MAX_LIGHTS * 6 * LIGHT_MAP2D_VERTEX_SIZE, LIGHT_MAP2D_VERTEX_SIZE, VERTEX_BUFFER_STREAM_DRAW);
+
+		m_vao.addAttribute(m_vbo, 0, 2, LIGHT_MAP2D_VERTEX_SIZE, 0);
+		m_vao.addAttribute(m_vbo, 1, 2, LIGHT_MAP2D_VERTEX_SIZE, 2);
+		m_vao.addAttribute(m_vbo, 2, 3, LIGHT_MAP2D_VERTEX_SIZE, 4);
+		m_vao.addAttribute(m_vbo, 3, 3, LIGHT_MAP2D_VERTEX_SIZE, 7);
+
+		m_vertices.reserve(LIGHT_MAP2D_MAX_LIGHTS * 6 * LIGHT_MAP2D_VERTEX_SIZE);
+
+		// Uniform Handles
+		m_projectionMatrixHandle = Shader::getUniformHandle("u_projectionMatrix");
+		m_viewMatrixHandle = Shader::getUniformHandle("u_viewMatrix");
+	}
+
+	/* Destructor */
+	LightMap2D::~LightMap2D()
+	{
+		delete m_fbo;
+	}
+
+	/* Functions */
+	void LightMap2D::render(const std::vector<Light2D*>& lights, const matrix4& projection, const matrix4& view, const vector2& viewMin, const vector2& viewMax)
+	{
+		// Saving State
+		int defaultViewport[4];
+		GLStateCache::getViewport(defaultViewport);
+
+		float defaultClearColor[4];
+		GLStateCache::getClearColor(defaultClearColor);
+
+		// Clearing to Ambient Light
+		m_fbo->bind(m_width, m_height);
+
+		GLStateCache::setClearColor(m_ambientColor.r, m_ambientColor.g, m_ambientColor.b, 1.0f);
+		GLcall(glClear(GL_COLOR_BUFFER_BIT));
+
+		// Additive Blending Setup
+		GLStateCache::setBlend(true);
+		GLStateCache::setBlendFunc(GL_ONE, GL_ONE); //light map has no depth attachment, so depth test doesn't matter
+
+		// Shader Setup
+		m_shader.start();
+		m_shader.setUniformMatrix4f(m_projectionMatrixHandle, projection);
+		m_shader.setUniformMatrix4f(m_viewMatrixHandle, view);
+
+		// Rendering Lights
+		for (const Light2D* light : lights)
+		{
+			if (m_vertices.size() == LIGHT_MAP2D_MAX_LIGHTS * 6 * LIGHT_MAP2D_VERTEX_SIZE)
+				m_flush();
+
+			m_addLight(*light, viewMin, viewMax);
+		}
+
+		m_flush();
+
+		// Restoring State
+		FrameBuffer::unbind(defaultViewport[2], defaultViewport[3]);
+		GLStateCache::setClearColor(defaultClearColor[0], defaultClearColor[1], defaultClearColor[2], defaultClearColor[3]);
+	}
+
+	void LightMap2D::bindTexture(const unsigned int slot) const
+	{
+		m_fbo->bindColorTexture(slot);
+	}
+
+	// Setters
+	void LightMap2D::setResolution(const unsigned int width, const unsigned int height)
+	{
+		if (m_width == width && m_height == height)
+			return;
+
+		m_width = width;
+		m_height = height;
+
+		m_createFrameBuffer();
+	}
+
+	void LightMap2D::setAmbientColor(const Color& color)
+	{
+		m_ambientColor = color;
+	}
+
+	// Private Functions
+	void LightMap2D::m_createFrameBuffer()
+	{
+		delete m_fbo;
+
+		m_fbo = new FrameBuffer();
+		m_fbo->attachFloatTexture(m_width, m_height);
+	}
+
+	void LightMap2D::m_addLight(const Light2D& light, const vector2& viewMin, const vector2& viewMax)
+	{
+		// Calculating Lit Area
+		const vector2& position = light.getPosition();
+		float radius = light.getRadius();
+
+		vector2 min = viewMin;
+		vector2 max = viewMax;
+
+		if (radius >= 0.0f)
+		{
+			min = vector2(position.x - radius > viewMin.x ? position.x - radius : viewMin.x, position.y - radius > viewMin.y ? position.y - radius : viewMin.y);
+			max = vector2(position.x + radius < viewMax.x ? position.x + radius : viewMax.x, position.y + radius < viewMax.y ? position.y + radius : viewMax.y);
+		}
+
+		// Skipping Lights Outside of View
+		if (min.x >= max.x || min.y >= max.y)
+			return;
+
+		// Adding Quad
+		const Color& color = light.getColor();
+		const vector3& attenuation = light.getAttenuation();
+
+		const float corners[6][2] = {
+			{ min.x, min.y }, { max.x, min.y }, { min.x, max.y },
+			{ min.x, max.y }, { max.x, min.y }, { max.x, max.y }
+		};
+
+		for (unsigned int i = 0; i < 6; i++)
+		{
+			m_vertices.push_back(corners[i][0]);
+			m_vertices.push_back(corners[i][1]);
+			m_vertices.push_back(position.x);
+			m_vertices.push_back(position.y);
+			m_vertices.push_back(color.r);
+			m_vertices.push_back(color.g);
+			m_vertices.push_back(color.b);
+			m_vertices.push_back(attenuation.x);
+			m_vertices.push_back(attenuation.y);
+			m_vertices.push_back(attenuation.z);
+		}
+	}
+
+	void LightMap2D::m_flush()
+	{
+		if (m_vertices.size() == 0)
+			return;
+
+		// Updating Data in VBO
+		m_vbo->bind();
+		m_vbo->bufferData(nullptr, LIGHT_MAP2D_MAX_LIGHTS * 6 * LIGHT_MAP2D_VERTEX_SIZE, VERTEX_BUFFER_STREAM_DRAW); //orphaning, so driver doesn't wait for previous draw
+		m_vbo->bufferSubData(m_vertices.data(), m_vertices.size());
+		VertexBuffer::unbind();
+
+		// Rendering
+		m_vao.bind();
+		GLcall(glDrawArrays(GL_TRIANGLES, 0, m_vertices.size() / LIGHT_MAP2D_VERTEX_SIZE));
+
+		// Clearing Batch
+		m_vertices.clear();
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+#ifndef GUMIGOTA_LIGHTMAP2D_H
+#define GUMIGOTA_LIGHTMAP2D_H
+
+
+
+/* INCLUDES */
+// Normal Includes
+#include <vector>
+
+// Header Includes
+#include "Light2D.h"
+
+#include "../Shader.h"
+#include "../Color.h"
+
+#include "../buffers/FrameBuffer.h"
+#include "../buffers/VertexArray.h"
+#include "../buffers/VertexBuffer.h"
+
+#include "../../maths/matrices/matrix4.h"
+
+
+
+/* DEFINITIONS */
+#define LIGHT_MAP2D_MAX_LIGHTS   4096 //per draw call
+#define LIGHT_MAP2D_VERTEX_SIZE  10 //position (2), light position (2), color (3), attenuation (3)
+
+
+
+namespace gg
+{
+
+	class LightMap2D //accumulates light of 2D lights in a texture, so sprites only have to sample it once per fragment
+	{
+	private:
+		/* Variables */
+		FrameBuffer* m_fbo;
+		unsigned int m_width;
+		unsigned int m_height;
+
+		Shader m_shader;
+		VertexArray m_vao;
+		VertexBuffer* m_vbo;
+
+		std::vector<float> m_vertices;
+
+		Color m_ambientColor;
+
+		// Uniform Handles
+		unsigned int m_projectionMatrixHandle;
+		unsigned int m_viewMatrixHandle;
+
+	public:
+		/* Constructors */
+		LightMap2D(const unsigned int width, const unsigned int height);
+
+		/* Destructor */
+		~LightMap2D();
+
+		/* Functions */
+		void render(const std::vector<Light2D*>& lights, const matrix4& projection, const matrix4& view, const vector2& viewMin, const vector2& viewMax); //viewMin and viewMax are corners of visible area in world space
+		void bindTexture(const unsigned int slot) const;
+
+		// Setters
+		void setResolution(const unsigned int width, const unsigned int height); //recreates light map texture
+		void setAmbientColor(const Color& color);
+
+		// Getters
+		inline unsigned int getWidth()  const { return m_width;  }
+		inline unsigned int getHeight() const { return m_height; }
+
+		inline const Color& getAmbientColor() const { return m_ambientColor; }
+
+	private:
+		// Private Functions
+		void m_createFrameBuffer();
+		void m_addLight(const Light2D& light, const vector2& viewMin, const vector2& viewMax);
+		void m_flush();
+
+	};
+
+}
+
+
+
+#endif
\ No newline at end of file
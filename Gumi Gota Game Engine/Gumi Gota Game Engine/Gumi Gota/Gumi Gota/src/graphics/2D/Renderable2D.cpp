@@ -6,6 +6,8 @@
 // Header Includes
 #include "../buffers/VertexBuffer.h"
 
+#include "../../maths/trigonometry/Trigonometry.h"
+
 
 
 namespace gg
@@ -13,11 +15,13 @@ namespace gg
 
 	/* Constructors */
 	Renderable2D::Renderable2D(const vector2& pos, const vector2& size)
-		: m_position(pos - size / 2), m_size(size), m_rotation(0.0f), m_origin(pos)
+		: m_position(pos - size / 2), m_size(size), m_rotation(0.0f), m_origin(pos),
+		  m_spatialHash(nullptr), m_spatialHashID(0)
 	{}
 
 	Renderable2D::Renderable2D(const vector2& pos, const vector2& size, const float rot)
-		: m_position(pos - size / 2), m_size(size), m_rotation(rot), m_origin(pos)
+		: m_position(pos - size / 2), m_size(size), m_rotation(rot), m_origin(pos),
+		  m_spatialHash(nullptr), m_spatialHashID(0)
 	{}
 
 	/* Functions */
@@ -26,21 +30,29 @@ namespace gg
 	{
 		m_position += movement;
 		m_origin += movement;
+
+		m_updateSpatialHash();
 	}
 
 	void Renderable2D::addSize(const vector2& size)
 	{
 		m_size += size;
+
+		m_updateSpatialHash();
 	}
 
 	void Renderable2D::rotate(const float rot)
 	{
 		m_rotation += rot;
+
+		m_updateSpatialHash();
 	}
 
 	void Renderable2D::moveOrigin(const vector2& movement)
 	{
 		m_origin += movement;
+
+		m_updateSpatialHash();
 	}
 
 
@@ -48,21 +60,73 @@ namespace gg
 	{
 		m_position = pos;
 		m_origin += pos;
+
+		m_updateSpatialHash();
 	}
 
 	void Renderable2D::setSize(const vector2& size)
 	{
 		m_size = size;
+
+		m_updateSpatialHash();
 	}
 
 	void Renderable2D::setRotation(const float rot)
 	{
 		m_rotation = rot;
+
+		m_updateSpatialHash();
 	}
 
 	void Renderable2D::setOrigin(const vector2& origin)
 	{
 		m_origin = origin;
+
+		m_updateSpatialHash();
+	}
+
+	void Renderable2D::setSpatialHash(SpatialHash2D* hash, const unsigned int id)
+	{
+		m_spatialHash = hash;
+		m_spatialHashID = id;
+
+		m_updateSpatialHash();
+	}
+
+	// Getters
+	void Renderable2D::getBounds(vector2& min, vector2& max) const
+	{
+		float s = sine(m_rotation);
+		float c = cosine(m_rotation);
+
+		// Rotating Center Around Origin (same transform as SpriteBatch2D)
+		float localX = m_position.x - m_origin.x + m_size.x / 2;
+		float localY = m_position.y - m_origin.y + m_size.y / 2;
+
+		float centerX = m_origin.x + c * localX - s * localY;
+		float centerY = m_origin.y + s * localX + c * localY;
+
+		// Extents of Rotated Rectangle
+		float absC = c < 0.0f ? -c : c;
+		float absS = s < 0.0f ? -s : s;
+
+		float extentX = (absC * m_size.x + absS * m_size.y) / 2;
+		float extentY = (absS * m_size.x + absC * m_size.y) / 2;
+
+		min = vector2(centerX - extentX, centerY - extentY);
+		max = vector2(centerX + extentX, centerY + extentY);
+	}
+
+	// Private Functions
+	void Renderable2D::m_updateSpatialHash()
+	{
+		if (m_spatialHash == nullptr)
+			return;
+
+		vector2 min, max;
+		getBounds(min, max);
+
+		m_spatialHash->update(m_spatialHashID, min, max);
 	}
 
 }
\ No newline at end of file
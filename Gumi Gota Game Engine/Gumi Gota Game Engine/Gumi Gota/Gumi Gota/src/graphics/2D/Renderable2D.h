@@ -10,6 +10,8 @@
 #include "../buffers/VertexArray.h"
 #include "../buffers/IndexBuffer.h"
 
+#include "SpatialHash2D.h"
+
 
 
 namespace gg
@@ -24,6 +26,9 @@ namespace gg
 		float m_rotation; //stored in radians
 		vector2 m_origin; //used for different rotation points
 
+		SpatialHash2D* m_spatialHash; //grid of scene this renderable was added to
+		unsigned int m_spatialHashID;
+
 	public:
 		/* Constructors */
 		Renderable2D(const vector2& pos, const vector2& size); //default constructor
@@ -41,12 +46,20 @@ namespace gg
 		void setRotation(const float rot); //changing rotation ignoring current rotation
 		void setOrigin(const vector2& origin); //changing origin ignoring current origin
 
+		void setSpatialHash(SpatialHash2D* hash, const unsigned int id); //used by Scene2D, so grid gets updated on every change
+
 		// Getters
 		inline const vector2& getPosition() const { return m_position; }
 		inline const vector2& getSize()     const { return m_size;     }
 		inline       float    getRotation() const { return m_rotation; }
 		inline const vector2& getOrigin()   const { return m_origin;   }
 
+		void getBounds(vector2& min, vector2& max) const; //axis aligned bounding box, including rotation around origin
+
+	private:
+		// Private Functions
+		void m_updateSpatialHash();
+
 	};
 
 }
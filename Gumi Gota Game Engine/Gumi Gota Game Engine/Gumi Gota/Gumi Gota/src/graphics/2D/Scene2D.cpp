@@ -3,6 +3,9 @@
 // Self Include
 #include "Scene2D.h"
 
+// Normal Includes
+#include <algorithm>
+
 // Header Includes
 #include "../../utils/Sorting.h"
 
@@ -18,11 +21,15 @@ namespace gg
 	/* Functions */
 	void Scene2D::addSprite(Sprite2D* sprite)
 	{
+		sprite->setSpatialHash(&m_spriteGrid, m_sprites.size());
 		m_sprites.push_back(sprite);
 	}
 
 	void Scene2D::popBackSprites()
 	{
+		m_spriteGrid.remove(m_sprites.size() - 1);
+		m_sprites.back()->setSpatialHash(nullptr, 0);
+
 		m_sprites.pop_back();
 	}
 
@@ -32,21 +39,47 @@ namespace gg
 	}
 
 
+	void Scene2D::addLabel(Label2D* label)
+	{
+		label->setSpatialHash(&m_labelGrid, m_labels.size());
+		m_labels.push_back(label);
+	}
+
+	void Scene2D::popBackLabels()
+	{
+		m_labelGrid.remove(m_labels.size() - 1);
+		m_labels.back()->setSpatialHash(nullptr, 0);
+
+		m_labels.pop_back();
+	}
+
+	void Scene2D::reserveLabels(const unsigned int size)
+	{
+		m_labels.reserve(size);
+	}
+
+
 	void Scene2D::addLight(Light2D* light)
 	{
+		light->setSpatialHash(&m_lightGrid, m_lights.size());
 		m_lights.push_back(light);
 		m_isImportantLight.push_back(false);
 	}
 
 	void Scene2D::addLight(Light2D* light, const bool isImportant)
 	{
+		light->setSpatialHash(&m_lightGrid, m_lights.size());
 		m_lights.push_back(light);
 		m_isImportantLight.push_back(isImportant);
 	}
 
 	void Scene2D::popBackLights()
 	{
+		m_lightGrid.remove(m_lights.size() - 1);
+		m_lights.back()->setSpatialHash(nullptr, 0);
+
 		m_lights.pop_back();
+		m_isImportantLight.pop_back();
 	}
 
 	void Scene2D::reserveLights(const unsigned int size)
@@ -55,25 +88,73 @@ namespace gg
 	}
 
 
+	void Scene2D::getVisibleSprites(const vector2& min, const vector2& max, std::vector<Sprite2D*>& result)
+	{
+		// Querying Grid
+		m_queryIndices.clear();
+		m_spriteGrid.query(min, max, m_queryIndices);
+
+		// Restoring Drawing Order
+		std::sort(m_queryIndices.begin(), m_queryIndices.end());
+
+		for (unsigned int index : m_queryIndices)
+			result.push_back(m_sprites[index]);
+	}
+
+	void Scene2D::getVisibleLabels(const vector2& min, const vector2& max, std::vector<Label2D*>& result)
+	{
+		// Querying Grid
+		m_queryIndices.clear();
+		m_labelGrid.query(min, max, m_queryIndices);
+
+		// Restoring Drawing Order
+		std::sort(m_queryIndices.begin(), m_queryIndices.end());
+
+		for (unsigned int index : m_queryIndices)
+			result.push_back(m_labels[index]);
+	}
+
+	void Scene2D::getVisibleLightsIndices(const vector2& min, const vector2& max, std::vector<unsigned int>& result)
+	{
+		m_lightGrid.query(min, max, result);
+	}
+
+
+	void Scene2D::setGridCellSize(const float size)
+	{
+		m_spriteGrid = SpatialHash2D(size);
+		m_lightGrid = SpatialHash2D(size);
+		m_labelGrid = SpatialHash2D(size);
+
+		// Reinserting Everything
+		for (unsigned int i = 0; i < m_sprites.size(); i++)
+			m_sprites[i]->setSpatialHash(&m_spriteGrid, i);
+
+		for (unsigned int i = 0; i < m_lights.size(); i++)
+			m_lights[i]->setSpatialHash(&m_lightGrid, i);
+
+		for (unsigned int i = 0; i < m_labels.size(); i++)
+			m_labels[i]->setSpatialHash(&m_labelGrid, i);
+	}
+
+
 
 	/* ADDITIONAL FUNCTIONS */
 	std::vector<unsigned int> getClosestLightsIndices(const std::vector<Light2D*>& lights, const Camera2D& cam, const unsigned int amount)
 	{
 		// Init
 		std::vector<float> distances;
-		distances.reserve(amount);
+		distances.reserve(lights.size());
 
 		vector2 transformedCamPos = cam.getPosition() + cam.getHalfOfDisplaySize();
 
-		// Calculating Distances from Lights
+		// Calculating Distances from Lights (squared, order is the same)
 		for (unsigned int i = 0; i < lights.size(); i++)
-		{
-			// Distance Calculating
-			distances.push_back((transformedCamPos - lights[i]->getPosition()).length());
-		}
+			distances.push_back((transformedCamPos - lights[i]->getPosition()).lengthSquared());
 
-		// Getting Indices of Sorted Values
-		std::vector<unsigned int> indices = quickSortIndices(distances);
+		// Selecting Closest Lights
+		std::vector<unsigned int> indices;
+		selectLowestIndices(distances.data(), distances.size(), amount, indices);
 
 
 		return indices;
@@ -10,7 +10,9 @@
 // Header Includes
 #include "Light2D.h"
 #include "Sprite2D.h"
+#include "Label2D.h"
 #include "Camera2D.h"
+#include "SpatialHash2D.h"
 
 #include "../../utils/Timer.h"
 
@@ -24,12 +26,18 @@ namespace gg
 	protected:
 		/* Variables */
 		std::vector<Sprite2D*> m_sprites;
+		std::vector<Label2D*> m_labels;
 
 		std::vector<Light2D*> m_lights;
 		std::vector<bool> m_isImportantLight; //used for lights that are forced to be rendered
 		Timer m_lightTimer; //used for updating rendered lights (finding closest lights to the camera)
 		float m_lightUpdateInterval; //used for storing time used for updating rendered lights (finding closest lights to the camera)
 
+		SpatialHash2D m_spriteGrid; //sprites and lights are indexed by their position in vectors
+		SpatialHash2D m_lightGrid;
+		SpatialHash2D m_labelGrid;
+		std::vector<unsigned int> m_queryIndices; //reused between queries, so they don't allocate
+
 	public:
 		/* Constructors */
 		Scene2D();
@@ -39,11 +47,21 @@ namespace gg
 		void popBackSprites();
 		void reserveSprites(const unsigned int size);
 
+		void addLabel(Label2D* label);
+		void popBackLabels();
+		void reserveLabels(const unsigned int size);
+
 		void addLight(Light2D* light);
 		void addLight(Light2D* light, const bool isImportant); //if is isImportant is true light will be forced to be rendered
 		void popBackLights();
 		void reserveLights(const unsigned int size);
 
+		void getVisibleSprites(const vector2& min, const vector2& max, std::vector<Sprite2D*>& result); //appends sprites overlapping rectangle in order they were added
+		void getVisibleLabels(const vector2& min, const vector2& max, std::vector<Label2D*>& result); //appends labels overlapping rectangle in order they were added
+		void getVisibleLightsIndices(const vector2& min, const vector2& max, std::vector<unsigned int>& result); //appends indices of lights which light up rectangle
+
+		void setGridCellSize(const float size); //rebuilds grids; cell should be a few times bigger than typical sprite
+
 	};
 
 
@@ -0,0 +1,268 @@
+
+/* INCLUDES */
+// Self Include
+#include "SpatialHash2D.h"
+
+// Normal Includes
+#include <cmath>
+
+
+
+/* MACROS */
+#define SPATIAL_HASH2D_MAX_CELL_COORDINATE 1000000000
+
+
+
+namespace gg
+{
+
+	/* ADDITIONAL FUNCTIONS */
+	static unsigned long long s_getCellKey(const int x, const int y)
+	{
+		return ((unsigned long long)(unsigned int)x << 32) | (unsigned long long)(unsigned int)y;
+	}
+
+	static int s_getCellCoordinate(const float position, const float cellSize)
+	{
+		float cell = std::floor(position / cellSize);
+
+		// Clamping (items reaching infinitely far would overflow)
+		if (cell < -SPATIAL_HASH2D_MAX_CELL_COORDINATE)
+			return -SPATIAL_HASH2D_MAX_CELL_COORDINATE;
+		else if (cell > SPATIAL_HASH2D_MAX_CELL_COORDINATE)
+			return SPATIAL_HASH2D_MAX_CELL_COORDINATE;
+
+		return (int)cell;
+	}
+
+	static void s_removeFromBucket(std::vector<unsigned int>& bucket, const unsigned int id)
+	{
+		for (unsigned int i = 0; i < bucket.size(); i++)
+		{
+			if (bucket[i] == id)
+			{
+				bucket[i] = bucket.back(); //order in bucket doesn't matter
+				bucket.pop_back();
+				return;
+			}
+		}
+	}
+
+
+
+	/* Constructors */
+	SpatialHash2D::SpatialHash2D()
+		: m_cellSize(SPATIAL_HASH2D_DEFAULT_CELL_SIZE), m_queryStamp(0), m_changeCount(0)
+	{}
+
+	SpatialHash2D::SpatialHash2D(const float cellSize)
+		: m_cellSize(cellSize), m_queryStamp(0), m_changeCount(0)
+	{}
+
+	/* Functions */
+	void SpatialHash2D::insert(const unsigned int id, const vector2& min, const vector2& max)
+	{
+		// Making Space for Id
+		if (id >= m_items.size())
+		{
+			SpatialHash2DItem empty;
+			empty.isInserted = false;
+			empty.isLarge = false;
+
+			m_items.resize(id + 1, empty);
+			m_queryStamps.resize(id + 1, 0);
+		}
+
+		// Replacing Previous Item
+		if (m_items[id].isInserted)
+			m_removeFromCells(id);
+
+		// Item Setup
+		SpatialHash2DItem& item = m_items[id];
+		item.min = min;
+		item.max = max;
+		item.cellMinX = s_getCellCoordinate(min.x, m_cellSize);
+		item.cellMinY = s_getCellCoordinate(min.y, m_cellSize);
+		item.cellMaxX = s_getCellCoordinate(max.x, m_cellSize);
+		item.cellMaxY = s_getCellCoordinate(max.y, m_cellSize);
+		item.isInserted = true;
+
+		m_addToCells(id);
+
+		m_changeCount++;
+	}
+
+	void SpatialHash2D::update(const unsigned int id, const vector2& min, const vector2& max)
+	{
+		if (id >= m_items.size() || !m_items[id].isInserted)
+		{
+			insert(id, min, max);
+			return;
+		}
+
+		// Checking If Covered Cells Changed
+		SpatialHash2DItem& item = m_items[id];
+
+		int cellMinX = s_getCellCoordinate(min.x, m_cellSize);
+		int cellMinY = s_getCellCoordinate(min.y, m_cellSize);
+		int cellMaxX = s_getCellCoordinate(max.x, m_cellSize);
+		int cellMaxY = s_getCellCoordinate(max.y, m_cellSize);
+
+		item.min = min;
+		item.max = max;
+
+		m_changeCount++;
+
+		if (cellMinX == item.cellMinX && cellMinY == item.cellMinY && cellMaxX == item.cellMaxX && cellMaxY == item.cellMaxY)
+			return;
+
+		// Moving to New Cells
+		m_removeFromCells(id);
+
+		item.cellMinX = cellMinX;
+		item.cellMinY = cellMinY;
+		item.cellMaxX = cellMaxX;
+		item.cellMaxY = cellMaxY;
+
+		m_addToCells(id);
+	}
+
+	void SpatialHash2D::remove(const unsigned int id)
+	{
+		if (id >= m_items.size() || !m_items[id].isInserted)
+			return;
+
+		m_removeFromCells(id);
+		m_items[id].isInserted = false;
+
+		m_changeCount++;
+	}
+
+	void SpatialHash2D::clear()
+	{
+		m_cells.clear();
+		m_largeItems.clear();
+		m_items.clear();
+		m_queryStamps.clear();
+		m_queryStamp = 0;
+
+		m_changeCount++;
+	}
+
+
+	void SpatialHash2D::query(const vector2& min, const vector2& max, std::vector<unsigned int>& result)
+	{
+		// Starting New Query
+		m_queryStamp++;
+		if (m_queryStamp == 0) //stamps wrapped around
+		{
+			for (unsigned int& stamp : m_queryStamps)
+				stamp = 0;
+
+			m_queryStamp = 1;
+		}
+
+		// Large Items
+		for (unsigned int id : m_largeItems)
+		{
+			const SpatialHash2DItem& item = m_items[id];
+
+			if (item.min.x <= max.x && item.max.x >= min.x && item.min.y <= max.y && item.max.y >= min.y)
+				result.push_back(id);
+		}
+
+		// Items in Cells
+		int cellMinX = s_getCellCoordinate(min.x, m_cellSize);
+		int cellMinY = s_getCellCoordinate(min.y, m_cellSize);
+		int cellMaxX = s_getCellCoordinate(max.x, m_cellSize);
+		int cellMaxY = s_getCellCoordinate(max.y, m_cellSize);
+
+		long long queryCellCount = (long long)(cellMaxX - cellMinX + 1) * (long long)(cellMaxY - cellMinY + 1);
+
+		if (queryCellCount > (long long)m_cells.size()) //rectangle is bigger than occupied part of world, so visiting stored cells is cheaper
+		{
+			for (const std::pair<const unsigned long long, std::vector<unsigned int>>& cell : m_cells)
+				m_queryBucket(cell.second, min, max, result);
+		}
+		else
+		{
+			for (int y = cellMinY; y <= cellMaxY; y++)
+			{
+				for (int x = cellMinX; x <= cellMaxX; x++)
+				{
+					std::unordered_map<unsigned long long, std::vector<unsigned int>>::const_iterator cell = m_cells.find(s_getCellKey(x, y));
+					if (cell != m_cells.end())
+						m_queryBucket(cell->second, min, max, result);
+				}
+			}
+		}
+	}
+
+	// Private Functions
+	void SpatialHash2D::m_addToCells(const unsigned int id)
+	{
+		SpatialHash2DItem& item = m_items[id];
+
+		// Checking Item Size
+		long long cellCount = (long long)(item.cellMaxX - item.cellMinX + 1) * (long long)(item.cellMaxY - item.cellMinY + 1);
+
+		item.isLarge = cellCount > SPATIAL_HASH2D_MAX_ITEM_CELLS;
+		if (item.isLarge)
+		{
+			m_largeItems.push_back(id);
+			return;
+		}
+
+		// Adding to Buckets
+		for (int y = item.cellMinY; y <= item.cellMaxY; y++)
+		{
+			for (int x = item.cellMinX; x <= item.cellMaxX; x++)
+				m_cells[s_getCellKey(x, y)].push_back(id);
+		}
+	}
+
+	void SpatialHash2D::m_queryBucket(const std::vector<unsigned int>& bucket, const vector2& min, const vector2& max, std::vector<unsigned int>& result)
+	{
+		for (unsigned int id : bucket)
+		{
+			if (m_queryStamps[id] == m_queryStamp)
+				continue;
+
+			m_queryStamps[id] = m_queryStamp;
+
+			// Exact Bounding Box Test (cells are bigger than items)
+			const SpatialHash2DItem& item = m_items[id];
+
+			if (item.min.x <= max.x && item.max.x >= min.x && item.min.y <= max.y && item.max.y >= min.y)
+				result.push_back(id);
+		}
+	}
+
+	void SpatialHash2D::m_removeFromCells(const unsigned int id)
+	{
+		const SpatialHash2DItem& item = m_items[id];
+
+		if (item.isLarge)
+		{
+			s_removeFromBucket(m_largeItems, id);
+			return;
+		}
+
+		// Removing from Buckets
+		for (int y = item.cellMinY; y <= item.cellMaxY; y++)
+		{
+			for (int x = item.cellMinX; x <= item.cellMaxX; x++)
+			{
+				std::unordered_map<unsigned long long, std::vector<unsigned int>>::iterator cell = m_cells.find(s_getCellKey(x, y));
+				if (cell == m_cells.end())
+					continue;
+
+				s_removeFromBucket(cell->second, id);
+
+				if (cell->second.empty())
+					m_cells.erase(cell);
+			}
+		}
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,81 @@
+#ifndef GUMIGOTA_SPATIALHASH2D_H
+#define GUMIGOTA_SPATIALHASH2D_H
+
+
+
+/* INCLUDES */
+// Normal Includes
+#include <vector>
+#include <unordered_map>
+
+// Header Includes
+#include "../../maths/vectors/vector2.h"
+
+
+
+/* DEFINITIONS */
+#define SPATIAL_HASH2D_DEFAULT_CELL_SIZE 256.0f
+#define SPATIAL_HASH2D_MAX_ITEM_CELLS 64 //items covering more cells are kept in one list and tested on every query
+
+
+
+namespace gg
+{
+
+	/* ADDITIONAL STUFF */
+	struct SpatialHash2DItem
+	{
+		vector2 min, max; //bounding box
+		int cellMinX, cellMinY, cellMaxX, cellMaxY;
+		bool isInserted;
+		bool isLarge;
+	};
+
+
+
+	class SpatialHash2D //uniform grid of buckets indexed by item ids; only non-empty cells are stored
+	{
+	private:
+		/* Variables */
+		float m_cellSize;
+
+		std::unordered_map<unsigned long long, std::vector<unsigned int>> m_cells;
+		std::vector<unsigned int> m_largeItems;
+
+		std::vector<SpatialHash2DItem> m_items; //indexed by id
+
+		std::vector<unsigned int> m_queryStamps; //used for skipping items found in several cells
+		unsigned int m_queryStamp;
+
+		unsigned int m_changeCount; //increased on every change, so users can tell if anything moved
+
+	public:
+		/* Constructors */
+		SpatialHash2D();
+		SpatialHash2D(const float cellSize);
+
+		/* Functions */
+		void insert(const unsigned int id, const vector2& min, const vector2& max);
+		void update(const unsigned int id, const vector2& min, const vector2& max); //only touches buckets if covered cells changed
+		void remove(const unsigned int id);
+		void clear();
+
+		void query(const vector2& min, const vector2& max, std::vector<unsigned int>& result); //appends ids of items overlapping rectangle, in no particular order
+
+		// Getters
+		inline float getCellSize() const { return m_cellSize; }
+		inline unsigned int getChangeCount() const { return m_changeCount; }
+
+	private:
+		// Private Functions
+		void m_addToCells(const unsigned int id);
+		void m_removeFromCells(const unsigned int id);
+		void m_queryBucket(const std::vector<unsigned int>& bucket, const vector2& min, const vector2& max, std::vector<unsigned int>& result);
+
+	};
+
+}
+
+
+
+#endif
\ No newline at end of file
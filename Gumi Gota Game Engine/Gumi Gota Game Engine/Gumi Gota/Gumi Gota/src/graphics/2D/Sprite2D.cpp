@@ -11,12 +11,12 @@ namespace gg
 	/* Constructors */
 	Sprite2D::Sprite2D(const vector2& pos, const vector2& size)
 		: Renderable2D(pos, size),
-		  m_texture(nullptr)
+		  m_texture(nullptr), m_textureRegion(nullptr)
 	{}
 
 	Sprite2D::Sprite2D(const vector2& pos, const vector2& size, const float rot)
 		: Renderable2D(pos, size, rot),
-		  m_texture(nullptr)
+		  m_texture(nullptr), m_textureRegion(nullptr)
 	{}
 
 	/* Functions */
@@ -29,6 +29,13 @@ namespace gg
 	void Sprite2D::setTexture(Texture* tex)
 	{
 		m_texture = tex;
+		m_textureRegion = nullptr;
+	}
+
+	void Sprite2D::setTextureRegion(const TextureAtlasRegion* region)
+	{
+		m_textureRegion = region;
+		m_texture = nullptr;
 	}
 
 }
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include "Renderable2D.h"
 
 #include "../Texture.h"
+#include "../TextureAtlas.h"
 #include "../Color.h"
 
 
@@ -21,6 +22,7 @@ namespace gg
 		/* Variables */
 		Color m_color;
 		Texture* m_texture;
+		const TextureAtlasRegion* m_textureRegion; //used instead of whole texture if set
 
 	public:
 		/* Constructors */
@@ -31,10 +33,12 @@ namespace gg
 		// Setters
 		void setColor(const Color& color); //changes color of rendered object
 		void setTexture(Texture* tex); //changes texture of rendered object
+		void setTextureRegion(const TextureAtlasRegion* region); //changes texture of rendered object to part of texture atlas
 
 		// Getters
 		inline const Color& getColor() const { return m_color; }
-		inline Texture* getTexture() const { return m_texture; }
+		inline Texture* getTexture() const { return m_textureRegion != nullptr ? m_textureRegion->texture : m_texture; }
+		inline const TextureAtlasRegion* getTextureRegion() const { return m_textureRegion; }
 
 	};
 
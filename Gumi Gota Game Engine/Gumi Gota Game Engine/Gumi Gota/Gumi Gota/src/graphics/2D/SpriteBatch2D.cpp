@@ -0,0 +1,211 @@
+
+/* INCLUDES */
+// Self Include
+#include "SpriteBatch2D.h"
+
+// OpenGL Includes
+#include <GL/glew.h>
+
+// Header Includes
+#include "../ErrorHandling.h"
+
+#include "../../maths/trigonometry/Trigonometry.h"
+
+
+
+namespace gg
+{
+
+	/* ADDITIONAL FUNCTIONS */
+	static std::vector<unsigned int> s_createQuadIndices()
+	{
+		std::vector<unsigned int> indices;
+		indices.reserve(SPRITE_BATCH2D_MAX_SPRITES * 6);
+
+		for (unsigned int i = 0; i < SPRITE_BATCH2D_MAX_SPRITES; i++)
+		{
+			unsigned int first = i * 4;
+
+			// Same Triangles as Old Triangle Strip
+			indices.push_back(first + 0);
+			indices.push_back(first + 1);
+			indices.push_back(first + 2);
+
+			indices.push_back(first + 2);
+			indices.push_back(first + 1);
+			indices.push_back(first + 3);
+		}
+
+		return indices;
+	}
+
+	static unsigned int s_packColor(const Color& color)
+	{
+		unsigned int r = (unsigned int)((color.r < 0.0f ? 0.0f : (color.r > 1.0f ? 1.0f : color.r)) * 255.0f + 0.5f);
+		unsigned int g = (unsigned int)((color.g < 0.0f ? 0.0f : (color.g > 1.0f ? 1.0f : color.g)) * 255.0f + 0.5f);
+		unsigned int b = (unsigned int)((color.b < 0.0f ? 0.0f : (color.b > 1.0f ? 1.0f : color.b)) * 255.0f + 0.5f);
+		unsigned int a = (unsigned int)((color.a < 0.0f ? 0.0f : (color.a > 1.0f ? 1.0f : color.a)) * 255.0f + 0.5f);
+
+		return r | (g << 8) | (b << 16) | (a << 24); //bytes end up in rgba order in memory
+	}
+
+
+
+	/* Constructors */
+	SpriteBatch2D::SpriteBatch2D()
+		: m_vao(), m_ibo(s_createQuadIndices().data(), SPRITE_BATCH2D_MAX_SPRITES * 6),
+		  m_shader(nullptr),
+		  m_drawCalls(0)
+	{
+		// VBO Setup
+		m_vbo = new VertexBuffer(nullptr, SPRITE_BATCH2D_MAX_SPRITES * 4 * SPRITE_BATCH2D_VERTEX_SIZE, SPRITE_BATCH2D_VERTEX_SIZE, VERTEX_BUFFER_STREAM_DRAW);
+
+		m_vao.addAttribute(m_vbo, 0, 2, SPRITE_BATCH2D_VERTEX_SIZE, 0);
+		m_vao.addAttribute(m_vbo, 1, 2, SPRITE_BATCH2D_VERTEX_SIZE, 2);
+		m_vao.addPackedColorAttribute(m_vbo, 2, SPRITE_BATCH2D_VERTEX_SIZE, 4);
+		m_vao.addAttribute(m_vbo, 3, 1, SPRITE_BATCH2D_VERTEX_SIZE, 5);
+
+		// Reserving Memory
+		m_vertices.reserve(SPRITE_BATCH2D_MAX_SPRITES * 4);
+		m_textures.reserve(SPRITE_BATCH2D_MAX_TEXTURES);
+	}
+
+	/* Functions */
+	void SpriteBatch2D::begin(const Shader& shader)
+	{
+		if (m_shader != &shader)
+		{
+			flush();
+			m_shader = &shader;
+		}
+
+		m_drawCalls = 0;
+	}
+
+	void SpriteBatch2D::submit(const Sprite2D& sprite)
+	{
+		// Checking Space
+		if (m_vertices.size() + 4 > SPRITE_BATCH2D_MAX_SPRITES * 4)
+			flush();
+
+		// Getting Sprite Data
+		float textureSlot = sprite.getTexture() != nullptr ? m_getTextureSlot(sprite.getTexture()) : -1.0f;
+		unsigned int color = s_packColor(sprite.getColor());
+
+		vector2 uvMin(0.0f, 0.0f);
+		vector2 uvMax(1.0f, 1.0f);
+
+		if (sprite.getTextureRegion() != nullptr)
+		{
+			uvMin = sprite.getTextureRegion()->uvMin;
+			uvMax = sprite.getTextureRegion()->uvMax;
+		}
+
+		m_addQuad(sprite, vector2(0.0f, 0.0f), sprite.getSize(), uvMin, uvMax, color, textureSlot);
+	}
+
+	void SpriteBatch2D::submit(const Label2D& label)
+	{
+		unsigned int color = s_packColor(label.getColor());
+		float slotOffset = (label.getFont() != nullptr && label.getFont()->isSDF()) ? SPRITE_BATCH2D_SDF_SLOT_OFFSET : SPRITE_BATCH2D_MASK_SLOT_OFFSET;
+
+		for (const Label2DQuad& quad : label.getQuads())
+		{
+			// Checking Space
+			if (m_vertices.size() + 4 > SPRITE_BATCH2D_MAX_SPRITES * 4)
+				flush();
+
+			float textureSlot = m_getTextureSlot(quad.region->texture) + slotOffset;
+
+			m_addQuad(label, quad.min, quad.max, quad.region->uvMin, quad.region->uvMax, color, textureSlot);
+		}
+	}
+
+	void SpriteBatch2D::end()
+	{
+		flush();
+	}
+
+
+	void SpriteBatch2D::flush()
+	{
+		if (m_vertices.size() == 0 || m_shader == nullptr)
+			return;
+
+		// Binding
+		m_shader->start();
+
+		m_vao.bind();
+		m_ibo.bind();
+
+		for (unsigned int i = 0; i < m_textures.size(); i++)
+			m_textures[i]->bind(i);
+
+		// Updating Data in VBO
+		m_vbo->bind();
+		m_vbo->bufferData(nullptr, SPRITE_BATCH2D_MAX_SPRITES * 4 * SPRITE_BATCH2D_VERTEX_SIZE, VERTEX_BUFFER_STREAM_DRAW); //orphaning, so driver doesn't wait for previous draw
+		m_vbo->bufferSubData(m_vertices.data(), m_vertices.size() * SPRITE_BATCH2D_VERTEX_SIZE);
+		VertexBuffer::unbind();
+
+		// Rendering
+		GLcall(glDrawElements(GL_TRIANGLES, (m_vertices.size() / 4) * 6, GL_UNSIGNED_INT, nullptr));
+		m_drawCalls++;
+
+		// Clearing Batch
+		m_vertices.clear();
+		m_textures.clear();
+	}
+
+	// Private Functions
+	float SpriteBatch2D::m_getTextureSlot(const Texture* texture)
+	{
+		// Finding Texture in Batch
+		for (unsigned int i = 0; i < m_textures.size(); i++)
+		{
+			if (m_textures[i] == texture)
+				return (float)i;
+		}
+
+		// Adding Texture
+		if (m_textures.size() == SPRITE_BATCH2D_MAX_TEXTURES)
+			flush();
+
+		m_textures.push_back(texture);
+
+
+		return (float)(m_textures.size() - 1);
+	}
+
+	void SpriteBatch2D::m_addQuad(const Renderable2D& renderable, const vector2& min, const vector2& max, const vector2& uvMin, const vector2& uvMax, const unsigned int color, const float textureSlot)
+	{
+		const vector2& position = renderable.getPosition();
+		const vector2& origin = renderable.getOrigin();
+
+		float s = sine(renderable.getRotation());
+		float c = cosine(renderable.getRotation());
+
+		// Transforming Corners (same as translation(origin) * rotation * translation(position - origin) * scale(size))
+		float baseX = position.x - origin.x;
+		float baseY = position.y - origin.y;
+
+		for (unsigned int corner = 0; corner < 4; corner++)
+		{
+			float u = (float)(corner & 1);
+			float v = (float)(corner >> 1);
+
+			float localX = baseX + min.x + (max.x - min.x) * u;
+			float localY = baseY + min.y + (max.y - min.y) * v;
+
+			SpriteBatch2DVertex vertex;
+			vertex.x = origin.x + c * localX - s * localY;
+			vertex.y = origin.y + s * localX + c * localY;
+			vertex.u = uvMin.x + (uvMax.x - uvMin.x) * u;
+			vertex.v = uvMin.y + (uvMax.y - uvMin.y) * v;
+			vertex.color = color;
+			vertex.textureSlot = textureSlot;
+
+			m_vertices.push_back(vertex);
+		}
+	}
+
+}
\ No newline at end of file
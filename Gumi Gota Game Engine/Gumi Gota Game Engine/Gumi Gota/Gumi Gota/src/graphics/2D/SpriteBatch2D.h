@@ -0,0 +1,88 @@
+#ifndef GUMIGOTA_SPRITEBATCH2D_H
+#define GUMIGOTA_SPRITEBATCH2D_H
+
+
+
+/* INCLUDES */
+// Normal Includes
+#include <vector>
+
+// Header Includes
+#include "Sprite2D.h"
+#include "Label2D.h"
+
+#include "../Shader.h"
+#include "../Texture.h"
+
+#include "../buffers/VertexArray.h"
+#include "../buffers/VertexBuffer.h"
+#include "../buffers/IndexBuffer.h"
+
+
+
+/* DEFINITIONS */
+#define SPRITE_BATCH2D_MAX_SPRITES  10000
+#define SPRITE_BATCH2D_MAX_TEXTURES 16
+#define SPRITE_BATCH2D_VERTEX_SIZE  6 //position (2), texture coordinates (2), packed color (1), texture slot (1)
+
+#define SPRITE_BATCH2D_MASK_SLOT_OFFSET 16 //added to texture slot of glyphs; texture alpha is used as coverage of vertex color
+#define SPRITE_BATCH2D_SDF_SLOT_OFFSET  32 //added to texture slot of sdf glyphs; texture alpha is distance to edge
+
+
+
+namespace gg
+{
+
+	/* ADDITIONAL STUFF */
+	struct SpriteBatch2DVertex
+	{
+		float x, y;
+		float u, v;
+		unsigned int color; //rgba bytes
+		float textureSlot; //-1 for sprites without texture; offset for glyphs
+	};
+
+
+
+	class SpriteBatch2D //collects sprites transformed on cpu and draws them with as few calls as possible
+	{
+	private:
+		/* Variables */
+		VertexArray m_vao;
+		VertexBuffer* m_vbo;
+		IndexBuffer m_ibo;
+
+		std::vector<SpriteBatch2DVertex> m_vertices;
+		std::vector<const Texture*> m_textures; //texture of each slot in current batch
+
+		const Shader* m_shader;
+
+		unsigned int m_drawCalls; //since last begin()
+
+	public:
+		/* Constructors */
+		SpriteBatch2D();
+
+		/* Functions */
+		void begin(const Shader& shader); //flushes pending sprites if shader is different
+		void submit(const Sprite2D& sprite);
+		void submit(const Label2D& label); //glyphs are drawn as ordinary quads in the same batch
+		void end();
+
+		void flush();
+
+		// Getters
+		inline unsigned int getDrawCalls() const { return m_drawCalls; }
+
+	private:
+		// Private Functions
+		float m_getTextureSlot(const Texture* texture); //flushes if all slots are taken
+		void m_addQuad(const Renderable2D& renderable, const vector2& min, const vector2& max, const vector2& uvMin, const vector2& uvMax, const unsigned int color, const float textureSlot); //min and max are relative to renderable position
+
+	};
+
+}
+
+
+
+#endif
\ No newline at end of file
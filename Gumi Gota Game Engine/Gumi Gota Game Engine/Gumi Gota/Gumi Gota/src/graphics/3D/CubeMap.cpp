@@ -11,6 +11,7 @@
 
 // Header Includes
 #include "../ErrorHandling.h"
+#include "../GLStateCache.h"
 
 #include "../../Log.h"
 
@@ -44,8 +45,7 @@ namespace gg
 		m_vao.bind();
 
 		// Binding Texture
-		GLcall(glActiveTexture(GL_TEXTURE0));
-		GLcall(glBindTexture(GL_TEXTURE_CUBE_MAP, m_cubeMapID));
+		GLStateCache::bindTexture(0, GL_TEXTURE_CUBE_MAP, m_cubeMapID);
 	}
 
 	void CubeMap::bind(const unsigned int slot) const
@@ -54,15 +54,7 @@ namespace gg
 		m_vao.bind();
 
 		// Binding Texture
-		if (slot < 32)
-		{
-			GLcall(glActiveTexture(GL_TEXTURE0 + slot));
-			GLcall(glBindTexture(GL_TEXTURE_CUBE_MAP, m_cubeMapID));
-		}
-		else
-		{
-			LOG("[Error] Texture Slot is out of range.");
-		}
+		GLStateCache::bindTexture(slot, GL_TEXTURE_CUBE_MAP, m_cubeMapID);
 	}
 
 	void CubeMap::unbind()
@@ -71,7 +63,7 @@ namespace gg
 		VertexArray::unbind();
 
 		// Unbinding Texture
-		GLcall(glBindTexture(GL_TEXTURE_CUBE_MAP, 0));
+		GLStateCache::bindTexture(GL_TEXTURE_CUBE_MAP, 0);
 	}
 
 	// Setters
@@ -147,7 +139,7 @@ namespace gg
 		// Creating Cube Map
 		GLcall(glGenTextures(1, &m_cubeMapID));
 		///GLcall(glActiveTexture(GL_TEXTURE0)); ///check l8r if it's needed
-		GLcall(glBindTexture(GL_TEXTURE_CUBE_MAP, m_cubeMapID));
+		GLStateCache::bindTexture(GL_TEXTURE_CUBE_MAP, m_cubeMapID);
 
 		// Textures Setup
 		GLcall(glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
@@ -186,7 +178,7 @@ namespace gg
 		}
 
 		// Finishing
-		GLcall(glBindTexture(GL_TEXTURE_CUBE_MAP, 0));
+		GLStateCache::bindTexture(GL_TEXTURE_CUBE_MAP, 0);
 
 	}
 
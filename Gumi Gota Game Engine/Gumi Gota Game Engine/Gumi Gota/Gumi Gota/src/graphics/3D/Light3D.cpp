@@ -2,6 +2,9 @@
 // Self Include
 #include "Light3D.h"
 
+// Normal Includes
+#include <atomic>
+
 
 
 /* MACROS */
@@ -13,45 +16,78 @@
 namespace gg
 {
 
+	/* ADDITIONAL STUFF */
+	static std::atomic<unsigned int> s_nextVersion(0); //shared by all lights, so a new light at address of deleted one never matches its uploaded version
+
+
+
 	/* Constructors */
 	Light3D::Light3D(const vector3& pos)
-		: m_position(pos), m_color(LIGHT3D_DEFAULT_COLOR), m_attenuation(LIGHT3D_DEFAULT_ATTENUATION)
+		: m_position(pos), m_color(LIGHT3D_DEFAULT_COLOR), m_attenuation(LIGHT3D_DEFAULT_ATTENUATION),
+		  m_version(++s_nextVersion), m_lightGrid(nullptr), m_lightGridID(0)
 	{}
 
 	Light3D::Light3D(const vector3& pos, const Color& color)
-		: m_position(pos), m_color(color), m_attenuation(LIGHT3D_DEFAULT_ATTENUATION)
+		: m_position(pos), m_color(color), m_attenuation(LIGHT3D_DEFAULT_ATTENUATION),
+		  m_version(++s_nextVersion), m_lightGrid(nullptr), m_lightGridID(0)
 	{}
 
 	Light3D::Light3D(const vector3& pos, const Color& color, const vector3& attenuation)
-		: m_position(pos), m_color(color), m_attenuation(attenuation)
+		: m_position(pos), m_color(color), m_attenuation(attenuation),
+		  m_version(++s_nextVersion), m_lightGrid(nullptr), m_lightGridID(0)
 	{}
 
 	/* Functions */
 	void Light3D::move(const vector3& movement)
 	{
 		m_position += movement;
+		m_version = ++s_nextVersion;
+
+		m_updateLightGrid();
 	}
 
 	void Light3D::setPosition(const vector3& pos)
 	{
 		m_position = pos;
+		m_version = ++s_nextVersion;
+
+		m_updateLightGrid();
 	}
 
 
 	void Light3D::setColor(const Color& color)
 	{
 		m_color = color;
+		m_version = ++s_nextVersion;
 	}
 
 
 	void Light3D::increaseAttenuation(const vector3& value)
 	{
 		m_attenuation += value;
+		m_version = ++s_nextVersion;
 	}
 
 	void Light3D::setAttenuation(const vector3& value)
 	{
 		m_attenuation = value;
+		m_version = ++s_nextVersion;
+	}
+
+
+	void Light3D::setLightGrid(LightGrid3D* grid, const unsigned int id)
+	{
+		m_lightGrid = grid;
+		m_lightGridID = id;
+
+		m_updateLightGrid();
+	}
+
+	// Private Functions
+	void Light3D::m_updateLightGrid()
+	{
+		if (m_lightGrid != nullptr)
+			m_lightGrid->update(m_lightGridID, m_position);
 	}
 
 }
\ No newline at end of file
@@ -9,6 +9,8 @@
 
 #include "../Color.h"
 
+#include "LightGrid3D.h"
+
 
 
 namespace gg
@@ -22,6 +24,11 @@ namespace gg
 		Color m_color;
 		vector3 m_attenuation;
 
+		unsigned int m_version; //taken from process wide counter on creation and every change, so renderer knows when uploaded uniforms are outdated
+
+		LightGrid3D* m_lightGrid; //grid of scene this light was added to
+		unsigned int m_lightGridID;
+
 	public:
 		/* Constructors */
 		Light3D(const vector3& pos);
@@ -38,10 +45,17 @@ namespace gg
 		void increaseAttenuation(const vector3& value);
 		void setAttenuation(const vector3& value);
 
+		void setLightGrid(LightGrid3D* grid, const unsigned int id); //used by Scene3D, so grid gets updated on every move
+
 		// Getters
 		inline const vector3& getPosition()    const { return m_position;    }
 		inline const Color&   getColor()       const { return m_color;       }
 		inline const vector3& getAttenuation() const { return m_attenuation; }
+		inline unsigned int   getVersion()     const { return m_version;     }
+
+	private:
+		// Private Functions
+		void m_updateLightGrid();
 
 	};
 
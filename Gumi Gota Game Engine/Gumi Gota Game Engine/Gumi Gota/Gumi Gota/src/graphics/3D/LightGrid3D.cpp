@@ -0,0 +1,363 @@
+
+/* INCLUDES */
+// Self Include
+#include "LightGrid3D.h"
+
+// Normal Includes
+#include <cmath>
+#include <climits>
+
+// Header Includes
+#include "../../utils/Sorting.h"
+
+
+
+/* MACROS */
+#define LIGHT_GRID3D_MAX_CELL_COORDINATE 1000000 //coordinates are packed in 21 bits each
+
+
+
+namespace gg
+{
+
+	/* ADDITIONAL FUNCTIONS */
+	static unsigned long long s_getCellKey(const int x, const int y, const int z)
+	{
+		const unsigned long long mask = 0x1FFFFF;
+
+		return (((unsigned long long)(x + LIGHT_GRID3D_MAX_CELL_COORDINATE) & mask) << 42) |
+			   (((unsigned long long)(y + LIGHT_GRID3D_MAX_CELL_COORDINATE) & mask) << 21) |
+			   ((unsigned long long)(z + LIGHT_GRID3D_MAX_CELL_COORDINATE) & mask);
+	}
+
+	static int s_getCellCoordinate(const float position, const float cellSize)
+	{
+		float cell = std::floor(position / cellSize);
+
+		// Clamping (far away lights share border cells)
+		if (cell < -LIGHT_GRID3D_MAX_CELL_COORDINATE)
+			return -LIGHT_GRID3D_MAX_CELL_COORDINATE;
+		else if (cell > LIGHT_GRID3D_MAX_CELL_COORDINATE)
+			return LIGHT_GRID3D_MAX_CELL_COORDINATE;
+
+		return (int)cell;
+	}
+
+
+
+	/* Constructors */
+	LightGrid3D::LightGrid3D()
+		: m_cellSize(LIGHT_GRID3D_DEFAULT_CELL_SIZE), m_changeCount(0),
+		  m_previousAmount(0), m_previousChangeCount(0)
+	{
+		clear();
+	}
+
+	LightGrid3D::LightGrid3D(const float cellSize)
+		: m_cellSize(cellSize), m_changeCount(0),
+		  m_previousAmount(0), m_previousChangeCount(0)
+	{
+		clear();
+	}
+
+	/* Functions */
+	void LightGrid3D::insert(const unsigned int id, const vector3& position)
+	{
+		// Making Space for Id
+		if (id >= m_items.size())
+		{
+			LightGrid3DItem empty;
+			empty.isInserted = false;
+
+			m_items.resize(id + 1, empty);
+		}
+
+		// Replacing Previous Item
+		if (m_items[id].isInserted)
+			m_removeFromCell(id);
+
+		// Item Setup
+		LightGrid3DItem& item = m_items[id];
+		item.position = position;
+		item.cellX = s_getCellCoordinate(position.x, m_cellSize);
+		item.cellY = s_getCellCoordinate(position.y, m_cellSize);
+		item.cellZ = s_getCellCoordinate(position.z, m_cellSize);
+		item.isInserted = true;
+
+		m_addToCell(id);
+
+		m_changeCount++;
+	}
+
+	void LightGrid3D::update(const unsigned int id, const vector3& position)
+	{
+		if (id >= m_items.size() || !m_items[id].isInserted)
+		{
+			insert(id, position);
+			return;
+		}
+
+		// Checking If Cell Changed
+		LightGrid3DItem& item = m_items[id];
+		item.position = position;
+
+		m_changeCount++;
+
+		int cellX = s_getCellCoordinate(position.x, m_cellSize);
+		int cellY = s_getCellCoordinate(position.y, m_cellSize);
+		int cellZ = s_getCellCoordinate(position.z, m_cellSize);
+
+		if (cellX == item.cellX && cellY == item.cellY && cellZ == item.cellZ)
+			return;
+
+		// Moving to New Cell
+		m_removeFromCell(id);
+
+		item.cellX = cellX;
+		item.cellY = cellY;
+		item.cellZ = cellZ;
+
+		m_addToCell(id);
+	}
+
+	void LightGrid3D::remove(const unsigned int id)
+	{
+		if (id >= m_items.size() || !m_items[id].isInserted)
+			return;
+
+		m_removeFromCell(id);
+		m_items[id].isInserted = false;
+
+		m_changeCount++;
+	}
+
+	void LightGrid3D::clear()
+	{
+		m_cells.clear();
+		m_items.clear();
+
+		for (unsigned int i = 0; i < 3; i++)
+		{
+			m_cellMin[i] = INT_MAX;
+			m_cellMax[i] = INT_MIN;
+		}
+
+		m_previousResult.clear();
+		m_changeCount++;
+	}
+
+
+	void LightGrid3D::getClosest(const vector3& position, const unsigned int amount, std::vector<unsigned int>& result)
+	{
+		// Reusing Previous Result If Nothing Moved
+		if (m_previousChangeCount == m_changeCount && m_previousAmount == amount && m_previousPosition == position)
+		{
+			result = m_previousResult;
+			return;
+		}
+
+		// Gathering Lights Within Radius Containing Enough of Them
+		m_candidates.clear();
+		m_candidateDistances.clear();
+
+		if (amount > 0 && m_cells.size() > 0)
+			m_gatherCandidates(position, m_findSearchRadiusSquared(position, amount));
+
+		// Selecting Closest
+		std::vector<unsigned int> selected;
+		selectLowestIndices(m_candidateDistances.data(), m_candidateDistances.size(), amount, selected);
+
+		result.clear();
+		result.reserve(selected.size());
+
+		for (unsigned int index : selected)
+			result.push_back(m_candidates[index]);
+
+		// Remembering Query
+		m_previousPosition = position;
+		m_previousAmount = amount;
+		m_previousChangeCount = m_changeCount;
+		m_previousResult = result;
+	}
+
+	// Private Functions
+	void LightGrid3D::m_addToCell(const unsigned int id)
+	{
+		const LightGrid3DItem& item = m_items[id];
+
+		m_cells[s_getCellKey(item.cellX, item.cellY, item.cellZ)].push_back(id);
+
+		// Growing Bounds
+		const int cell[3] = { item.cellX, item.cellY, item.cellZ };
+
+		for (unsigned int i = 0; i < 3; i++)
+		{
+			if (cell[i] < m_cellMin[i])
+				m_cellMin[i] = cell[i];
+			if (cell[i] > m_cellMax[i])
+				m_cellMax[i] = cell[i];
+		}
+	}
+
+	void LightGrid3D::m_removeFromCell(const unsigned int id)
+	{
+		const LightGrid3DItem& item = m_items[id];
+
+		std::unordered_map<unsigned long long, std::vector<unsigned int>>::iterator cell = m_cells.find(s_getCellKey(item.cellX, item.cellY, item.cellZ));
+		if (cell == m_cells.end())
+			return;
+
+		std::vector<unsigned int>& bucket = cell->second;
+
+		for (unsigned int i = 0; i < bucket.size(); i++)
+		{
+			if (bucket[i] == id)
+			{
+				bucket[i] = bucket.back(); //order in bucket doesn't matter
+				bucket.pop_back();
+				break;
+			}
+		}
+
+		if (bucket.empty())
+			m_cells.erase(cell);
+	}
+
+
+	float LightGrid3D::m_findSearchRadiusSquared(const vector3& position, const unsigned int amount)
+	{
+		float radiusSquared = 0.0f;
+
+		// Previous Result (its lights are still amount candidates, so the new closest ones can't be further than the furthest of them)
+		bool isPreviousResultValid = m_previousResult.size() == amount;
+
+		for (unsigned int i = 0; i < m_previousResult.size() && isPreviousResultValid; i++)
+		{
+			unsigned int id = m_previousResult[i];
+
+			if (id >= m_items.size() || !m_items[id].isInserted)
+			{
+				isPreviousResultValid = false;
+				break;
+			}
+
+			float distanceSquared = (position - m_items[id].position).lengthSquared();
+			if (distanceSquared > radiusSquared)
+				radiusSquared = distanceSquared;
+		}
+
+		if (isPreviousResultValid)
+			return radiusSquared;
+
+		// Growing Rings of Cells Until Enough Lights are Found
+		int centerX = s_getCellCoordinate(position.x, m_cellSize);
+		int centerY = s_getCellCoordinate(position.y, m_cellSize);
+		int centerZ = s_getCellCoordinate(position.z, m_cellSize);
+
+		unsigned int foundCount = 0;
+		radiusSquared = 0.0f;
+
+		for (int ring = 0; foundCount < amount; ring++)
+		{
+			// Checking If Ring Left Occupied Bounds (every light was found)
+			if (centerX - ring < m_cellMin[0] && centerX + ring > m_cellMax[0] &&
+				centerY - ring < m_cellMin[1] && centerY + ring > m_cellMax[1] &&
+				centerZ - ring < m_cellMin[2] && centerZ + ring > m_cellMax[2])
+				break;
+
+			// Checking If Visiting Rings Got More Expensive than Visiting Stored Cells
+			long long ringCellCount = (long long)(2 * ring + 1) * (2 * ring + 1) * (2 * ring + 1);
+			if (ringCellCount > (long long)m_cells.size())
+				return -1.0f;
+
+			// Visiting Cells on Ring Surface
+			for (int x = centerX - ring; x <= centerX + ring; x++)
+			{
+				for (int y = centerY - ring; y <= centerY + ring; y++)
+				{
+					bool isOnSide = x == centerX - ring || x == centerX + ring || y == centerY - ring || y == centerY + ring;
+					int zStep = (isOnSide || ring == 0) ? 1 : 2 * ring; //inside of ring was visited before, only front and back cells are left
+
+					for (int z = centerZ - ring; z <= centerZ + ring; z += zStep)
+					{
+						std::unordered_map<unsigned long long, std::vector<unsigned int>>::const_iterator cell = m_cells.find(s_getCellKey(x, y, z));
+						if (cell == m_cells.end())
+							continue;
+
+						for (unsigned int id : cell->second)
+						{
+							float distanceSquared = (position - m_items[id].position).lengthSquared();
+							if (distanceSquared > radiusSquared)
+								radiusSquared = distanceSquared;
+						}
+
+						foundCount += cell->second.size();
+					}
+				}
+			}
+		}
+
+		return foundCount >= amount ? radiusSquared : -1.0f; //negative radius means every light is a candidate
+	}
+
+	void LightGrid3D::m_gatherCandidates(const vector3& position, const float radiusSquared)
+	{
+		// Every Light
+		if (radiusSquared < 0.0f)
+		{
+			for (const std::pair<const unsigned long long, std::vector<unsigned int>>& cell : m_cells)
+				m_gatherBucket(cell.second, position, radiusSquared);
+
+			return;
+		}
+
+		// Cells Overlapping Sphere's Bounding Box
+		float radius = std::sqrt(radiusSquared);
+
+		int minX = s_getCellCoordinate(position.x - radius, m_cellSize), maxX = s_getCellCoordinate(position.x + radius, m_cellSize);
+		int minY = s_getCellCoordinate(position.y - radius, m_cellSize), maxY = s_getCellCoordinate(position.y + radius, m_cellSize);
+		int minZ = s_getCellCoordinate(position.z - radius, m_cellSize), maxZ = s_getCellCoordinate(position.z + radius, m_cellSize);
+
+		minX = minX > m_cellMin[0] ? minX : m_cellMin[0]; maxX = maxX < m_cellMax[0] ? maxX : m_cellMax[0];
+		minY = minY > m_cellMin[1] ? minY : m_cellMin[1]; maxY = maxY < m_cellMax[1] ? maxY : m_cellMax[1];
+		minZ = minZ > m_cellMin[2] ? minZ : m_cellMin[2]; maxZ = maxZ < m_cellMax[2] ? maxZ : m_cellMax[2];
+
+		long long boxCellCount = (long long)(maxX - minX + 1) * (maxY - minY + 1) * (maxZ - minZ + 1);
+
+		if (boxCellCount > (long long)m_cells.size()) //box is bigger than occupied part of world, so visiting stored cells is cheaper
+		{
+			for (const std::pair<const unsigned long long, std::vector<unsigned int>>& cell : m_cells)
+				m_gatherBucket(cell.second, position, radiusSquared);
+
+			return;
+		}
+
+		for (int x = minX; x <= maxX; x++)
+		{
+			for (int y = minY; y <= maxY; y++)
+			{
+				for (int z = minZ; z <= maxZ; z++)
+				{
+					std::unordered_map<unsigned long long, std::vector<unsigned int>>::const_iterator cell = m_cells.find(s_getCellKey(x, y, z));
+					if (cell != m_cells.end())
+						m_gatherBucket(cell->second, position, radiusSquared);
+				}
+			}
+		}
+	}
+
+	void LightGrid3D::m_gatherBucket(const std::vector<unsigned int>& bucket, const vector3& position, const float radiusSquared)
+	{
+		for (unsigned int id : bucket)
+		{
+			float distanceSquared = (position - m_items[id].position).lengthSquared();
+
+			if (radiusSquared < 0.0f || distanceSquared <= radiusSquared)
+			{
+				m_candidates.push_back(id);
+				m_candidateDistances.push_back(distanceSquared);
+			}
+		}
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+#ifndef GUMIGOTA_LIGHTGRID3D_H
+#define GUMIGOTA_LIGHTGRID3D_H
+
+
+
+/* INCLUDES */
+// Normal Includes
+#include <vector>
+#include <unordered_map>
+
+// Header Includes
+#include "../../maths/vectors/vector3.h"
+
+
+
+/* DEFINITIONS */
+#define LIGHT_GRID3D_DEFAULT_CELL_SIZE 64.0f
+
+
+
+namespace gg
+{
+
+	/* ADDITIONAL STUFF */
+	struct LightGrid3DItem
+	{
+		vector3 position;
+		int cellX, cellY, cellZ;
+		bool isInserted;
+	};
+
+
+
+	class LightGrid3D //uniform grid of light ids used for finding lights closest to the camera; only non-empty cells are stored
+	{
+	private:
+		/* Variables */
+		float m_cellSize;
+
+		std::unordered_map<unsigned long long, std::vector<unsigned int>> m_cells;
+		std::vector<LightGrid3DItem> m_items; //indexed by id
+
+		int m_cellMin[3], m_cellMax[3]; //bounds of cells that were ever occupied since last clear
+		unsigned int m_changeCount; //increased on every change, so users can tell if anything moved
+
+		// Previous Query (temporal coherence)
+		vector3 m_previousPosition;
+		unsigned int m_previousAmount;
+		unsigned int m_previousChangeCount;
+		std::vector<unsigned int> m_previousResult;
+
+		std::vector<unsigned int> m_candidates;
+		std::vector<float> m_candidateDistances; //squared
+
+	public:
+		/* Constructors */
+		LightGrid3D();
+		LightGrid3D(const float cellSize);
+
+		/* Functions */
+		void insert(const unsigned int id, const vector3& position);
+		void update(const unsigned int id, const vector3& position); //only touches buckets if cell changed
+		void remove(const unsigned int id);
+		void clear();
+
+		void getClosest(const vector3& position, const unsigned int amount, std::vector<unsigned int>& result); //ids of closest lights, sorted from closest
+
+		// Getters
+		inline float getCellSize() const { return m_cellSize; }
+		inline unsigned int getChangeCount() const { return m_changeCount; }
+
+	private:
+		// Private Functions
+		void m_addToCell(const unsigned int id);
+		void m_removeFromCell(const unsigned int id);
+
+		float m_findSearchRadiusSquared(const vector3& position, const unsigned int amount); //distance that surely contains amount lights, based on previous result or growing rings of cells
+		void m_gatherCandidates(const vector3& position, const float radiusSquared);
+		void m_gatherBucket(const std::vector<unsigned int>& bucket, const vector3& position, const float radiusSquared);
+
+	};
+
+}
+
+
+
+#endif
\ No newline at end of file
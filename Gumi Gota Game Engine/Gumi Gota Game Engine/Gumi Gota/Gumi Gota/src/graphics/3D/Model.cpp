@@ -3,9 +3,14 @@
 // Self Include
 #include "Model.h"
 
+// Normal Includes
+#include <utility>
+
 // Header Includes
 #include "../buffers/VertexBuffer.h"
 
+#include "../../Log.h"
+
 
 
 /* MACROS */
@@ -23,51 +28,79 @@ namespace gg
 	/* Constructors */
 	Model::Model(const float* vertices, const unsigned int vertexCount, const float* texCoords, const unsigned int texCoordsCount, const std::string& textureFilepath, const float* normals, const unsigned int normalCount, const unsigned int* indices, const unsigned int indexCount)
 		: m_vertexCount(indexCount),
-		  m_vao(), m_ibo(indices, indexCount),
+		  m_vao(nullptr), m_ibo(nullptr),
+		  m_geometryPool(nullptr),
 		  m_texture(textureFilepath),
 		  m_shineDamper(MODEL_DEFAULT_SHINE_DAMPER), m_reflectivity(MODEL_DEFAULT_REFLECTIVITY),
 		  m_hasTransparency(MODEL_DEFAULT_HAS_TRANSPARENCY), m_hasFakeLighting(MODEL_DEFAULT_HAS_FAKE_LIGHTING)
 	{
-		// Creating Vertex Buffers
-		VertexBuffer* positionsVBO = new VertexBuffer(vertices, vertexCount, 3);
-		VertexBuffer* textureCoordinatesVBO = new VertexBuffer(texCoords, texCoordsCount, 2);
-		VertexBuffer* normalsVBO = new VertexBuffer(normals, normalCount, 3);
+		m_createBuffers(vertices, vertexCount, texCoords, texCoordsCount, normals, normalCount, indices, indexCount);
+	}
 
-		// Attaching VBOs to VAO
-		m_vao.addAttribute(positionsVBO, 0);
-		m_vao.addAttribute(textureCoordinatesVBO, 1);
-		m_vao.addAttribute(normalsVBO, 2);
+	Model::Model(const float* vertices, const unsigned int vertexCount, const float* texCoords, const unsigned int texCoordsCount, const std::string& textureFilepath, const float* normals, const unsigned int normalCount, const unsigned int* indices, const unsigned int indexCount, const float shineDamper, const float reflectivity)
+		: m_vertexCount(indexCount),
+		  m_vao(nullptr), m_ibo(nullptr),
+		  m_geometryPool(nullptr),
+		  m_texture(textureFilepath),
+		  m_shineDamper(shineDamper), m_reflectivity(reflectivity),
+		  m_hasTransparency(MODEL_DEFAULT_HAS_TRANSPARENCY), m_hasFakeLighting(MODEL_DEFAULT_HAS_FAKE_LIGHTING)
+	{
+		m_createBuffers(vertices, vertexCount, texCoords, texCoordsCount, normals, normalCount, indices, indexCount);
+	}
 
-		// Finishing
-		VertexArray::unbind();
+	Model::Model(GeometryPool& pool, const float* vertices, const unsigned int vertexCount, const float* texCoords, const unsigned int texCoordsCount, const std::string& textureFilepath, const float* normals, const unsigned int normalCount, const unsigned int* indices, const unsigned int indexCount)
+		: m_vertexCount(indexCount),
+		  m_vao(nullptr), m_ibo(nullptr),
+		  m_geometryPool(&pool),
+		  m_texture(textureFilepath),
+		  m_shineDamper(MODEL_DEFAULT_SHINE_DAMPER), m_reflectivity(MODEL_DEFAULT_REFLECTIVITY),
+		  m_hasTransparency(MODEL_DEFAULT_HAS_TRANSPARENCY), m_hasFakeLighting(MODEL_DEFAULT_HAS_FAKE_LIGHTING)
+	{
+		m_storeGeometry(pool, vertices, vertexCount, texCoords, texCoordsCount, normals, normalCount, indices, indexCount);
 	}
 
-	Model::Model(const float* vertices, const unsigned int vertexCount, const float* texCoords, const unsigned int texCoordsCount, const std::string& textureFilepath, const float* normals, const unsigned int normalCount, const unsigned int* indices, const unsigned int indexCount, const float shineDamper, const float reflectivity)
+	Model::Model(GeometryPool& pool, const float* vertices, const unsigned int vertexCount, const float* texCoords, const unsigned int texCoordsCount, const std::string& textureFilepath, const float* normals, const unsigned int normalCount, const unsigned int* indices, const unsigned int indexCount, const float shineDamper, const float reflectivity)
 		: m_vertexCount(indexCount),
-		  m_vao(), m_ibo(indices, indexCount),
+		  m_vao(nullptr), m_ibo(nullptr),
+		  m_geometryPool(&pool),
 		  m_texture(textureFilepath),
 		  m_shineDamper(shineDamper), m_reflectivity(reflectivity),
 		  m_hasTransparency(MODEL_DEFAULT_HAS_TRANSPARENCY), m_hasFakeLighting(MODEL_DEFAULT_HAS_FAKE_LIGHTING)
 	{
-		// Creating Vertex Buffers
-		VertexBuffer* positionsVBO = new VertexBuffer(vertices, vertexCount, 3);
-		VertexBuffer* textureCoordinatesVBO = new VertexBuffer(texCoords, texCoordsCount, 2);
-		VertexBuffer* normalsVBO = new VertexBuffer(normals, normalCount, 3);
+		m_storeGeometry(pool, vertices, vertexCount, texCoords, texCoordsCount, normals, normalCount, indices, indexCount);
+	}
 
-		// Attaching VBOs to VAO
-		m_vao.addAttribute(positionsVBO, 0);
-		m_vao.addAttribute(textureCoordinatesVBO, 1);
-		m_vao.addAttribute(normalsVBO, 2);
+	Model::Model(Model&& other)
+		: m_vertexCount(other.m_vertexCount),
+		  m_vao(other.m_vao), m_ibo(other.m_ibo),
+		  m_geometryPool(other.m_geometryPool), m_geometryRange(other.m_geometryRange),
+		  m_texture(std::move(other.m_texture)),
+		  m_shineDamper(other.m_shineDamper), m_reflectivity(other.m_reflectivity),
+		  m_hasTransparency(other.m_hasTransparency), m_hasFakeLighting(other.m_hasFakeLighting)
+	{
+		other.m_vao = nullptr;
+		other.m_ibo = nullptr;
+	}
 
-		// Finishing
-		VertexArray::unbind();
+	/* Destructor */
+	Model::~Model()
+	{
+		delete m_vao;
+		delete m_ibo;
 	}
 
 	/* Functions */
 	void Model::bind() const
 	{
-		m_vao.bind();
-		m_ibo.bind();
+		if (m_geometryPool != nullptr)
+		{
+			m_geometryPool->bind();
+		}
+		else
+		{
+			m_vao->bind();
+			m_ibo->bind();
+		}
 
 		m_texture.bind();
 	}
@@ -108,4 +141,38 @@ namespace gg
 		m_texture.setAtlasRows(amount);
 	}
 
+	// Private Functions
+	void Model::m_createBuffers(const float* vertices, const unsigned int vertexCount, const float* texCoords, const unsigned int texCoordsCount, const float* normals, const unsigned int normalCount, const unsigned int* indices, const unsigned int indexCount)
+	{
+		// Creating Buffers
+		m_vao = new VertexArray();
+		m_ibo = new IndexBuffer(indices, indexCount);
+
+		VertexBuffer* positionsVBO = new VertexBuffer(vertices, vertexCount, 3);
+		VertexBuffer* textureCoordinatesVBO = new VertexBuffer(texCoords, texCoordsCount, 2);
+		VertexBuffer* normalsVBO = new VertexBuffer(normals, normalCount, 3);
+
+		// Attaching VBOs to VAO
+		m_vao->addAttribute(positionsVBO, 0);
+		m_vao->addAttribute(textureCoordinatesVBO, 1);
+		m_vao->addAttribute(normalsVBO, 2);
+
+		// Finishing
+		VertexArray::unbind();
+	}
+
+	void Model::m_storeGeometry(GeometryPool& pool, const float* vertices, const unsigned int vertexCount, const float* texCoords, const unsigned int texCoordsCount, const float* normals, const unsigned int normalCount, const unsigned int* indices, const unsigned int indexCount)
+	{
+		// Storing Geometry in Pool
+		if (pool.allocate(vertices, texCoords, normals, vertexCount / 3, indices, indexCount, m_geometryRange))
+			return;
+
+		LOG("[Warning] Geometry pool is full, model will use its own buffers");
+
+		// Falling Back to Own Buffers
+		m_geometryPool = nullptr;
+
+		m_createBuffers(vertices, vertexCount, texCoords, texCoordsCount, normals, normalCount, indices, indexCount);
+	}
+
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
 // Header Includes
 #include "../buffers/VertexArray.h"
 #include "../buffers/IndexBuffer.h"
+#include "../buffers/GeometryPool.h"
 
 #include "../Texture.h"
 
@@ -21,8 +22,11 @@ namespace gg
 		/* Variables */
 		unsigned int m_vertexCount;
 
-		VertexArray m_vao;
-		IndexBuffer m_ibo;
+		VertexArray* m_vao; //nullptr if model is stored in geometry pool
+		IndexBuffer* m_ibo;
+
+		GeometryPool* m_geometryPool; //nullptr if model uses its own buffers
+		GeometryPoolRange m_geometryRange;
 
 		Texture m_texture;
 
@@ -36,6 +40,15 @@ namespace gg
 		/* Constructors */
 		Model(const float* vertices, const unsigned int vertexCount, const float* texCoords, const unsigned int texCoordsCount, const std::string& textureFilepath, const float* normals, const unsigned int normalCount, const unsigned int* indices, const unsigned int indexCount);
 		Model(const float* vertices, const unsigned int vertexCount, const float* texCoords, const unsigned int texCoordsCount, const std::string& textureFilepath, const float* normals, const unsigned int normalCount, const unsigned int* indices, const unsigned int indexCount, const float shineDamper, const float reflectivity);
+		Model(GeometryPool& pool, const float* vertices, const unsigned int vertexCount, const float* texCoords, const unsigned int texCoordsCount, const std::string& textureFilepath, const float* normals, const unsigned int normalCount, const unsigned int* indices, const unsigned int indexCount); //model's geometry is stored in the pool, so it can be drawn together with other pooled models; uses its own buffers if pool is full
+		Model(GeometryPool& pool, const float* vertices, const unsigned int vertexCount, const float* texCoords, const unsigned int texCoordsCount, const std::string& textureFilepath, const float* normals, const unsigned int normalCount, const unsigned int* indices, const unsigned int indexCount, const float shineDamper, const float reflectivity);
+		Model(Model&& other);
+
+		Model(const Model&) = delete; //model owns its buffers
+		Model& operator=(const Model&) = delete;
+
+		/* Destructor */
+		~Model();
 
 		/* Functions */
 		void bind() const;
@@ -60,6 +73,15 @@ namespace gg
 		inline bool hasFakeLighting() const { return m_hasFakeLighting; }
 		
 		inline unsigned int getTextureRows() const { return m_texture.getAtlasRows(); }
+		inline unsigned int getTextureID() const { return m_texture.getID(); }
+
+		inline GeometryPool* getGeometryPool() const { return m_geometryPool; }
+		inline const GeometryPoolRange& getGeometryRange() const { return m_geometryRange; }
+
+	private:
+		// Private Functions
+		void m_createBuffers(const float* vertices, const unsigned int vertexCount, const float* texCoords, const unsigned int texCoordsCount, const float* normals, const unsigned int normalCount, const unsigned int* indices, const unsigned int indexCount);
+		void m_storeGeometry(GeometryPool& pool, const float* vertices, const unsigned int vertexCount, const float* texCoords, const unsigned int texCoordsCount, const float* normals, const unsigned int normalCount, const unsigned int* indices, const unsigned int indexCount); //stores geometry in pool, or in own buffers if pool is full
 
 	};
 
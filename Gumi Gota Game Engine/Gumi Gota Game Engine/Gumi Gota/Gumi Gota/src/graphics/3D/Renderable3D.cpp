@@ -3,6 +3,9 @@
 // Self Include
 #include "Renderable3D.h"
 
+// Header Includes
+#include "../../maths/transforms/transform.h"
+
 
 
 /* MACROS */
@@ -16,12 +19,12 @@ namespace gg
 
 	/* Constructors */
 	Renderable3D::Renderable3D(Model* model, const vector3& pos)
-		: m_position(pos), m_rotation(RENDERABLE3D_DEFAULT_ROTATION), m_scale(RENDERABLE3D_DEFAULT_SCALE),
+		: m_position(pos), m_rotation(RENDERABLE3D_DEFAULT_ROTATION), m_usesQuaternion(false), m_scale(RENDERABLE3D_DEFAULT_SCALE),
 		  m_model(model), m_textureAtlasIndex(0)
 	{}
 
 	Renderable3D::Renderable3D(Model* model, const vector3& pos, const unsigned int atlasIndex)
-		: m_position(pos), m_rotation(RENDERABLE3D_DEFAULT_ROTATION), m_scale(RENDERABLE3D_DEFAULT_SCALE),
+		: m_position(pos), m_rotation(RENDERABLE3D_DEFAULT_ROTATION), m_usesQuaternion(false), m_scale(RENDERABLE3D_DEFAULT_SCALE),
 		  m_model(model), m_textureAtlasIndex(atlasIndex)
 	{}
 
@@ -34,7 +37,15 @@ namespace gg
 
 	void Renderable3D::rotate(const vector3& rot)
 	{
-		m_rotation += rot;
+		if (m_usesQuaternion)
+			setRotation(quaternion::euler(rot.x, rot.y, rot.z) * m_quaternionRotation); //normalized like rotate(quaternion), so length doesn't drift
+		else
+			m_rotation += rot;
+	}
+
+	void Renderable3D::rotate(const quaternion& rot)
+	{
+		setRotation(rot * getQuaternionRotation());
 	}
 
 	void Renderable3D::scale(const float scale)
@@ -51,6 +62,13 @@ namespace gg
 	void Renderable3D::setRotation(const vector3& rot)
 	{
 		m_rotation = rot;
+		m_usesQuaternion = false;
+	}
+
+	void Renderable3D::setRotation(const quaternion& rot)
+	{
+		m_quaternionRotation = normal(rot); //keeps rotation unit after many relative rotations
+		m_usesQuaternion = true;
 	}
 
 	void Renderable3D::setScale(const float scale)
@@ -73,4 +91,22 @@ namespace gg
 		return vector2((float)column / (float)m_model->getTextureRows(), (float)row / (float)m_model->getTextureRows());
 	}
 
+	matrix4 Renderable3D::getModelMatrix() const
+	{
+		if (m_usesQuaternion)
+			return transform(m_position, m_quaternionRotation, m_scale).toMatrix();
+
+
+		return matrix4::model(m_position, m_rotation.x, m_rotation.y, m_rotation.z, m_scale);
+	}
+
+	quaternion Renderable3D::getQuaternionRotation() const
+	{
+		if (m_usesQuaternion)
+			return m_quaternionRotation;
+
+
+		return quaternion::euler(m_rotation.x, m_rotation.y, m_rotation.z);
+	}
+
 }
\ No newline at end of file
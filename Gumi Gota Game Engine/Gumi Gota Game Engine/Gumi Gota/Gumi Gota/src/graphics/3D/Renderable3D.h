@@ -8,6 +8,8 @@
 #include "Model.h"
 
 #include "../../maths/vectors/vector3.h"
+#include "../../maths/matrices/matrix4.h"
+#include "../../maths/quaternions/quaternion.h"
 
 
 
@@ -20,6 +22,8 @@ namespace gg
 		/* Variables */
 		vector3 m_position;
 		vector3 m_rotation; //stored in radians
+		quaternion m_quaternionRotation; //used instead of m_rotation when m_usesQuaternion is true
+		bool m_usesQuaternion;
 		float m_scale;
 
 		Model* m_model;
@@ -34,11 +38,13 @@ namespace gg
 		/* Functions */
 		// Setters
 		void move(const vector3& movement); //moves entity relatively to its current position
-		void rotate(const vector3& rot); //rotates entity relatively to its current rotation
+		void rotate(const vector3& rot); //rotates entity relatively to its current rotation; with quaternion rotation, rot is turned into quaternion and applied after current rotation
+		void rotate(const quaternion& rot); //applies rot after current rotation; switches entity to quaternion rotation
 		void scale(const float scale); //scales entity relatively to its current scale
 
 		void setPosition(const vector3& pos); //moves entity ignoring its current position
-		void setRotation(const vector3& rot); //rotates entity ignoring its current rotation
+		void setRotation(const vector3& rot); //rotates entity ignoring its current rotation; switches entity back to euler angles
+		void setRotation(const quaternion& rot); //rotates entity ignoring its current rotation; switches entity to quaternion rotation
 		void setScale(const float scale); //scales entity ignoring its current scale
 
 		void setTextureAtlasIndex(const unsigned int index);
@@ -46,10 +52,15 @@ namespace gg
 		// Getters
 		vector2 getTextureOffset();
 
+		matrix4 getModelMatrix() const;
+		quaternion getQuaternionRotation() const; //converts euler angles if entity doesn't use quaternion rotation
+
 		inline const vector3& getPosition() const { return m_position; }
-		inline const vector3& getRotation() const { return m_rotation; }
+		inline const vector3& getRotation() const { return m_rotation; } //euler angles; not updated while entity uses quaternion rotation
 		inline       float    getScale()    const { return m_scale;    }
 
+		inline bool usesQuaternionRotation() const { return m_usesQuaternion; }
+
 		inline Model* getModel() const { return m_model; }
 
 		inline unsigned int getTextureAtlasIndex() const { return m_textureAtlasIndex; }
@@ -7,11 +7,15 @@
 #include <GL/glew.h>
 
 // Normal Includes
-#include <sstream>
 #include <iostream>
+#include <algorithm>
 
 // Header Includes
+#include "../../Log.h"
 #include "../ErrorHandling.h"
+#include "../GLStateCache.h"
+
+#include "../../maths/geometry/BatchTransformations.h"
 
 
 
@@ -34,6 +38,16 @@
 #define RENDERER3D_WATER_REFRACTION_WIDTH  1280
 #define RENDERER3D_WATER_REFRACTION_HEIGHT 720
 
+#define RENDERER3D_GEOMETRY_POOL_MAX_VERTICES  262144
+#define RENDERER3D_GEOMETRY_POOL_MAX_INDICES   1048576
+#define RENDERER3D_GEOMETRY_POOL_MAX_INSTANCES 16384
+#define RENDERER3D_MIN_PARALLEL_TRANSFORMS     8192 //less model matrices are built on calling thread
+
+#define RENDERER3D_FEATURE_FAKE_LIGHTING (1 << 0)
+#define RENDERER3D_FEATURE_FOG			 (1 << 1)
+#define RENDERER3D_FEATURE_CLIPPING		 (1 << 2)
+#define RENDERER3D_FEATURE_INSTANCING	 (1 << 3)
+
 
 
 namespace gg
@@ -54,30 +68,110 @@ namespace gg
 		 1.0f, 0.0f, -1.0f
 	};
 
+	const static std::vector<std::string> s_gpuParticleFeedbackVaryings = { "out_position", "out_velocity", "out_data", "out_scale" }; //same layout as GPUParticleGroup buffers
+
+	const static std::vector<std::string> s_basicLightFeatureDefines = { "FAKE_LIGHTING", "FOG", "CLIPPING", "INSTANCING" }; //same order as RENDERER3D_FEATURE bits
+
+
+
+	/* ADDITIONAL FUNCTIONS */
+	static unsigned int s_getLightCountVariant(const unsigned int lightCount)
+	{
+		// Rounding Up to Few Counts (so light count changes don't compile a variant for every number)
+		if (lightCount == 0)
+			return 0;
+		else if (lightCount <= 4)
+			return 4;
+		else if (lightCount <= 8)
+			return 8;
+
+		return RENDERER3D_MAX_RENDERED_LIGHTS;
+	}
+
+	static vector3 s_getCameraPosition(const matrix4& view)
+	{
+		// Inverting Rigid View Matrix (position = -transpose(rotation) * translation)
+		vector3 position;
+		position.x = -(view.elements[0 + 0 * 4] * view.elements[0 + 3 * 4] + view.elements[1 + 0 * 4] * view.elements[1 + 3 * 4] + view.elements[2 + 0 * 4] * view.elements[2 + 3 * 4]);
+		position.y = -(view.elements[0 + 1 * 4] * view.elements[0 + 3 * 4] + view.elements[1 + 1 * 4] * view.elements[1 + 3 * 4] + view.elements[2 + 1 * 4] * view.elements[2 + 3 * 4]);
+		position.z = -(view.elements[0 + 2 * 4] * view.elements[0 + 3 * 4] + view.elements[1 + 2 * 4] * view.elements[1 + 3 * 4] + view.elements[2 + 2 * 4] * view.elements[2 + 3 * 4]);
+
+		return position;
+	}
+
 
 
 	/* Constructors */
 	Renderer3D::Renderer3D()
-		: m_basicLightShader("Gumi Gota/Gumi Gota/res/shaders/BasicLight3D.shader"),
+		: m_basicLightShaders("Gumi Gota/Gumi Gota/res/shaders/BasicLight3D.shader", s_basicLightFeatureDefines, "LIGHT_COUNT"),
 		  m_skyboxShader("Gumi Gota/Gumi Gota/res/shaders/Skybox3D.shader"),
 		  m_normalParticleShader("Gumi Gota/Gumi Gota/res/shaders/NormalParticle3D.shader"),
 		  m_instanceParticleShader("Gumi Gota/Gumi Gota/res/shaders/InstanceParticle3D.shader"),
+		  m_gpuParticleUpdateShader("Gumi Gota/Gumi Gota/res/shaders/GPUParticleUpdate3D.shader", s_gpuParticleFeedbackVaryings),
+		  m_gpuParticleShader("Gumi Gota/Gumi Gota/res/shaders/GPUParticle3D.shader"),
 		  m_waterLightShader("Gumi Gota/Gumi Gota/res/shaders/WaterLight3D.shader"),
 		  m_zNear(RENDERER3D_DEFAULT_ZNEAR), m_zFar(RENDERER3D_DEFAULT_ZFAR),
+		  m_fogDensity(RENDERER3D_DEFAULT_FOG_DENSITY), m_clippingEnabled(false), m_loadedLightCount(0),
 		  m_lightUpdateInterval(RENDERER3D_LIGHT_UPDATE_INTERVAL),
 		  m_normalParticleVAO(), m_instanceParticleVAO(),
-		  m_waterDuDvMap("Gumi Gota/Gumi Gota/res/maps/WaterDuDvMap.png"), m_waterNormalMap("Gumi Gota/Gumi Gota/res/maps/WaterNormalMap.png")
+		  m_waterDuDvMap("Gumi Gota/Gumi Gota/res/maps/WaterDuDvMap.png"), m_waterNormalMap("Gumi Gota/Gumi Gota/res/maps/WaterNormalMap.png"),
+		  m_geometryPool(RENDERER3D_GEOMETRY_POOL_MAX_VERTICES, RENDERER3D_GEOMETRY_POOL_MAX_INDICES, RENDERER3D_GEOMETRY_POOL_MAX_INSTANCES)
 	{
 		// Init
 		m_initParticleVAOs();
 		m_initWaterStuff();
 
+		// Uniform Handles
+		m_projectionMatrixHandle = Shader::getUniformHandle("u_projectionMatrix");
+		m_viewMatrixHandle = Shader::getUniformHandle("u_viewMatrix");
+		m_cameraPositionHandle = Shader::getUniformHandle("u_cameraPosition");
+		m_clippingPlaneHandle = Shader::getUniformHandle("u_clippingPlane");
+		m_modelMatrixHandle = Shader::getUniformHandle("u_modelMatrix");
+		m_modelViewMatrixHandle = Shader::getUniformHandle("u_modelViewMatrix");
+		m_textureCoordinatesOffsetHandle = Shader::getUniformHandle("u_textureCoordinatesOffset");
+		m_textureOffsetHandle = Shader::getUniformHandle("u_textureOffset");
+		m_textureRowsHandle = Shader::getUniformHandle("u_textureRows");
+		m_textureAtlasRowsHandle = Shader::getUniformHandle("u_textureAtlasRows");
+		m_shineDamperHandle = Shader::getUniformHandle("u_shineDamper");
+		m_reflectivityHandle = Shader::getUniformHandle("u_reflectivity");
+		m_movementFactorHandle = Shader::getUniformHandle("u_movementFactor");
+		m_tilingFactorHandle = Shader::getUniformHandle("u_tilingFactor");
+		m_waveStrengthHandle = Shader::getUniformHandle("u_waveStrength");
+
+		m_deltaTimeHandle = Shader::getUniformHandle("u_deltaTime");
+		m_randomSeedHandle = Shader::getUniformHandle("u_randomSeed");
+		m_loopingHandle = Shader::getUniformHandle("u_looping");
+		m_emitterTypeHandle = Shader::getUniformHandle("u_emitterType");
+		m_emitterPositionHandle = Shader::getUniformHandle("u_emitterPosition");
+		m_positionErrorHandle = Shader::getUniformHandle("u_positionError");
+		m_directionHandle = Shader::getUniformHandle("u_direction");
+		m_directionErrorHandle = Shader::getUniformHandle("u_directionError");
+		m_speedHandle = Shader::getUniformHandle("u_speed");
+		m_speedErrorHandle = Shader::getUniformHandle("u_speedError");
+		m_lifetimeHandle = Shader::getUniformHandle("u_lifetime");
+		m_lifetimeErrorHandle = Shader::getUniformHandle("u_lifetimeError");
+		m_gravityHandle = Shader::getUniformHandle("u_gravity");
+		m_gravityErrorHandle = Shader::getUniformHandle("u_gravityError");
+		m_rotationHandle = Shader::getUniformHandle("u_rotation");
+		m_rotationErrorHandle = Shader::getUniformHandle("u_rotationError");
+		m_scaleHandle = Shader::getUniformHandle("u_scale");
+		m_scaleErrorHandle = Shader::getUniformHandle("u_scaleError");
+
+		m_startingTextureAtlasIndexHandle = Shader::getUniformHandle("u_startingTextureAtlasIndex");
+		m_texturePhaseCountHandle = Shader::getUniformHandle("u_texturePhaseCount");
+
+		m_lightPositionHandles = Shader::getUniformArrayHandles("u_lightPosition", RENDERER3D_MAX_RENDERED_LIGHTS);
+		m_lightColorHandles = Shader::getUniformArrayHandles("u_lightColor", RENDERER3D_MAX_RENDERED_LIGHTS);
+		m_lightAttenuationHandles = Shader::getUniformArrayHandles("u_lightAttenuation", RENDERER3D_MAX_RENDERED_LIGHTS);
+
+		Renderer3DLightSlot emptySlot = { nullptr, 0, false };
+		m_lightSlots.resize(RENDERER3D_MAX_RENDERED_LIGHTS, emptySlot);
+
 		// Shader Setup
-		m_basicLightShader.start();
-		m_basicLightShader.setUniform1i("u_textureSampler", 0);
-		m_basicLightShader.setUniform1f("u_fogDensity", RENDERER3D_DEFAULT_FOG_DENSITY);
-		m_basicLightShader.setUniform1f("u_fogGradient", RENDERER3D_DEFAULT_FOG_GRADIENT);
-		m_basicLightShader.setUniform3f("u_skyColor", RENDERER3D_DEFAULT_SKY_COLOR);
+		m_basicLightShaders.setUniform1i(Shader::getUniformHandle("u_textureSampler"), 0);
+		m_basicLightShaders.setUniform1f(Shader::getUniformHandle("u_fogDensity"), RENDERER3D_DEFAULT_FOG_DENSITY);
+		m_basicLightShaders.setUniform1f(Shader::getUniformHandle("u_fogGradient"), RENDERER3D_DEFAULT_FOG_GRADIENT);
+		m_basicLightShaders.setUniform3f(Shader::getUniformHandle("u_skyColor"), vector3(RENDERER3D_DEFAULT_SKY_COLOR));
 
 		m_normalParticleShader.start();
 		m_normalParticleShader.setUniform1i("u_textureSampler", 0);
@@ -85,6 +179,9 @@ namespace gg
 		m_instanceParticleShader.start();
 		m_instanceParticleShader.setUniform1i("u_textureSampler", 0);
 
+		m_gpuParticleShader.start();
+		m_gpuParticleShader.setUniform1i("u_textureSampler", 0);
+
 		m_waterLightShader.start();
 		m_waterLightShader.setUniform1i("u_reflectionTexture", 0);
 		m_waterLightShader.setUniform1i("u_refractionTexture", 1);
@@ -105,6 +202,13 @@ namespace gg
 		matrix4 projectionMatrix = matrix4::projection(cam.getAspectRatio(), cam.getFOV(), m_zNear, m_zFar);
 		matrix4 viewMatrix = matrix4::fpsView(cam.getPosition(), cam.getPitch(), cam.getYaw());
 
+		// Building Pooled Draw Commands
+		m_buildGeometryPoolCommands(); //done once per frame, water passes reuse the same commands
+
+		// Simulating GPU Particles
+		if (m_gpuParticleGroups.size() > 0)
+			m_simulateGPUParticles(); //done once per frame, water passes draw the same particles
+
 		// Rendering Skybox
 		if (m_skybox != nullptr)
 			m_renderSkybox(cam, projectionMatrix);
@@ -117,9 +221,12 @@ namespace gg
 			m_renderWater(cam, projectionMatrix, viewMatrix);
 
 		// Rendering Particles
-		if (m_particleGroups.size() > 0)
+		if (m_hasParticles())
 			m_renderParticles(projectionMatrix, viewMatrix);
 
+		if (m_gpuParticleGroups.size() > 0)
+			m_renderGPUParticles(projectionMatrix, viewMatrix);
+
 	}
 
 
@@ -131,35 +238,59 @@ namespace gg
 			m_lightTimer.reset(); // Resetting Timer
 
 			// Init
-			unsigned int loadedLights = 0;
-
-			// Getting Closest Lights Indices
-			std::vector<unsigned int> closestLightsIndices = getClosestLightsIndices(pos, m_lights, RENDERER3D_MAX_RENDERED_LIGHTS);
+			m_assignedLights.clear();
 
 			// Important Lights
-			for (unsigned int i = 0; i < closestLightsIndices.size() && loadedLights < RENDERER3D_MAX_RENDERED_LIGHTS; i++)
+			for (unsigned int i = 0; i < m_isImportantLight.size() && m_assignedLights.size() < RENDERER3D_MAX_RENDERED_LIGHTS; i++)
 			{
-				if (m_isImportantLight[ closestLightsIndices[ i ] ])
-				{
-					m_updateLightUniforms(m_lights[ closestLightsIndices[ i ] ], loadedLights);
-
-					loadedLights++; // Updating Loaded Lights Amount
-				}
+				if (m_isImportantLight[ i ])
+					m_assignedLights.push_back(m_lights[ i ]);
 			}
 
 			// Closest Lights
-			for (unsigned int i = 0; i < closestLightsIndices.size() && loadedLights < RENDERER3D_MAX_RENDERED_LIGHTS; i++)
+			m_lightGrid.getClosest(pos, RENDERER3D_MAX_RENDERED_LIGHTS, m_closestLightsIndices);
+
+			for (unsigned int i = 0; i < m_closestLightsIndices.size() && m_assignedLights.size() < RENDERER3D_MAX_RENDERED_LIGHTS; i++)
 			{
-				if (!m_isImportantLight[ closestLightsIndices[ i ] ])
-				{
-					m_updateLightUniforms(m_lights[ closestLightsIndices[ i ] ], loadedLights);
+				if (!m_isImportantLight[ m_closestLightsIndices[ i ] ])
+					m_assignedLights.push_back(m_lights[ m_closestLightsIndices[ i ] ]);
+			}
 
-					loadedLights++; // Updating Loaded Lights Amount
-				}
+			// Uploading Slots with Changed Light
+			unsigned int loadedLights = m_assignedLights.size();
+
+			for (unsigned int i = 0; i < loadedLights; i++)
+			{
+				const Light3D* light = m_assignedLights[i];
+				Renderer3DLightSlot& slot = m_lightSlots[i];
+
+				if (slot.isUploaded && slot.light == light && slot.version == light->getVersion())
+					continue;
+
+				m_updateLightUniforms(light, i);
 
+				slot.light = light;
+				slot.version = light->getVersion();
+				slot.isUploaded = true;
 			}
 
-			m_basicLightShader.stop();
+			// Clearing Unused Slots
+			for (unsigned int i = loadedLights; i < RENDERER3D_MAX_RENDERED_LIGHTS; i++)
+			{
+				Renderer3DLightSlot& slot = m_lightSlots[i];
+
+				if (slot.isUploaded && slot.light == nullptr)
+					continue;
+
+				m_clearLightUniforms(i);
+
+				slot.light = nullptr;
+				slot.isUploaded = true;
+			}
+
+			m_loadedLightCount = loadedLights;
+
+			Shader::stop();
 		}
 	}
 
@@ -200,23 +331,19 @@ namespace gg
 
 	void Renderer3D::setFogDensity(const float value)
 	{
-		m_basicLightShader.start();
-		m_basicLightShader.setUniform1f("u_fogDensity", value);
-		m_basicLightShader.stop();
+		m_fogDensity = value;
+
+		m_basicLightShaders.setUniform1f(Shader::getUniformHandle("u_fogDensity"), value);
 	}
 
 	void Renderer3D::setFogGradient(const float value)
 	{
-		m_basicLightShader.start();
-		m_basicLightShader.setUniform1f("u_fogGradient", value);
-		m_basicLightShader.stop();
+		m_basicLightShaders.setUniform1f(Shader::getUniformHandle("u_fogGradient"), value);
 	}
 
 	void Renderer3D::setSkyColor(const Color& color, const Window& window)
 	{
-		m_basicLightShader.start();
-		m_basicLightShader.setUniform3f("u_skyColor", color.r, color.g, color.b);
-		m_basicLightShader.stop();
+		m_basicLightShaders.setUniform3f(Shader::getUniformHandle("u_skyColor"), color);
 
 		window.setClearColor(color);
 	}
@@ -240,6 +367,8 @@ namespace gg
 		m_instanceParticleVAO.addInstancedAttribute(m_instanceVBO, 3, 4, RENDERER3D_PARTICLE_INSTANCE_DATA_LENGTH, 8);
 		m_instanceParticleVAO.addInstancedAttribute(m_instanceVBO, 4, 4, RENDERER3D_PARTICLE_INSTANCE_DATA_LENGTH, 12);
 		m_instanceParticleVAO.addInstancedAttribute(m_instanceVBO, 5, 2, RENDERER3D_PARTICLE_INSTANCE_DATA_LENGTH, 16);
+
+		m_particleInstanceData.reserve(RENDERER3D_MAX_PARTICLE_INSTANCES * RENDERER3D_PARTICLE_INSTANCE_DATA_LENGTH); //never grows after this
 	}
 
 	void Renderer3D::m_initWaterStuff()
@@ -260,68 +389,292 @@ namespace gg
 	}
 
 
+	void Renderer3D::m_buildGeometryPoolCommands()
+	{
+		// Init
+		m_geometryPoolCommands.clear();
+		m_geometryPoolCommandModels.clear();
+		m_geometryPoolInstanceData.clear();
+		m_geometryPoolInstances.clear();
+
+		unsigned int instanceCount = 0;
+
+		// Finding Pooled Models
+		std::vector<unsigned int> pooledModelsIndices;
+		for (unsigned int i = 0; i < m_renderables.size(); i++)
+		{
+			if (m_renderables[i][0]->getModel()->getGeometryPool() == &m_geometryPool)
+				pooledModelsIndices.push_back(i);
+		}
+
+		if (pooledModelsIndices.size() == 0)
+			return;
+
+		// Sorting Models by Render State
+		std::sort(pooledModelsIndices.begin(), pooledModelsIndices.end(), [this](const unsigned int a, const unsigned int b)
+		{
+			Model* modelA = m_renderables[a][0]->getModel();
+			Model* modelB = m_renderables[b][0]->getModel();
+
+			if (modelA->hasTransparency() != modelB->hasTransparency())
+				return modelA->hasTransparency() < modelB->hasTransparency();
+
+			return modelA->getTextureID() < modelB->getTextureID();
+		}); //models sharing texture and culling state end up next to each other, so they can be drawn with one call
+
+		// Creating Commands and Instance Data
+		for (unsigned int modelIndex : pooledModelsIndices)
+		{
+			const std::vector<Renderable3D*>& modelVector = m_renderables[modelIndex];
+			Model* model = modelVector[0]->getModel();
+
+			// Checking Instance Limit
+			unsigned int modelInstances = modelVector.size();
+			if (instanceCount + modelInstances > m_geometryPool.getMaxInstances())
+				modelInstances = m_geometryPool.getMaxInstances() - instanceCount;
+
+			if (modelInstances == 0)
+			{
+				LOG("[Warning] Geometry pool instance limit reached, some renderables won't be rendered");
+				break;
+			}
+
+			// Command
+			DrawElementsIndirectCommand command;
+			command.count = model->getVertexCount();
+			command.instanceCount = modelInstances;
+			command.firstIndex = model->getGeometryRange().firstIndex;
+			command.baseVertex = model->getGeometryRange().baseVertex;
+			command.baseInstance = instanceCount;
+
+			m_geometryPoolCommands.push_back(command);
+			m_geometryPoolCommandModels.push_back(model);
+
+			m_geometryPoolInstances.insert(m_geometryPoolInstances.end(), modelVector.begin(), modelVector.begin() + modelInstances);
+
+			instanceCount += modelInstances;
+		}
+
+		// Building Model Matrices
+		m_buildGeometryPoolModelMatrices();
+
+		// Instance Data
+		for (unsigned int i = 0; i < instanceCount; i++)
+		{
+			Renderable3D* renderable = m_geometryPoolInstances[i];
+			Model* model = renderable->getModel();
+
+			vector2 textureOffset = renderable->getTextureOffset();
+
+			m_geometryPoolInstanceData.insert(m_geometryPoolInstanceData.end(), m_geometryPoolModelMatrices[i].elements, m_geometryPoolModelMatrices[i].elements + 16);
+
+			m_geometryPoolInstanceData.push_back(textureOffset.x);
+			m_geometryPoolInstanceData.push_back(textureOffset.y);
+			m_geometryPoolInstanceData.push_back((float)model->getTextureRows());
+			m_geometryPoolInstanceData.push_back(model->hasFakeLighting() ? 1.0f : 0.0f);
+
+			m_geometryPoolInstanceData.push_back(model->getShineDamper());
+			m_geometryPoolInstanceData.push_back(model->getReflectivity());
+		}
+
+		// Updating Buffers
+		m_geometryPool.bufferInstanceData(m_geometryPoolInstanceData.data(), instanceCount);
+		m_geometryPool.bufferCommands(m_geometryPoolCommands);
+	}
+
+
+	void Renderer3D::m_buildGeometryPoolModelMatrices()
+	{
+		// Init
+		unsigned int count = m_geometryPoolInstances.size();
+
+		bool quaternions = std::any_of(m_geometryPoolInstances.begin(), m_geometryPoolInstances.end(), [](const Renderable3D* renderable) { return renderable->usesQuaternionRotation(); });
+
+		m_geometryPoolTransforms.resize(count * (quaternions ? 8 : 7));
+		m_geometryPoolModelMatrices.resize(count);
+
+		float* positionX = m_geometryPoolTransforms.data() + count * 0;
+		float* positionY = m_geometryPoolTransforms.data() + count * 1;
+		float* positionZ = m_geometryPoolTransforms.data() + count * 2;
+		float* rotationX = m_geometryPoolTransforms.data() + count * 3;
+		float* rotationY = m_geometryPoolTransforms.data() + count * 4;
+		float* rotationZ = m_geometryPoolTransforms.data() + count * 5;
+		float* scale = m_geometryPoolTransforms.data() + count * 6;
+		float* rotationW = quaternions ? m_geometryPoolTransforms.data() + count * 7 : nullptr;
+
+		// Gathering Transforms
+		for (unsigned int i = 0; i < count; i++)
+		{
+			const Renderable3D* renderable = m_geometryPoolInstances[i];
+
+			positionX[i] = renderable->getPosition().x;
+			positionY[i] = renderable->getPosition().y;
+			positionZ[i] = renderable->getPosition().z;
+			scale[i] = renderable->getScale();
+
+			if (quaternions)
+			{
+				quaternion rotation = renderable->getQuaternionRotation(); //euler angles of other instances are converted
+
+				rotationX[i] = rotation.x;
+				rotationY[i] = rotation.y;
+				rotationZ[i] = rotation.z;
+				rotationW[i] = rotation.w;
+			}
+			else
+			{
+				rotationX[i] = renderable->getRotation().x;
+				rotationY[i] = renderable->getRotation().y;
+				rotationZ[i] = renderable->getRotation().z;
+			}
+		}
+
+		// Building
+		if (quaternions)
+		{
+			QuaternionTransformArrays transforms = { positionX, positionY, positionZ, rotationX, rotationY, rotationZ, rotationW, scale, nullptr, nullptr };
+
+			if (count >= RENDERER3D_MIN_PARALLEL_TRANSFORMS)
+				modelMatrices(m_geometryPoolModelMatrices.data(), transforms, count, m_threadPool);
+			else
+				modelMatrices(m_geometryPoolModelMatrices.data(), transforms, 0, count);
+		}
+		else
+		{
+			EulerTransformArrays transforms = { positionX, positionY, positionZ, rotationX, rotationY, rotationZ, scale, nullptr, nullptr };
+
+			if (count >= RENDERER3D_MIN_PARALLEL_TRANSFORMS)
+				modelMatrices(m_geometryPoolModelMatrices.data(), transforms, count, m_threadPool);
+			else
+				modelMatrices(m_geometryPoolModelMatrices.data(), transforms, 0, count);
+		}
+	}
+
+
 	void Renderer3D::m_renderRenderables(const matrix4& projection, const matrix4& view)
 	{
 		
 		// OpenGL 3D Stuff Setup
-		GLcall( glEnable(GL_DEPTH_TEST) );
-		GLcall( glDepthFunc(GL_LESS) );
+		GLStateCache::setDepthTest(true);
+		GLStateCache::setDepthFunc(GL_LESS);
 
 		// Main Shader Setup
-		m_basicLightShader.start();
-		m_basicLightShader.setUniformMatrix4f("u_projectionMatrix", projection);
-		m_basicLightShader.setUniformMatrix4f("u_viewMatrix", view);
+		unsigned int passFeatures = m_getBasicLightFeatures();
+
+		Shader* shader = nullptr;
+		unsigned int shaderFeatures = 0;
 		
 		
 		// Rendering Renderables
-		for (std::vector<Renderable3D*> modelVector : m_renderables)
+		for (const std::vector<Renderable3D*>& modelVector : m_renderables)
 		{
+			// Skipping Pooled Models
+			if (modelVector[0]->getModel()->getGeometryPool() == &m_geometryPool)
+				continue; //pooled models are drawn with indirect draw calls below
+
+			// Shader Variant Setup
+			unsigned int modelFeatures = passFeatures | (modelVector[0]->getModel()->hasFakeLighting() ? RENDERER3D_FEATURE_FAKE_LIGHTING : 0);
+
+			if (shader == nullptr || modelFeatures != shaderFeatures)
+			{
+				shader = &m_startBasicLightShader(modelFeatures, projection, view);
+				shaderFeatures = modelFeatures;
+			}
+
 			// Model Setup
 			modelVector[0]->getModel()->bind(); //binding model's vao and ibo
 
-			m_basicLightShader.setUniform1f("u_shineDamper", modelVector[0]->getModel()->getShineDamper());
-			m_basicLightShader.setUniform1f("u_reflectivity", modelVector[0]->getModel()->getReflectivity());
+			shader->setUniform1f(m_shineDamperHandle, modelVector[0]->getModel()->getShineDamper());
+			shader->setUniform1f(m_reflectivityHandle, modelVector[0]->getModel()->getReflectivity());
 
-			m_basicLightShader.setUniform1f("u_hasFakeLighting", modelVector[0]->getModel()->hasFakeLighting());
-
-			m_basicLightShader.setUniform1f("u_textureRows", (float)modelVector[0]->getModel()->getTextureRows());
+			shader->setUniform1f(m_textureRowsHandle, (float)modelVector[0]->getModel()->getTextureRows());
 
 			if (modelVector[0]->getModel()->hasTransparency())
 			{
-				GLcall( glDisable(GL_CULL_FACE) );
+				GLStateCache::setCullFace(false);
 			}
 			else
 			{
-				GLcall( glEnable(GL_CULL_FACE) );
-				GLcall( glCullFace(GL_BACK) );
+				GLStateCache::setCullFace(true);
+				GLStateCache::setCullFaceMode(GL_BACK);
 			}
 			
 			// Rendering Renderables Separately
 			for (Renderable3D* renderable : modelVector)
 			{
-				matrix4 modelMatrix = matrix4::model(renderable->getPosition(), renderable->getRotation().x, renderable->getRotation().y, renderable->getRotation().z, renderable->getScale());
-				m_basicLightShader.setUniformMatrix4f("u_modelMatrix", modelMatrix);
+				shader->setUniformMatrix4f(m_modelMatrixHandle, renderable->getModelMatrix());
 
-				m_basicLightShader.setUniform2f("u_textureCoordinatesOffset", renderable->getTextureOffset());
+				shader->setUniform2f(m_textureCoordinatesOffsetHandle, renderable->getTextureOffset());
 
 				// Rendering
 				GLcall( glDrawElements(GL_TRIANGLES, renderable->getModel()->getVertexCount(), GL_UNSIGNED_INT, nullptr) );
 			}
 		}
+
+		// Rendering Pooled Renderables
+		if (m_geometryPoolCommands.size() > 0)
+			m_renderGeometryPool(projection, view);
 		
 
 		// Finishing
-		GLcall( glDisable(GL_DEPTH_TEST) );
+		GLStateCache::setDepthTest(false);
 
 		Shader::stop();
 		
 	}
 
+	void Renderer3D::m_renderGeometryPool(const matrix4& projection, const matrix4& view)
+	{
+		// Shader Setup
+		m_startBasicLightShader(m_getBasicLightFeatures() | RENDERER3D_FEATURE_INSTANCING, projection, view); //fake lighting stays per instance data, so pooled models need one variant
+
+		// Binding
+		m_geometryPool.bind();
+
+		// Rendering Commands in Runs Sharing the Same State
+		unsigned int firstCommand = 0;
+		while (firstCommand < m_geometryPoolCommands.size())
+		{
+			Model* model = m_geometryPoolCommandModels[firstCommand];
+
+			// Finding End of Run
+			unsigned int lastCommand = firstCommand + 1;
+			while (lastCommand < m_geometryPoolCommands.size() &&
+				   m_geometryPoolCommandModels[lastCommand]->getTextureID() == model->getTextureID() &&
+				   m_geometryPoolCommandModels[lastCommand]->hasTransparency() == model->hasTransparency())
+			{
+				lastCommand++;
+			}
+
+			// State Setup
+			model->bind(); //binds the pool and model's texture
+
+			if (model->hasTransparency())
+			{
+				GLStateCache::setCullFace(false);
+			}
+			else
+			{
+				GLStateCache::setCullFace(true);
+				GLStateCache::setCullFaceMode(GL_BACK);
+			}
+
+			// Rendering
+			m_geometryPool.drawIndirect(firstCommand, lastCommand - firstCommand);
+
+			firstCommand = lastCommand;
+		}
+
+		// Finishing
+		GeometryPool::unbind();
+		Texture::unbind();
+	}
+
 	void Renderer3D::m_renderSkybox(const Camera3D& cam, const matrix4& projection)
 	{
 		// OpenGL Stuff Setup
-		GLcall( glEnable(GL_DEPTH_TEST) );
-		GLcall( glDepthFunc(GL_LEQUAL) );
+		GLStateCache::setDepthTest(true);
+		GLStateCache::setDepthFunc(GL_LEQUAL);
 
 		// Shader Setup
 		matrix4 viewMatrix = matrix4::fpsView(vector3(0.0f), cam.getPitch(), cam.getYaw());
@@ -337,7 +690,7 @@ namespace gg
 		GLcall( glDrawArrays(GL_TRIANGLES, 0, 36) );
 
 		// Finishing
-		GLcall( glDisable(GL_DEPTH_TEST) );
+		GLStateCache::setDepthTest(false);
 
 		Shader::stop();
 	}
@@ -345,10 +698,10 @@ namespace gg
 	void Renderer3D::m_renderParticles(const matrix4& projection, const matrix4& view)
 	{
 		// OpenGL Stuff Setup
-		GLcall( glEnable(GL_BLEND) );
+		GLStateCache::setBlend(true);
 
-		GLcall( glEnable(GL_DEPTH_TEST) );
-		GLcall( glDepthMask(false) );
+		GLStateCache::setDepthTest(true);
+		GLStateCache::setDepthMask(false);
 
 		// Shader Setup
 		m_normalParticleShader.start();
@@ -357,147 +710,22 @@ namespace gg
 		m_instanceParticleShader.start();
 		m_instanceParticleShader.setUniformMatrix4f("u_projectionMatrix", projection);
 
-		// Checking if There Are Any Particles
-		if (m_particleGroups.size() > 0)
+		// Going through Particle Groups One by One
+		for (const ParticleGroup& pg : m_particleGroups)
+			m_renderParticleGroup(pg, view);
+
+		for (const ParticleGroup& pg : m_pooledParticleGroups) //groups of emitters; free ones are empty
 		{
-			// Going through Particle Groups One by One
-			for (ParticleGroup& pg : m_particleGroups)
-			{
-				if (pg.getParticles().size() < RENDERER3D_MIN_PARTICLES_FOR_INSTANCED_RENDERING) // Normal Particles Rendering
-				{
-					// Blending Setup
-					if (pg.usingAdditiveBlending())
-					{
-						GLcall( glBlendFunc(GL_SRC_ALPHA, GL_ONE) ); // Additive Blending
-					}
-					else
-					{
-						GLcall( glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA) ); // Alpha Blending
-					}
-
-					// Binding
-					m_normalParticleVAO.bind();
-
-					pg.bind();
-
-					m_normalParticleShader.start();
-
-					// Shader Setup
-					m_normalParticleShader.setUniform1f("u_textureAtlasRows", (float)pg.getTextureAtlasRows());
-
-					// Rendering Particles One by One
-					for (const Particle& particle : pg.getParticles())
-					{
-						// Matrices Setup
-						matrix4 modelMatrix = matrix4::translation(particle.getPosition());
-						modelMatrix.elements[0 + 0 * 4] = view.elements[0 + 0 * 4];
-						modelMatrix.elements[0 + 1 * 4] = view.elements[1 + 0 * 4];
-						modelMatrix.elements[0 + 2 * 4] = view.elements[2 + 0 * 4];
-						modelMatrix.elements[1 + 0 * 4] = view.elements[0 + 1 * 4];
-						modelMatrix.elements[1 + 1 * 4] = view.elements[1 + 1 * 4];
-						modelMatrix.elements[1 + 2 * 4] = view.elements[2 + 1 * 4];
-						modelMatrix.elements[2 + 0 * 4] = view.elements[0 + 2 * 4];
-						modelMatrix.elements[2 + 1 * 4] = view.elements[1 + 2 * 4];
-						modelMatrix.elements[2 + 2 * 4] = view.elements[2 + 2 * 4];
-						modelMatrix *= matrix4::rotation(particle.getRotation(), vector3(0.0f, 0.0f, 1.0f));
-						modelMatrix *= matrix4::scale(particle.getScale());
-						matrix4 modelViewMatrix = view * modelMatrix;
-
-						// Uniforms Setup
-						m_normalParticleShader.setUniformMatrix4f("u_modelViewMatrix", modelViewMatrix);
-
-						m_normalParticleShader.setUniform2f("u_textureOffset", pg.getTextureOffsets()[particle.getTextureAtlasIndex()]);
-
-						// Rendering
-						GLcall( glDrawArrays(GL_TRIANGLE_STRIP, 0, 8) );
-					}
-				}
-				else // Instanced Particles Rendering
-				{
-					// Init
-					unsigned int offsetPointer = 0;
-					float* vboData = new float[pg.getParticles().size() * RENDERER3D_PARTICLE_INSTANCE_DATA_LENGTH];
-
-					// Blending Setup
-					if (pg.usingAdditiveBlending())
-					{
-						GLcall( glBlendFunc(GL_SRC_ALPHA, GL_ONE) ); // Additive Blending
-					}
-					else
-					{
-						GLcall( glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA) ); // Alpha Blending
-					}
-
-					// Binding
-					m_instanceParticleVAO.bind();
-
-					pg.bind();
-
-					m_instanceParticleShader.start();
-
-					// Shader Setup
-					m_instanceParticleShader.setUniform1f("u_textureAtlasRows", (float)pg.getTextureAtlasRows());
-
-					// Creating Data for Instance VBO
-					for (const Particle& particle : pg.getParticles())
-					{
-						// Matrices Setup
-						matrix4 modelMatrix = matrix4::translation(particle.getPosition());
-						modelMatrix.elements[0 + 0 * 4] = view.elements[0 + 0 * 4];
-						modelMatrix.elements[0 + 1 * 4] = view.elements[1 + 0 * 4];
-						modelMatrix.elements[0 + 2 * 4] = view.elements[2 + 0 * 4];
-						modelMatrix.elements[1 + 0 * 4] = view.elements[0 + 1 * 4];
-						modelMatrix.elements[1 + 1 * 4] = view.elements[1 + 1 * 4];
-						modelMatrix.elements[1 + 2 * 4] = view.elements[2 + 1 * 4];
-						modelMatrix.elements[2 + 0 * 4] = view.elements[0 + 2 * 4];
-						modelMatrix.elements[2 + 1 * 4] = view.elements[1 + 2 * 4];
-						modelMatrix.elements[2 + 2 * 4] = view.elements[2 + 2 * 4];
-						modelMatrix *= matrix4::rotation(particle.getRotation(), vector3(0.0f, 0.0f, 1.0f));
-						modelMatrix *= matrix4::scale(particle.getScale());
-						matrix4 modelViewMatrix = view * modelMatrix;
-
-						// Loading Data to VBO
-						vboData[offsetPointer++] = modelViewMatrix.elements[0 + 0 * 4];	// 0
-						vboData[offsetPointer++] = modelViewMatrix.elements[1 + 0 * 4]; // 1
-						vboData[offsetPointer++] = modelViewMatrix.elements[2 + 0 * 4];	// 2
-						vboData[offsetPointer++] = modelViewMatrix.elements[3 + 0 * 4];	// 3
-						vboData[offsetPointer++] = modelViewMatrix.elements[0 + 1 * 4];	// 4
-						vboData[offsetPointer++] = modelViewMatrix.elements[1 + 1 * 4];	// 5
-						vboData[offsetPointer++] = modelViewMatrix.elements[2 + 1 * 4];	// 6
-						vboData[offsetPointer++] = modelViewMatrix.elements[3 + 1 * 4];	// 7
-						vboData[offsetPointer++] = modelViewMatrix.elements[0 + 2 * 4];	// 8
-						vboData[offsetPointer++] = modelViewMatrix.elements[1 + 2 * 4];	// 9
-						vboData[offsetPointer++] = modelViewMatrix.elements[2 + 2 * 4];	// 10
-						vboData[offsetPointer++] = modelViewMatrix.elements[3 + 2 * 4];	// 11
-						vboData[offsetPointer++] = modelViewMatrix.elements[0 + 3 * 4];	// 12
-						vboData[offsetPointer++] = modelViewMatrix.elements[1 + 3 * 4];	// 13
-						vboData[offsetPointer++] = modelViewMatrix.elements[2 + 3 * 4];	// 14
-						vboData[offsetPointer++] = modelViewMatrix.elements[3 + 3 * 4];	// 15
-
-						vboData[offsetPointer++] = pg.getTextureOffsets()[particle.getTextureAtlasIndex()].x; // 16
-						vboData[offsetPointer++] = pg.getTextureOffsets()[particle.getTextureAtlasIndex()].y; // 17
-					}
-
-					// Updating Data in VBO
-					m_instanceVBO->bind();
-					m_instanceVBO->bufferData(nullptr, RENDERER3D_MAX_PARTICLE_INSTANCES * RENDERER3D_PARTICLE_INSTANCE_DATA_LENGTH, VERTEX_BUFFER_STREAM_DRAW);
-					m_instanceVBO->bufferSubData(vboData, offsetPointer);
-
-					// Rendering
-					GLcall( glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, pg.getParticles().size()) );
-
-					// Deleting VBO Data
-					delete[] vboData;
-				}
-			}
+			if (pg.getParticleCount() > 0)
+				m_renderParticleGroup(pg, view);
 		}
 		
 		
 		// Finishing
-		GLcall( glDisable(GL_BLEND) );
+		GLStateCache::setBlend(false);
 
-		GLcall( glDisable(GL_DEPTH_TEST) );
-		GLcall( glDepthMask(true) );
+		GLStateCache::setDepthTest(false);
+		GLStateCache::setDepthMask(true);
 
 		VertexBuffer::unbind();
 		VertexArray::unbind();
@@ -506,13 +734,240 @@ namespace gg
 		Shader::stop();
 	}
 
+	void Renderer3D::m_renderParticleGroup(const ParticleGroup& pg, const matrix4& view)
+	{
+		if (pg.getParticleCount() < RENDERER3D_MIN_PARTICLES_FOR_INSTANCED_RENDERING) // Normal Particles Rendering
+		{
+			// Blending Setup
+			if (pg.usingAdditiveBlending())
+			{
+				GLStateCache::setBlendFunc(GL_SRC_ALPHA, GL_ONE); // Additive Blending
+			}
+			else
+			{
+				GLStateCache::setBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); // Alpha Blending
+			}
+
+			// Binding
+			m_normalParticleVAO.bind();
+
+			pg.bind();
+
+			m_normalParticleShader.start();
+
+			// Shader Setup
+			m_normalParticleShader.setUniform1f(m_textureAtlasRowsHandle, (float)pg.getTextureAtlasRows());
+
+			// Rendering Particles One by One
+			for (unsigned int i = 0; i < pg.getParticleCount(); i++)
+			{
+				unsigned int index = pg.getDrawOrder()[i]; //back to front, if group sorts its particles
+
+				// Matrices Setup
+				matrix4 modelMatrix = matrix4::translation(pg.getPosition(index));
+				modelMatrix.elements[0 + 0 * 4] = view.elements[0 + 0 * 4];
+				modelMatrix.elements[0 + 1 * 4] = view.elements[1 + 0 * 4];
+				modelMatrix.elements[0 + 2 * 4] = view.elements[2 + 0 * 4];
+				modelMatrix.elements[1 + 0 * 4] = view.elements[0 + 1 * 4];
+				modelMatrix.elements[1 + 1 * 4] = view.elements[1 + 1 * 4];
+				modelMatrix.elements[1 + 2 * 4] = view.elements[2 + 1 * 4];
+				modelMatrix.elements[2 + 0 * 4] = view.elements[0 + 2 * 4];
+				modelMatrix.elements[2 + 1 * 4] = view.elements[1 + 2 * 4];
+				modelMatrix.elements[2 + 2 * 4] = view.elements[2 + 2 * 4];
+				modelMatrix *= matrix4::rotation(pg.getRotation(index), vector3(0.0f, 0.0f, 1.0f));
+				modelMatrix *= matrix4::scale(pg.getScale(index));
+				matrix4 modelViewMatrix = view * modelMatrix;
+
+				// Uniforms Setup
+				m_normalParticleShader.setUniformMatrix4f(m_modelViewMatrixHandle, modelViewMatrix);
+
+				m_normalParticleShader.setUniform2f(m_textureOffsetHandle, pg.getTextureOffsets()[pg.getTextureAtlasIndex(index)]);
+
+				// Rendering
+				GLcall( glDrawArrays(GL_TRIANGLE_STRIP, 0, 8) );
+			}
+		}
+		else // Instanced Particles Rendering
+		{
+			// Blending Setup
+			if (pg.usingAdditiveBlending())
+			{
+				GLStateCache::setBlendFunc(GL_SRC_ALPHA, GL_ONE); // Additive Blending
+			}
+			else
+			{
+				GLStateCache::setBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); // Alpha Blending
+			}
+
+			// Binding
+			m_instanceParticleVAO.bind();
+
+			pg.bind();
+
+			m_instanceParticleShader.start();
+
+			// Shader Setup
+			m_instanceParticleShader.setUniform1f(m_textureAtlasRowsHandle, (float)pg.getTextureAtlasRows());
+
+			// Rendering in Chunks (instance vbo holds limited amount of instances)
+			for (unsigned int first = 0; first < pg.getParticleCount(); first += RENDERER3D_MAX_PARTICLE_INSTANCES)
+			{
+				unsigned int chunkCount = pg.getParticleCount() - first < RENDERER3D_MAX_PARTICLE_INSTANCES ? pg.getParticleCount() - first : RENDERER3D_MAX_PARTICLE_INSTANCES;
+
+				// Creating Data for Instance VBO
+				m_particleInstanceData.clear();
+
+				for (unsigned int i = first; i < first + chunkCount; i++)
+				{
+					unsigned int index = pg.getDrawOrder()[i]; //back to front, if group sorts its particles
+
+					// Matrices Setup
+					matrix4 modelMatrix = matrix4::translation(pg.getPosition(index));
+					modelMatrix.elements[0 + 0 * 4] = view.elements[0 + 0 * 4];
+					modelMatrix.elements[0 + 1 * 4] = view.elements[1 + 0 * 4];
+					modelMatrix.elements[0 + 2 * 4] = view.elements[2 + 0 * 4];
+					modelMatrix.elements[1 + 0 * 4] = view.elements[0 + 1 * 4];
+					modelMatrix.elements[1 + 1 * 4] = view.elements[1 + 1 * 4];
+					modelMatrix.elements[1 + 2 * 4] = view.elements[2 + 1 * 4];
+					modelMatrix.elements[2 + 0 * 4] = view.elements[0 + 2 * 4];
+					modelMatrix.elements[2 + 1 * 4] = view.elements[1 + 2 * 4];
+					modelMatrix.elements[2 + 2 * 4] = view.elements[2 + 2 * 4];
+					modelMatrix *= matrix4::rotation(pg.getRotation(index), vector3(0.0f, 0.0f, 1.0f));
+					modelMatrix *= matrix4::scale(pg.getScale(index));
+					matrix4 modelViewMatrix = view * modelMatrix;
+
+					// Loading Data to VBO
+					m_particleInstanceData.push_back(modelViewMatrix.elements[0 + 0 * 4]);	// 0
+					m_particleInstanceData.push_back(modelViewMatrix.elements[1 + 0 * 4]);	// 1
+					m_particleInstanceData.push_back(modelViewMatrix.elements[2 + 0 * 4]);	// 2
+					m_particleInstanceData.push_back(modelViewMatrix.elements[3 + 0 * 4]);	// 3
+					m_particleInstanceData.push_back(modelViewMatrix.elements[0 + 1 * 4]);	// 4
+					m_particleInstanceData.push_back(modelViewMatrix.elements[1 + 1 * 4]);	// 5
+					m_particleInstanceData.push_back(modelViewMatrix.elements[2 + 1 * 4]);	// 6
+					m_particleInstanceData.push_back(modelViewMatrix.elements[3 + 1 * 4]);	// 7
+					m_particleInstanceData.push_back(modelViewMatrix.elements[0 + 2 * 4]);	// 8
+					m_particleInstanceData.push_back(modelViewMatrix.elements[1 + 2 * 4]);	// 9
+					m_particleInstanceData.push_back(modelViewMatrix.elements[2 + 2 * 4]);	// 10
+					m_particleInstanceData.push_back(modelViewMatrix.elements[3 + 2 * 4]);	// 11
+					m_particleInstanceData.push_back(modelViewMatrix.elements[0 + 3 * 4]);	// 12
+					m_particleInstanceData.push_back(modelViewMatrix.elements[1 + 3 * 4]);	// 13
+					m_particleInstanceData.push_back(modelViewMatrix.elements[2 + 3 * 4]);	// 14
+					m_particleInstanceData.push_back(modelViewMatrix.elements[3 + 3 * 4]);	// 15
+
+					m_particleInstanceData.push_back(pg.getTextureOffsets()[pg.getTextureAtlasIndex(index)].x);	// 16
+					m_particleInstanceData.push_back(pg.getTextureOffsets()[pg.getTextureAtlasIndex(index)].y);	// 17
+				}
+
+				// Updating Data in VBO
+				m_instanceVBO->bind();
+				m_instanceVBO->bufferData(nullptr, RENDERER3D_MAX_PARTICLE_INSTANCES * RENDERER3D_PARTICLE_INSTANCE_DATA_LENGTH, VERTEX_BUFFER_STREAM_DRAW);
+				m_instanceVBO->bufferSubData(m_particleInstanceData.data(), m_particleInstanceData.size());
+
+				// Rendering (chunks are drawn in draw order, so back to front order is kept)
+				GLcall( glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, chunkCount) );
+			}
+		}
+	}
+
+	void Renderer3D::m_simulateGPUParticles()
+	{
+		// Simulating Particles (they never leave gpu memory)
+		m_gpuParticleUpdateShader.start();
+
+		for (GPUParticleGroup* pg : m_gpuParticleGroups)
+		{
+			if (pg->getTimeToSimulate() <= 0.0f)
+				continue;
+
+			const GPUParticleEmitter& emitter = pg->getEmitter();
+
+			// Shader Setup
+			m_gpuParticleUpdateShader.setUniform1f(m_deltaTimeHandle, pg->getTimeToSimulate());
+			m_gpuParticleUpdateShader.setUniform1i(m_randomSeedHandle, (int)pg->getRandomSeed());
+			m_gpuParticleUpdateShader.setUniform1i(m_loopingHandle, pg->isLooping() ? 1 : 0);
+
+			m_gpuParticleUpdateShader.setUniform1i(m_emitterTypeHandle, (int)emitter.type);
+			m_gpuParticleUpdateShader.setUniform3f(m_emitterPositionHandle, emitter.position);
+			m_gpuParticleUpdateShader.setUniform3f(m_positionErrorHandle, emitter.positionError);
+			m_gpuParticleUpdateShader.setUniform3f(m_directionHandle, emitter.direction);
+			m_gpuParticleUpdateShader.setUniform3f(m_directionErrorHandle, emitter.directionError);
+			m_gpuParticleUpdateShader.setUniform1f(m_speedHandle, emitter.speed);
+			m_gpuParticleUpdateShader.setUniform1f(m_speedErrorHandle, emitter.speedError);
+			m_gpuParticleUpdateShader.setUniform1f(m_lifetimeHandle, emitter.lifetime);
+			m_gpuParticleUpdateShader.setUniform1f(m_lifetimeErrorHandle, emitter.lifetimeError);
+			m_gpuParticleUpdateShader.setUniform1f(m_gravityHandle, emitter.gravity);
+			m_gpuParticleUpdateShader.setUniform1f(m_gravityErrorHandle, emitter.gravityError);
+			m_gpuParticleUpdateShader.setUniform1f(m_rotationHandle, emitter.rotation);
+			m_gpuParticleUpdateShader.setUniform1f(m_rotationErrorHandle, emitter.rotationError);
+			m_gpuParticleUpdateShader.setUniform1f(m_scaleHandle, emitter.scale);
+			m_gpuParticleUpdateShader.setUniform1f(m_scaleErrorHandle, emitter.scaleError);
+
+			// Simulating
+			pg->simulate();
+		}
+
+		// Finishing
+		Shader::stop();
+	}
+
+	void Renderer3D::m_renderGPUParticles(const matrix4& projection, const matrix4& view)
+	{
+		// OpenGL Stuff Setup
+		GLStateCache::setBlend(true);
+
+		GLStateCache::setDepthTest(true);
+		GLStateCache::setDepthMask(false);
+
+		// Shader Setup
+		m_gpuParticleShader.start();
+		m_gpuParticleShader.setUniformMatrix4f(m_projectionMatrixHandle, projection);
+		m_gpuParticleShader.setUniformMatrix4f(m_viewMatrixHandle, view);
+
+		// Rendering Particle Groups
+		for (GPUParticleGroup* pg : m_gpuParticleGroups)
+		{
+			// Blending Setup
+			if (pg->usingAdditiveBlending())
+			{
+				GLStateCache::setBlendFunc(GL_SRC_ALPHA, GL_ONE); // Additive Blending
+			}
+			else
+			{
+				GLStateCache::setBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); // Alpha Blending (particles aren't sorted)
+			}
+
+			// Binding
+			pg->bindForRendering();
+
+			// Shader Setup
+			m_gpuParticleShader.setUniform1f(m_textureAtlasRowsHandle, (float)pg->getTextureAtlasRows());
+			m_gpuParticleShader.setUniform1f(m_startingTextureAtlasIndexHandle, (float)pg->getStartingTextureAtlasIndex());
+			m_gpuParticleShader.setUniform1f(m_texturePhaseCountHandle, (float)pg->getTexturePhaseCount());
+
+			// Rendering (drawn straight from buffer written by simulation)
+			GLcall( glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, pg->getParticleCount()) );
+		}
+
+
+		// Finishing
+		GLStateCache::setBlend(false);
+
+		GLStateCache::setDepthTest(false);
+		GLStateCache::setDepthMask(true);
+
+		GPUParticleGroup::unbind();
+
+		Shader::stop();
+	}
+
 	void Renderer3D::m_renderWater(const Camera3D& cam, const matrix4& projection, const matrix4& view)
 	{
 		// OpenGL Stuff Setup
 		GLcall( glEnable(GL_CLIP_DISTANCE0) );
+		m_clippingEnabled = true;
 
-		GLcall( glEnable(GL_BLEND) );
-		GLcall( glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA) );
+		GLStateCache::setBlend(true);
+		GLStateCache::setBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
 		// Main Shader Setup
 		m_waterLightShader.start();
@@ -527,7 +982,7 @@ namespace gg
 
 		// Getting Default Window Size
 		int defaultViewport[4];
-		GLcall( glGetIntegerv(GL_VIEWPORT, defaultViewport) );
+		GLStateCache::getViewport(defaultViewport); //shadowed, so no synchronous query
 
 		// Rendering Renderables
 		for (WaterTile* tile : m_waterTiles)
@@ -555,7 +1010,8 @@ namespace gg
 			// Rendering
 			m_renderRenderables(reflectionProjectionMatrix, reflectionViewMatrix);
 			if (m_skybox != nullptr) m_renderSkybox(reflectionCamera, reflectionProjectionMatrix);
-			if (m_particleGroups.size() > 0) m_renderParticles(reflectionProjectionMatrix, reflectionViewMatrix);
+			if (m_hasParticles()) m_renderParticles(reflectionProjectionMatrix, reflectionViewMatrix);
+			if (m_gpuParticleGroups.size() > 0) m_renderGPUParticles(reflectionProjectionMatrix, reflectionViewMatrix);
 
 
 			// Refraction FBO
@@ -571,7 +1027,8 @@ namespace gg
 			// Rendering
 			m_renderRenderables(projection, view);
 			if (m_skybox != nullptr) m_renderSkybox(cam, projection);
-			if (m_particleGroups.size() > 0) m_renderParticles(projection, view);
+			if (m_hasParticles()) m_renderParticles(projection, view);
+			if (m_gpuParticleGroups.size() > 0) m_renderGPUParticles(projection, view);
 			
 
 			// FBO Stuff Setup
@@ -582,10 +1039,10 @@ namespace gg
 			FrameBuffer::unbind(defaultViewport[2], defaultViewport[3]);
 			
 			// OpenGL Setup Stuff
-			GLcall( glEnable(GL_DEPTH_TEST) );
-			GLcall( glDepthFunc(GL_LESS) );
+			GLStateCache::setDepthTest(true);
+			GLStateCache::setDepthFunc(GL_LESS);
 
-			GLcall( glDisable(GL_CULL_FACE) );
+			GLStateCache::setCullFace(false);
 			
 			// Binding
 			m_waterVAO.bind();
@@ -594,11 +1051,11 @@ namespace gg
 			m_waterLightShader.start();
 
 			matrix4 modelMatrix = matrix4::model(tile->getPosition(), 0.0f, tile->getRotation(), 0.0f, tile->getScale());
-			m_waterLightShader.setUniformMatrix4f("u_modelMatrix", modelMatrix);
+			m_waterLightShader.setUniformMatrix4f(m_modelMatrixHandle, modelMatrix);
 
-			m_waterLightShader.setUniform1f("u_movementFactor", tile->getMovementFactor());
-			m_waterLightShader.setUniform1f("u_tilingFactor", tile->getTilingFactor());
-			m_waterLightShader.setUniform1f("u_waveStrength", tile->getWaveStrength());
+			m_waterLightShader.setUniform1f(m_movementFactorHandle, tile->getMovementFactor());
+			m_waterLightShader.setUniform1f(m_tilingFactorHandle, tile->getTilingFactor());
+			m_waterLightShader.setUniform1f(m_waveStrengthHandle, tile->getWaveStrength());
 
 			// Rendering
 			GLcall( glDrawArrays(GL_TRIANGLE_STRIP, 0, 4) );
@@ -608,21 +1065,51 @@ namespace gg
 		m_setClippingPlaneUniforms(vector4(0.0f, -1.0f, 0.0f, 10000000000000.0f));
 
 		// Finishing
-		GLcall( glDisable(GL_DEPTH_TEST) );
+		GLStateCache::setDepthTest(false);
 
-		GLcall( glEnable(GL_CULL_FACE) );
-		GLcall( glCullFace(GL_BACK) );
+		GLStateCache::setCullFace(true);
+		GLStateCache::setCullFaceMode(GL_BACK);
 
 		GLcall( glDisable(GL_CLIP_DISTANCE0) );
+		m_clippingEnabled = false;
+
+		GLStateCache::setBlend(false);
+	}
+
+
+	unsigned int Renderer3D::m_getBasicLightFeatures() const
+	{
+		unsigned int features = 0;
+
+		if (m_fogDensity > 0.0f)
+			features |= RENDERER3D_FEATURE_FOG;
+
+		if (m_clippingEnabled)
+			features |= RENDERER3D_FEATURE_CLIPPING;
+
+		return features;
+	}
+
+	Shader& Renderer3D::m_startBasicLightShader(const unsigned int features, const matrix4& projection, const matrix4& view)
+	{
+		// Getting Variant
+		Shader& shader = m_basicLightShaders.get(features, s_getLightCountVariant(m_loadedLightCount));
+
+		// Per Pass Uniforms
+		shader.start();
+		shader.setUniformMatrix4f(m_projectionMatrixHandle, projection);
+		shader.setUniformMatrix4f(m_viewMatrixHandle, view);
 
-		GLcall( glDisable(GL_BLEND) );
+		shader.setUniform3f(m_cameraPositionHandle, s_getCameraPosition(view)); //replaces inverse(u_viewMatrix) that was calculated per vertex
+
+
+		return shader;
 	}
 
 
 	void Renderer3D::m_setClippingPlaneUniforms(const vector4& plane)
 	{
-		m_basicLightShader.start();
-		m_basicLightShader.setUniform4f("u_clippingPlane", plane);
+		m_basicLightShaders.setUniform4f(m_clippingPlaneHandle, plane);
 
 		m_skyboxShader.start();
 		m_skyboxShader.setUniform4f("u_clippingPlane", plane);
@@ -632,25 +1119,35 @@ namespace gg
 
 		m_instanceParticleShader.start();
 		m_instanceParticleShader.setUniform4f("u_clippingPlane", plane);
+
+		m_gpuParticleShader.start();
+		m_gpuParticleShader.setUniform4f("u_clippingPlane", plane);
 	}
 
-	void Renderer3D::m_updateLightUniforms(Light3D* light, const unsigned int index)
+	void Renderer3D::m_updateLightUniforms(const Light3D* light, const unsigned int index)
 	{
-		// Preparing String
-		std::stringstream ss;
-		ss << index;
-		std::string indexString = ss.str();
-
 		// Uniforms Setting
-		m_basicLightShader.start();
-		m_basicLightShader.setUniform3f("u_lightPosition[" + indexString + "]", light->getPosition());
-		m_basicLightShader.setUniform3f("u_lightColor[" + indexString + "]", light->getColor());
-		m_basicLightShader.setUniform3f("u_lightAttenuation[" + indexString + "]", light->getAttenuation());
+		m_basicLightShaders.setUniform3f(m_lightPositionHandles[index], light->getPosition());
+		m_basicLightShaders.setUniform3f(m_lightColorHandles[index], light->getColor());
+		m_basicLightShaders.setUniform3f(m_lightAttenuationHandles[index], light->getAttenuation());
+
+		m_waterLightShader.start();
+		m_waterLightShader.setUniform3f(m_lightPositionHandles[index], light->getPosition());
+		m_waterLightShader.setUniform3f(m_lightColorHandles[index], light->getColor());
+		m_waterLightShader.setUniform3f(m_lightAttenuationHandles[index], light->getAttenuation());
+
+		Shader::stop();
+	}
+
+	void Renderer3D::m_clearLightUniforms(const unsigned int index)
+	{
+		// Uniforms Setting (black light with non-zero attenuation factor)
+		m_basicLightShaders.setUniform3f(m_lightColorHandles[index], vector3(0.0f));
+		m_basicLightShaders.setUniform3f(m_lightAttenuationHandles[index], vector3(1.0f, 0.0f, 0.0f));
 
 		m_waterLightShader.start();
-		m_waterLightShader.setUniform3f("u_lightPosition[" + indexString + "]", light->getPosition());
-		m_waterLightShader.setUniform3f("u_lightColor[" + indexString + "]", light->getColor());
-		m_waterLightShader.setUniform3f("u_lightAttenuation[" + indexString + "]", light->getAttenuation());
+		m_waterLightShader.setUniform3f(m_lightColorHandles[index], vector3(0.0f));
+		m_waterLightShader.setUniform3f(m_lightAttenuationHandles[index], vector3(1.0f, 0.0f, 0.0f));
 
 		Shader::stop();
 	}
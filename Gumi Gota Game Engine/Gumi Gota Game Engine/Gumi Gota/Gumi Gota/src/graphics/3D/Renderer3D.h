@@ -10,29 +10,93 @@
 #include "Camera3D.h"
 
 #include "../Shader.h"
+#include "../ShaderVariants.h"
 #include "../Color.h"
 #include "../Window.h"
 
 #include "../../utils/Timer.h"
 
 #include "../buffers/FrameBuffer.h"
+#include "../buffers/GeometryPool.h"
 
 
 
 namespace gg
 {
 
+	/* ADDITIONAL STUFF */
+	struct Renderer3DLightSlot //light whose uniforms are loaded at slot of light arrays
+	{
+		const Light3D* light; //nullptr if slot is cleared
+		unsigned int version; //version of light when it was uploaded
+		bool isUploaded;
+	};
+
+
+
 	class Renderer3D : public Scene3D
 	{
 	protected:
 		/* Variables */
-		Shader m_basicLightShader;
+		ShaderVariants m_basicLightShaders; //compiled per used combination of features and light count
 		Shader m_skyboxShader;
 		Shader m_normalParticleShader;
 		Shader m_instanceParticleShader;
+		Shader m_gpuParticleUpdateShader; //transform feedback only, nothing is rasterized
+		Shader m_gpuParticleShader;
 		Shader m_waterLightShader;
 
+		// Uniform Handles
+		unsigned int m_projectionMatrixHandle;
+		unsigned int m_viewMatrixHandle;
+		unsigned int m_cameraPositionHandle;
+		unsigned int m_clippingPlaneHandle;
+		unsigned int m_modelMatrixHandle;
+		unsigned int m_modelViewMatrixHandle;
+		unsigned int m_textureCoordinatesOffsetHandle;
+		unsigned int m_textureOffsetHandle;
+		unsigned int m_textureRowsHandle;
+		unsigned int m_textureAtlasRowsHandle;
+		unsigned int m_shineDamperHandle;
+		unsigned int m_reflectivityHandle;
+		unsigned int m_movementFactorHandle;
+		unsigned int m_tilingFactorHandle;
+		unsigned int m_waveStrengthHandle;
+
+		unsigned int m_deltaTimeHandle; //gpu particle simulation
+		unsigned int m_randomSeedHandle;
+		unsigned int m_loopingHandle;
+		unsigned int m_emitterTypeHandle;
+		unsigned int m_emitterPositionHandle;
+		unsigned int m_positionErrorHandle;
+		unsigned int m_directionHandle;
+		unsigned int m_directionErrorHandle;
+		unsigned int m_speedHandle;
+		unsigned int m_speedErrorHandle;
+		unsigned int m_lifetimeHandle;
+		unsigned int m_lifetimeErrorHandle;
+		unsigned int m_gravityHandle;
+		unsigned int m_gravityErrorHandle;
+		unsigned int m_rotationHandle;
+		unsigned int m_rotationErrorHandle;
+		unsigned int m_scaleHandle;
+		unsigned int m_scaleErrorHandle;
+
+		unsigned int m_startingTextureAtlasIndexHandle; //gpu particle rendering
+		unsigned int m_texturePhaseCountHandle;
+
+		std::vector<unsigned int> m_lightPositionHandles;
+		std::vector<unsigned int> m_lightColorHandles;
+		std::vector<unsigned int> m_lightAttenuationHandles;
+
 		float m_zNear, m_zFar;
+
+		float m_fogDensity; //fog variants are used only when density is above 0
+		bool m_clippingEnabled; //true while rendering water reflection and refraction
+		unsigned int m_loadedLightCount;
+		std::vector<Renderer3DLightSlot> m_lightSlots; //only slots with changed light get uploaded again
+		std::vector<const Light3D*> m_assignedLights;
+		std::vector<unsigned int> m_closestLightsIndices;
 		
 		Timer m_lightTimer; //used for updating rendered lights (finding closest lights to the camera)
 		float m_lightUpdateInterval; //used for storing time used for updating rendered lights (finding closest lights to the camera)
@@ -40,6 +104,7 @@ namespace gg
 		VertexArray m_normalParticleVAO;
 		VertexArray m_instanceParticleVAO;
 		VertexBuffer* m_instanceVBO;
+		std::vector<float> m_particleInstanceData; //reused by every instanced particle group, up to RENDERER3D_MAX_PARTICLE_INSTANCES instances at once
 
 		VertexArray m_waterVAO;
 		FrameBuffer m_waterReflectionFBO;
@@ -47,6 +112,14 @@ namespace gg
 		Texture m_waterDuDvMap;
 		Texture m_waterNormalMap;
 
+		GeometryPool m_geometryPool;
+		std::vector<DrawElementsIndirectCommand> m_geometryPoolCommands; //one command per pooled model, rebuilt every frame
+		std::vector<Model*> m_geometryPoolCommandModels; //model of each command, used for texture and culling state
+		std::vector<float> m_geometryPoolInstanceData;
+		std::vector<Renderable3D*> m_geometryPoolInstances; //renderable of each instance, in order of commands
+		std::vector<float> m_geometryPoolTransforms; //soa arrays of instance transforms (position x, y, z, rotation x, y, z, scale and rotation w if any instance uses quaternion rotation), input of batched model matrices
+		std::vector<matrix4> m_geometryPoolModelMatrices;
+
 	public:
 		/* Constructors */
 		Renderer3D();
@@ -66,18 +139,34 @@ namespace gg
 		void setFogGradient(const float value);
 		void setSkyColor(const Color& color, const Window& window); //window is taken as argument to change it's clearing color (sky color)
 
+		// Getters
+		inline GeometryPool& getGeometryPool() { return m_geometryPool; } //models created in this pool are rendered with indirect draw calls
+
 	private:
 		// Private Functions
 		void m_initParticleVAOs();
 		void m_initWaterStuff();
 
+		void m_buildGeometryPoolCommands();
+		void m_buildGeometryPoolModelMatrices(); //closed form and simd across instances, on scene threads for many instances
+
 		void m_renderRenderables(const matrix4& projection, const matrix4& view);
+		void m_renderGeometryPool(const matrix4& projection, const matrix4& view);
 		void m_renderSkybox(const Camera3D& cam, const matrix4& projection);
 		void m_renderParticles(const matrix4& projection, const matrix4& view);
+		void m_renderParticleGroup(const ParticleGroup& pg, const matrix4& view); //particle shaders have to have projection set
+		void m_simulateGPUParticles(); //once per frame, before any pass draws them
+		void m_renderGPUParticles(const matrix4& projection, const matrix4& view); //only draws, so water passes can reuse simulated particles
 		void m_renderWater(const Camera3D& cam, const matrix4& projection, const matrix4& view);
 
+		inline bool m_hasParticles() const { return m_particleGroups.size() > 0 || m_particleEmitters.size() > 0; } //cpu particles of groups and emitters, drawn by m_renderParticles
+
+		unsigned int m_getBasicLightFeatures() const; //features shared by all models in current pass
+		Shader& m_startBasicLightShader(const unsigned int features, const matrix4& projection, const matrix4& view);
+
 		void m_setClippingPlaneUniforms(const vector4& plane);
-		void m_updateLightUniforms(Light3D* light, const unsigned int index);
+		void m_updateLightUniforms(const Light3D* light, const unsigned int index);
+		void m_clearLightUniforms(const unsigned int index);
 
 	};
 
@@ -3,7 +3,13 @@
 // Self Include
 #include "Scene3D.h"
 
+// Normal Includes
+#include <utility>
+#include <algorithm>
+
 // Header Includes
+#include "particles/ParticleKernels.h"
+
 #include "../../utils/Sorting.h"
 
 
@@ -16,26 +22,18 @@ namespace gg
 	{
 		// Init
 		std::vector<float> distances;
-		distances.reserve(amount);
+		distances.reserve(lights.size());
 
-		// Calculating Distances from Lights
+		// Calculating Distances from Lights (squared, order is the same)
 		for (unsigned int i = 0; i < lights.size(); i++)
-		{
-			// Distance Calculating
-			distances.push_back((pos - lights[ i ]->getPosition()).length());
-		}
+			distances.push_back((pos - lights[ i ]->getPosition()).lengthSquared());
 
-		if (lights.size() > 0)
-		{
-			// Getting Indices of Sorted Values
-			std::vector<unsigned int> indices = quickSortIndices(distances);
-
-			return indices;
-		}
+		// Selecting Closest Lights
+		std::vector<unsigned int> indices;
+		selectLowestIndices(distances.data(), distances.size(), amount, indices);
 
 
-		std::vector<unsigned int> emptyVector;
-		return emptyVector;
+		return indices;
 	}
 
 
@@ -45,10 +43,21 @@ namespace gg
 	{}
 
 	/* Functions */
-	void Scene3D::update(const Camera3D& cam)
+	void Scene3D::update(const Camera3D& cam, const float deltaTime)
 	{
+		// Limiting Particles
+		m_particleBudget.beginFrame(getParticleCount());
+		m_grantParticleBudget(cam, deltaTime);
+
 		// Updating Particles
-		m_updateParticleGroups(cam);
+		m_updateParticles(cam, deltaTime);
+
+		// Removing Finished Groups and Emitters
+		m_removeFinishedParticleGroups();
+		m_removeFinishedParticleEmitters();
+
+		for (GPUParticleGroup* pg : m_gpuParticleGroups)
+			pg->update(deltaTime);
 	}
 
 	unsigned int Scene3D::addRenderable(Renderable3D* renderable)
@@ -88,19 +97,25 @@ namespace gg
 
 	void Scene3D::addLight(Light3D* light)
 	{
+		light->setLightGrid(&m_lightGrid, m_lights.size());
 		m_lights.push_back(light);
 		m_isImportantLight.push_back(false);
 	}
 
 	void Scene3D::addLight(Light3D* light, const bool isImportant)
 	{
+		light->setLightGrid(&m_lightGrid, m_lights.size());
 		m_lights.push_back(light);
 		m_isImportantLight.push_back(isImportant);
 	}
 
 	void Scene3D::popBackLights()
 	{
+		m_lightGrid.remove(m_lights.size() - 1);
+		m_lights.back()->setLightGrid(nullptr, 0);
+
 		m_lights.pop_back();
+		m_isImportantLight.pop_back();
 	}
 
 	void Scene3D::reserveLights(const unsigned int amount)
@@ -108,10 +123,26 @@ namespace gg
 		m_lights.reserve(amount);
 	}
 
+	void Scene3D::setLightGridCellSize(const float size)
+	{
+		m_lightGrid = LightGrid3D(size);
+
+		// Reinserting Lights
+		for (unsigned int i = 0; i < m_lights.size(); i++)
+			m_lights[i]->setLightGrid(&m_lightGrid, i);
+	}
+
 
 	void Scene3D::addParticleGroup(const ParticleGroup& pg)
 	{
 		m_particleGroups.push_back(pg);
+		m_limitLastParticleGroup();
+	}
+
+	void Scene3D::addParticleGroup(ParticleGroup&& pg)
+	{
+		m_particleGroups.push_back(std::move(pg));
+		m_limitLastParticleGroup();
 	}
 
 	void Scene3D::popBackParticleGroups()
@@ -125,6 +156,62 @@ namespace gg
 	}
 
 
+	void Scene3D::addParticleEmitter(ParticleEmitter* emitter)
+	{
+		// Taking Free Pooled Group
+		unsigned int poolIndex;
+
+		if (m_freePooledParticleGroups.size() > 0)
+		{
+			poolIndex = m_freePooledParticleGroups.back();
+			m_freePooledParticleGroups.pop_back();
+		}
+		else
+		{
+			poolIndex = m_pooledParticleGroups.size();
+			m_pooledParticleGroups.push_back(ParticleGroup(emitter->getSystem()->getTexture()));
+		}
+
+		// Group Setup
+		ParticleGroup& group = m_pooledParticleGroups[poolIndex];
+		emitter->getSystem()->setupGroup(group);
+		group.reserve(emitter->getCapacity());
+
+		// Adding Emitter
+		emitter->setPoolIndex(poolIndex);
+		m_particleEmitters.push_back(emitter);
+	}
+
+	void Scene3D::popBackParticleEmitters()
+	{
+		m_releasePooledParticleGroup(m_particleEmitters.back());
+		m_particleEmitters.pop_back();
+	}
+
+	void Scene3D::reserveParticleEmitters(const unsigned int amount)
+	{
+		m_particleEmitters.reserve(amount);
+		m_pooledParticleGroups.reserve(amount);
+		m_freePooledParticleGroups.reserve(amount);
+	}
+
+
+	void Scene3D::addGPUParticleGroup(GPUParticleGroup* pg)
+	{
+		m_gpuParticleGroups.push_back(pg);
+	}
+
+	void Scene3D::popBackGPUParticleGroups()
+	{
+		m_gpuParticleGroups.pop_back();
+	}
+
+	void Scene3D::reserveGPUParticleGroups(const unsigned int amount)
+	{
+		m_gpuParticleGroups.reserve(amount);
+	}
+
+
 	void Scene3D::addWaterTile(WaterTile* tile)
 	{
 		m_waterTiles.push_back(tile);
@@ -147,20 +234,165 @@ namespace gg
 	}
 
 
-	void Scene3D::m_updateParticleGroups(const Camera3D& cam)
+	void Scene3D::setThreadCount(const unsigned int count)
+	{
+		m_threadPool.setThreadCount(count);
+	}
+
+
+	// Getters
+	unsigned int Scene3D::getParticleCount() const
 	{
+		unsigned int result = 0;
+
+		for (const ParticleGroup& pg : m_particleGroups)
+			result += pg.getParticleCount();
+
+		for (const ParticleGroup& pg : m_pooledParticleGroups)
+			result += pg.getParticleCount();
+
+
+		return result;
+	}
+
+
+	void Scene3D::m_updateParticles(const Camera3D& cam, const float deltaTime)
+	{
+		// Init
+		unsigned int groupCount = m_particleGroups.size();
+		unsigned int taskCount = groupCount + m_particleEmitters.size();
+
+		auto updateTask = [this, &cam, deltaTime, groupCount](const unsigned int index)
+		{
+			if (index < groupCount)
+				m_particleGroups[index].update(cam, deltaTime);
+			else
+				m_updateParticleEmitter(*m_particleEmitters[index - groupCount], m_emitterSpawnAmounts[index - groupCount], cam, deltaTime);
+		};
+
+		// Updating on Calling Thread
+		if (getParticleCount() < SCENE3D_MIN_PARALLEL_PARTICLES || m_threadPool.getThreadCount() == 1)
+		{
+			for (unsigned int i = 0; i < taskCount; i++)
+				updateTask(i);
+
+			return;
+		}
+
+		// Updating on All Threads
+		getParticleKernel(); //resolves kernel before workers use it
+
+		m_threadPool.run(taskCount, updateTask);
+	}
+
+	void Scene3D::m_updateParticleEmitter(ParticleEmitter& emitter, const unsigned int spawnAmount, const Camera3D& cam, const float deltaTime)
+	{
+		ParticleGroup& group = m_pooledParticleGroups[emitter.getPoolIndex()];
+
+		// Spawning Particles
+		if (spawnAmount > 0)
+			emitter.getSystem()->addParticles(group, emitter.getPosition(), spawnAmount, emitter.getRandom());
+
+		// Updating Particles in Group
+		group.update(cam, deltaTime);
+	}
+
+
+	void Scene3D::m_grantParticleBudget(const Camera3D& cam, const float deltaTime)
+	{
+		// Init
+		m_emitterSpawnAmounts.resize(m_particleEmitters.size());
+		m_emitterBudgetOrder.resize(m_particleEmitters.size());
+
+		// Throttling by Distance and Visibility
+		for (unsigned int i = 0; i < m_particleEmitters.size(); i++)
+		{
+			ParticleEmitter* emitter = m_particleEmitters[i];
+			const ParticleGroup& group = m_pooledParticleGroups[emitter->getPoolIndex()];
+
+			float spawnScale = m_particleBudget.getSpawnScale(cam, emitter->getPosition(), emitter->getRadius());
+			m_particleBudget.reportSpawnScale(spawnScale);
+			emitter->setSpawnScale(spawnScale);
+
+			// Amount Wanted by Emitter (limited by its group's capacity)
+			unsigned int amount = emitter->update(deltaTime);
+			unsigned int freeSpace = group.getCapacity() - group.getParticleCount();
+
+			m_emitterSpawnAmounts[i] = amount < freeSpace ? amount : freeSpace;
+			m_emitterBudgetOrder[i] = i;
+		}
+
+		// Granting Budget from the Highest Priority (ties keep order emitters were added in)
+		std::stable_sort(m_emitterBudgetOrder.begin(), m_emitterBudgetOrder.end(), [this](const unsigned int index0, const unsigned int index1)
+		{
+			return m_particleEmitters[index0]->getPriority() > m_particleEmitters[index1]->getPriority();
+		});
+
+		for (unsigned int index : m_emitterBudgetOrder)
+			m_emitterSpawnAmounts[index] = m_particleBudget.request(m_emitterSpawnAmounts[index]);
+	}
+
+
+	void Scene3D::m_removeFinishedParticleGroups()
+	{
+		unsigned int keptCount = 0;
+
 		for (unsigned int i = 0; i < m_particleGroups.size(); i++)
 		{
-			// Updating Particles in Group
-			m_particleGroups[i].update(cam);
+			// Deleting Groups Without Particles
+			if (m_particleGroups[i].getParticleCount() == 0)
+				continue;
+
+			// Moving Remaining Groups to Front
+			if (keptCount != i)
+				m_particleGroups[keptCount] = std::move(m_particleGroups[i]);
+
+			keptCount++;
+		}
+
+		m_particleGroups.erase(m_particleGroups.begin() + keptCount, m_particleGroups.end());
+	}
+
+	void Scene3D::m_removeFinishedParticleEmitters()
+	{
+		unsigned int keptCount = 0;
 
-			// Checking if All Particles from Group are Deleted
-			if (m_particleGroups[i].getParticles().size() == 0)
+		for (unsigned int i = 0; i < m_particleEmitters.size(); i++)
+		{
+			ParticleEmitter* emitter = m_particleEmitters[i];
+
+			// Recycling Groups of Finished Emitters
+			if (emitter->isFinished() && m_pooledParticleGroups[emitter->getPoolIndex()].getParticleCount() == 0)
 			{
-				// Deleting Particle Group
-				m_particleGroups.erase(m_particleGroups.begin() + i);
+				m_releasePooledParticleGroup(emitter);
+				continue;
 			}
+
+			m_particleEmitters[keptCount] = emitter;
+			keptCount++;
 		}
+
+		m_particleEmitters.resize(keptCount);
+	}
+
+	void Scene3D::m_limitLastParticleGroup()
+	{
+		ParticleGroup& pg = m_particleGroups.back();
+		unsigned int granted = m_particleBudget.request(pg.getParticleCount());
+
+		// Removing Particles That Don't Fit (newest first)
+		pg.truncate(granted);
+
+		if (granted == 0)
+			m_particleGroups.pop_back();
+	}
+
+	void Scene3D::m_releasePooledParticleGroup(ParticleEmitter* emitter)
+	{
+		m_pooledParticleGroups[emitter->getPoolIndex()].clear();
+		m_freePooledParticleGroups.push_back(emitter->getPoolIndex());
+
+		emitter->setPoolIndex(-1);
 	}
 
 }
\ No newline at end of file
@@ -7,10 +7,21 @@
 // Header Includes
 #include "Renderable3D.h"
 #include "Light3D.h"
+#include "LightGrid3D.h"
 #include "particles/ParticleGroup.h"
+#include "particles/GPUParticleGroup.h"
+#include "particles/ParticleEmitter.h"
+#include "particles/ParticleBudget.h"
 #include "CubeMap.h"
 #include "water/WaterTile.h"
 
+#include "../../utils/ThreadPool.h"
+
+
+
+/* DEFINITIONS */
+#define SCENE3D_MIN_PARALLEL_PARTICLES 8192 //scenes with less particles are updated on calling thread; waking workers would take longer
+
 
 
 namespace gg
@@ -29,19 +40,30 @@ namespace gg
 
 		std::vector<Light3D*> m_lights;
 		std::vector<bool> m_isImportantLight; //used for lights that are forced to be rendered
+		LightGrid3D m_lightGrid; //used for finding closest lights without checking all of them
 
 		std::vector<ParticleGroup> m_particleGroups;
 
+		std::vector<ParticleEmitter*> m_particleEmitters;
+		std::vector<ParticleGroup> m_pooledParticleGroups; //one per emitter; groups of finished emitters are recycled, so their memory is reused
+		std::vector<unsigned int> m_freePooledParticleGroups;
+		std::vector<unsigned int> m_emitterSpawnAmounts; //granted by budget in current frame; indexed like m_particleEmitters
+		std::vector<unsigned int> m_emitterBudgetOrder; //emitter indices from the highest priority
+		ParticleBudget m_particleBudget;
+		std::vector<GPUParticleGroup*> m_gpuParticleGroups; //simulated by renderer, so only time is gathered here
+
 		std::vector<WaterTile*> m_waterTiles;
 
 		CubeMap* m_skybox;
 
+		ThreadPool m_threadPool;
+
 	public:
 		/* Constructors */
 		Scene3D();
 
 		/* Functions */
-		void update(const Camera3D& cam);
+		void update(const Camera3D& cam, const float deltaTime); //deltaTime is given in seconds; all particles use this one frame clock; particle groups are updated on many threads
 
 		unsigned int addRenderable(Renderable3D* renderable); //returns index of renderable in the vector; attaches renderable to new model in vector or existing model if any renderable already has the same model
 		void popBackRenderables();
@@ -51,20 +73,47 @@ namespace gg
 		void addLight(Light3D* light, const bool isImportant); //if isImportant is true, light will be forced to be rendered, even when other lights are closer
 		void popBackLights();
 		void reserveLights(const unsigned int amount);
+		void setLightGridCellSize(const float size); //should be around distance between lights; default is LIGHT_GRID3D_DEFAULT_CELL_SIZE
 
-		void addParticleGroup(const ParticleGroup& pg);
+		void addParticleGroup(const ParticleGroup& pg); //particles over particle budget are removed from added group
+		void addParticleGroup(ParticleGroup&& pg); //temporary groups (e.g. from generateParticles) are moved instead of copied
 		void popBackParticleGroups();
 		void reserveParticleGroups(const unsigned int amount);
 
+		void addParticleEmitter(ParticleEmitter* emitter); //emitter spawns into pooled group; it's removed from scene when it's finished and all of its particles are dead
+		void popBackParticleEmitters(); //particles of removed emitter are removed too
+		void reserveParticleEmitters(const unsigned int amount); //reserves pooled groups too, so adding emitters doesn't move existing groups
+
+		void addGPUParticleGroup(GPUParticleGroup* pg);
+		void popBackGPUParticleGroups();
+		void reserveGPUParticleGroups(const unsigned int amount);
+
 		void addWaterTile(WaterTile* tile);
 		void popBackWaterTiles();
 		void reserveWaterTiles(const unsigned int amount);
 
 		void setSkybox(CubeMap* skybox);
 
+		void setThreadCount(const unsigned int count); //threads used for updating particles (calling thread included); 0 means all hardware threads
+
+		// Getters
+		inline unsigned int getThreadCount() const { return m_threadPool.getThreadCount(); }
+
+		inline ParticleBudget& getParticleBudget() { return m_particleBudget; } //for changing limits and reading per frame report
+		unsigned int getParticleCount() const; //of cpu particle groups and emitters
+
 	private:
 		// Private Functions
-		void m_updateParticleGroups(const Camera3D& cam);
+		void m_updateParticles(const Camera3D& cam, const float deltaTime); //groups and emitters are independent, so every one of them is separate task
+		void m_updateParticleEmitter(ParticleEmitter& emitter, const unsigned int spawnAmount, const Camera3D& cam, const float deltaTime);
+		void m_grantParticleBudget(const Camera3D& cam, const float deltaTime); //decides how many particles every emitter spawns in this frame
+
+		void m_limitLastParticleGroup(); //removes particles of last added group that don't fit in budget
+
+		void m_removeFinishedParticleGroups(); //merges results of parallel update on one thread, keeping order of groups (and their draw orders)
+		void m_removeFinishedParticleEmitters();
+
+		void m_releasePooledParticleGroup(ParticleEmitter* emitter);
 
 	};
 
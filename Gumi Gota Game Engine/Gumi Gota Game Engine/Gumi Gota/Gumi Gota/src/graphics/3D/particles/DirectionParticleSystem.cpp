@@ -3,9 +3,6 @@
 // Self Include
 #include "DirectionParticleSystem.h"
 
-// Normal Includes
-#include <stdlib.h>
-
 
 
 /* MACROS */
@@ -21,21 +18,11 @@
 #define DIRECTION_PARTICLE_SYSTEM_DEFAULT_LIFETIME_ERROR 0.0f
 #define DIRECTION_PARTICLE_SYSTEM_DEFAULT_SCALE_ERROR 0.0f
 
-#define DIRECTION_PARTICLE_SYSTEM_ACCURACY_DIVIDER 1000.0f
-
 
 
 namespace gg
 {
 
-	/* ADDITIONAL FUNCTIONS */
-	static float s_randomSign() //generates float with value 1.0 or -1.0 (50/50 chance)
-	{
-		return (rand() % 2 == 0) ? -1.0f : 1.0f;
-	}
-
-
-
 	/* Constructors */
 	DirectionParticleSystem::DirectionParticleSystem(const vector3& dir, Texture* texture)
 		: ParticleSystem(texture),
@@ -59,20 +46,38 @@ namespace gg
 		ParticleGroup result(m_texture, m_startingTextureAtlasIndex, m_endingTextureAtlasIndex);
 		result.setUsingAdditiveBlending(m_usingAdditiveBlending);
 		result.reserve(amount);
-		
-		// Generating Particles
-		for (unsigned int i = 0; i < amount; i++)
-		{
-			Particle particle = m_generateRandomParticle(center);
 
-			result.add(particle);
-		}
+		// Generating Particles
+		m_generateParticles(result, center, amount, m_random);
 
 
 		// Finishing
 		return result;
 	}
 
+	GPUParticleEmitter DirectionParticleSystem::getGPUEmitter(const vector3& center) const
+	{
+		GPUParticleEmitter result;
+		result.type = GPU_PARTICLE_EMITTER_DIRECTION;
+		result.position = center;
+		result.positionError = m_positionError;
+		result.direction = m_direction;
+		result.directionError = m_directionError;
+		result.speed = 0.0f;
+		result.speedError = 0.0f;
+		result.lifetime = m_lifetime;
+		result.lifetimeError = m_lifetimeError;
+		result.gravity = m_gravity;
+		result.gravityError = m_gravityError;
+		result.rotation = m_rotation;
+		result.rotationError = m_rotationError;
+		result.scale = m_scale;
+		result.scaleError = m_scaleError;
+
+
+		return result;
+	}
+
 
 	// Setters
 	void DirectionParticleSystem::setDirection(const vector3& dir)
@@ -132,93 +137,16 @@ namespace gg
 	}
 
 	// Private Functions
-	Particle DirectionParticleSystem::m_generateRandomParticle(const vector3& pos)
+	Particle DirectionParticleSystem::m_generateRandomParticle(const vector3& pos, const float* randomValues)
 	{
-		// Start Position Randomizing
-		vector3 randomizedPosition;
-
-		if (m_positionError.x != 0.0f && m_positionError.y != 0.0f && m_positionError.z != 0.0f)
-		{
-			randomizedPosition =
-				vector3
-				(
-					s_randomSign() * (float)(rand() % (int)(m_positionError.x * DIRECTION_PARTICLE_SYSTEM_ACCURACY_DIVIDER)) / DIRECTION_PARTICLE_SYSTEM_ACCURACY_DIVIDER,
-					s_randomSign() * (float)(rand() % (int)(m_positionError.y * DIRECTION_PARTICLE_SYSTEM_ACCURACY_DIVIDER)) / DIRECTION_PARTICLE_SYSTEM_ACCURACY_DIVIDER,
-					s_randomSign() * (float)(rand() % (int)(m_positionError.z * DIRECTION_PARTICLE_SYSTEM_ACCURACY_DIVIDER)) / DIRECTION_PARTICLE_SYSTEM_ACCURACY_DIVIDER
-				)
-				+ pos;
-		}
-		else
-		{
-			randomizedPosition = pos;
-		}
-		
-		// Direction Randomizing
-		vector3 randomizedDirection;
-
-		if (m_directionError.x != 0.0f && m_directionError.y != 0.0f && m_directionError.z != 0.0f)
-		{
-			randomizedDirection =
-				vector3
-				(
-					s_randomSign() * (float)(rand() % (int)(m_directionError.x * DIRECTION_PARTICLE_SYSTEM_ACCURACY_DIVIDER)) / DIRECTION_PARTICLE_SYSTEM_ACCURACY_DIVIDER,
-					s_randomSign() * (float)(rand() % (int)(m_directionError.y * DIRECTION_PARTICLE_SYSTEM_ACCURACY_DIVIDER)) / DIRECTION_PARTICLE_SYSTEM_ACCURACY_DIVIDER,
-					s_randomSign() * (float)(rand() % (int)(m_directionError.z * DIRECTION_PARTICLE_SYSTEM_ACCURACY_DIVIDER)) / DIRECTION_PARTICLE_SYSTEM_ACCURACY_DIVIDER
-				)
-				+ m_direction;
-		}
-		else
-		{
-			randomizedDirection = m_direction;
-		}
-
-		// Rotation Randomizing
-		float randomizedRotation;
-
-		if (m_rotationError != 0.0f)
-		{
-			randomizedRotation = s_randomSign() * (float)(rand() % (int)(m_rotationError * DIRECTION_PARTICLE_SYSTEM_ACCURACY_DIVIDER)) / DIRECTION_PARTICLE_SYSTEM_ACCURACY_DIVIDER + m_rotation;
-		}
-		else
-		{
-			randomizedRotation = m_rotation;
-		}
-		
-		// Gravity Randomizing
-		float randomizedGravity;
-
-		if (m_gravityError != 0.0f)
-		{
-			randomizedGravity = s_randomSign() * (float)(rand() % (int)(m_gravityError * DIRECTION_PARTICLE_SYSTEM_ACCURACY_DIVIDER)) / DIRECTION_PARTICLE_SYSTEM_ACCURACY_DIVIDER + m_gravity;
-		}
-		else
-		{
-			randomizedGravity = m_gravity;
-		}
-
-		// Lifetime Randomizing
-		float randomizedLifetime;
-
-		if (m_lifetimeError != 0.0f)
-		{
-			randomizedLifetime = s_randomSign() * (float)(rand() % (int)(m_lifetimeError * DIRECTION_PARTICLE_SYSTEM_ACCURACY_DIVIDER)) / DIRECTION_PARTICLE_SYSTEM_ACCURACY_DIVIDER + m_lifetime;
-		}
-		else
-		{
-			randomizedLifetime = m_lifetime;
-		}
-
-		// Scale Randomizing
-		float randomizedScale;
-
-		if (m_scaleError != 0.0f)
-		{
-			randomizedScale = s_randomSign() * (float)(rand() % (int)(m_scaleError * DIRECTION_PARTICLE_SYSTEM_ACCURACY_DIVIDER)) / DIRECTION_PARTICLE_SYSTEM_ACCURACY_DIVIDER + m_scale;
-		}
-		else
-		{
-			randomizedScale = m_scale;
-		}
+		// Randomizing (every value is moved by up to its error in both directions)
+		vector3 randomizedPosition = pos + m_positionError * vector3(randomValues[0], randomValues[1], randomValues[2]);
+		vector3 randomizedDirection = m_direction + m_directionError * vector3(randomValues[3], randomValues[4], randomValues[5]);
+
+		float randomizedRotation = m_rotation + m_rotationError * randomValues[6];
+		float randomizedGravity = m_gravity + m_gravityError * randomValues[7];
+		float randomizedLifetime = m_lifetime + m_lifetimeError * randomValues[8];
+		float randomizedScale = m_scale + m_scaleError * randomValues[9];
 
 		// Finishing
 		Particle result(randomizedPosition, randomizedDirection, randomizedLifetime);
@@ -38,6 +38,7 @@ namespace gg
 
 		/* Functions */
 		ParticleGroup generateParticles(const vector3& center, const unsigned int amount); //center is a position where particles are coming from
+		GPUParticleEmitter getGPUEmitter(const vector3& center) const;
 
 		// Setters
 		void setDirection(const vector3& dir);
@@ -55,7 +56,7 @@ namespace gg
 
 	private:
 		// Private Functions
-		Particle m_generateRandomParticle(const vector3& pos);
+		Particle m_generateRandomParticle(const vector3& pos, const float* randomValues);
 
 	};
 
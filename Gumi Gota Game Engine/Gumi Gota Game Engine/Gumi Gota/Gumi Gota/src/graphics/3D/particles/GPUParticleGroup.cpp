@@ -0,0 +1,188 @@
+
+/* INCLUDES */
+// Self Include
+#include "GPUParticleGroup.h"
+
+// OpenGL Includes
+#include <GL/glew.h>
+
+// Normal Includes
+#include <vector>
+
+// Header Includes
+#include "../../ErrorHandling.h"
+#include "../../GLStateCache.h"
+
+
+
+/* MACROS */
+#define GPU_PARTICLE_GROUP_DEFAULT_LOOPING true
+#define GPU_PARTICLE_GROUP_DEFAULT_USING_ADDITIVE_BLENDING true
+
+
+
+namespace gg
+{
+
+	/* ADDITIONAL STUFF */
+	static unsigned int s_nextRandomSeed = 0x9E3779B9; //every group gets different seed, so groups with the same emitter don't look the same
+
+
+
+	/* ADDITIONAL FUNCTIONS */
+	static void s_setParticleAttribute(const unsigned int index, const unsigned int dataLength, const unsigned int offset, const unsigned int divisor) //buffer has to be bound; offset is in floats amount
+	{
+		GLcall(glEnableVertexAttribArray(index));
+		GLcall(glVertexAttribPointer(index, dataLength, GL_FLOAT, GL_FALSE, GPU_PARTICLE_GROUP_PARTICLE_DATA_LENGTH * sizeof(float), static_cast<char const*>(0) + offset * sizeof(float)));
+		GLcall(glVertexAttribDivisor(index, divisor));
+	}
+
+
+
+	/* Constructors */
+	GPUParticleGroup::GPUParticleGroup(Texture* texture, const unsigned int count, const GPUParticleEmitter& emitter)
+		: m_currentBuffer(0), m_particleCount(count), m_emitter(emitter),
+		  m_looping(GPU_PARTICLE_GROUP_DEFAULT_LOOPING), m_timeToSimulate(0.0f), m_randomSeed(0),
+		  m_texture(texture), m_startingTextureAtlasIndex(0), m_endingTextureAtlasIndex(texture->getAtlasRows() * texture->getAtlasRows() - 1),
+		  m_usingAdditiveBlending(GPU_PARTICLE_GROUP_DEFAULT_USING_ADDITIVE_BLENDING)
+	{
+		m_init();
+	}
+
+	GPUParticleGroup::GPUParticleGroup(Texture* texture, const unsigned int startIndex, const unsigned int endIndex, const unsigned int count, const GPUParticleEmitter& emitter)
+		: m_currentBuffer(0), m_particleCount(count), m_emitter(emitter),
+		  m_looping(GPU_PARTICLE_GROUP_DEFAULT_LOOPING), m_timeToSimulate(0.0f), m_randomSeed(0),
+		  m_texture(texture), m_startingTextureAtlasIndex(startIndex), m_endingTextureAtlasIndex(endIndex),
+		  m_usingAdditiveBlending(GPU_PARTICLE_GROUP_DEFAULT_USING_ADDITIVE_BLENDING)
+	{
+		m_init();
+	}
+
+	/* Destructor */
+	GPUParticleGroup::~GPUParticleGroup()
+	{
+		for (unsigned int i = 0; i < 2; i++)
+		{
+			GLStateCache::onVertexArrayDeleted(m_updateVAOs[i]);
+			GLStateCache::onVertexArrayDeleted(m_renderVAOs[i]);
+		}
+
+		GLcall(glDeleteVertexArrays(2, m_updateVAOs));
+		GLcall(glDeleteVertexArrays(2, m_renderVAOs));
+		GLcall(glDeleteBuffers(2, m_buffers));
+	}
+
+	/* Functions */
+	void GPUParticleGroup::update(const float deltaTime)
+	{
+		m_timeToSimulate += deltaTime;
+	}
+
+	void GPUParticleGroup::simulate()
+	{
+		// Init
+		unsigned int nextBuffer = 1 - m_currentBuffer;
+
+		// Writing Updated Particles to the Other Buffer
+		GLStateCache::bindVertexArray(m_updateVAOs[m_currentBuffer]);
+		GLcall(glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, m_buffers[nextBuffer]));
+
+		GLcall(glEnable(GL_RASTERIZER_DISCARD));
+		GLcall(glBeginTransformFeedback(GL_POINTS));
+		GLcall(glDrawArrays(GL_POINTS, 0, m_particleCount));
+		GLcall(glEndTransformFeedback());
+		GLcall(glDisable(GL_RASTERIZER_DISCARD));
+
+		GLcall(glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, 0));
+
+		// Swapping Buffers
+		m_currentBuffer = nextBuffer;
+
+		m_timeToSimulate = 0.0f;
+		m_randomSeed = m_randomSeed * 1664525 + 1013904223;
+	}
+
+
+	void GPUParticleGroup::bindForRendering() const
+	{
+		GLStateCache::bindVertexArray(m_renderVAOs[m_currentBuffer]);
+		m_texture->bind();
+	}
+
+	void GPUParticleGroup::unbind()
+	{
+		GLStateCache::bindVertexArray(0);
+		Texture::unbind();
+	}
+
+	// Setters
+	void GPUParticleGroup::setEmitter(const GPUParticleEmitter& emitter)
+	{
+		m_emitter = emitter;
+	}
+
+	void GPUParticleGroup::setEmitterPosition(const vector3& pos)
+	{
+		m_emitter.position = pos;
+	}
+
+	void GPUParticleGroup::setLooping(const bool value)
+	{
+		m_looping = value;
+	}
+
+	void GPUParticleGroup::setUsingAdditiveBlending(const bool value)
+	{
+		m_usingAdditiveBlending = value;
+	}
+
+	// Private Functions
+	void GPUParticleGroup::m_init()
+	{
+		// Random Seed Setup
+		m_randomSeed = s_nextRandomSeed;
+		s_nextRandomSeed = s_nextRandomSeed * 1664525 + 1013904223;
+
+		// Initial Particles (not spawned yet; negative age is time left to first spawn, zero lifetime marks particle as never spawned)
+		std::vector<float> data(m_particleCount * GPU_PARTICLE_GROUP_PARTICLE_DATA_LENGTH, 0.0f);
+
+		for (unsigned int i = 0; i < m_particleCount; i++)
+		{
+			float* particle = &data[i * GPU_PARTICLE_GROUP_PARTICLE_DATA_LENGTH];
+
+			particle[0] = m_emitter.position.x;
+			particle[1] = m_emitter.position.y;
+			particle[2] = m_emitter.position.z;
+			particle[6] = -(float)i / m_particleCount * m_emitter.lifetime; // age
+		}
+
+		// Buffers Setup
+		GLcall(glGenBuffers(2, m_buffers));
+		GLcall(glGenVertexArrays(2, m_updateVAOs));
+		GLcall(glGenVertexArrays(2, m_renderVAOs));
+
+		for (unsigned int i = 0; i < 2; i++)
+		{
+			GLcall(glBindBuffer(GL_ARRAY_BUFFER, m_buffers[i]));
+			GLcall(glBufferData(GL_ARRAY_BUFFER, data.size() * sizeof(float), i == 0 ? data.data() : nullptr, GL_DYNAMIC_COPY));
+
+			// Update VAO (one vertex per particle; same layout as update shader outputs)
+			GLStateCache::bindVertexArray(m_updateVAOs[i]);
+			s_setParticleAttribute(0, 3, 0, 0);  // position
+			s_setParticleAttribute(1, 3, 3, 0);  // velocity
+			s_setParticleAttribute(2, 4, 6, 0);  // age, lifetime, gravity, rotation
+			s_setParticleAttribute(3, 1, 10, 0); // scale
+
+			// Render VAO (one quad instance per particle; quad corners come from gl_VertexID)
+			GLStateCache::bindVertexArray(m_renderVAOs[i]);
+			s_setParticleAttribute(0, 3, 0, 1);  // position
+			s_setParticleAttribute(1, 4, 6, 1);  // age, lifetime, gravity, rotation
+			s_setParticleAttribute(2, 1, 10, 1); // scale
+		}
+
+		// Finishing
+		GLStateCache::bindVertexArray(0);
+		GLcall(glBindBuffer(GL_ARRAY_BUFFER, 0));
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+#ifndef GUMIGOTA_GPU_PARTICLE_GROUP_H
+#define GUMIGOTA_GPU_PARTICLE_GROUP_H
+
+
+
+/* INCLUDES */
+// Header Includes
+#include "../../Texture.h"
+
+#include "../../../maths/vectors/vector3.h"
+
+
+
+/* DEFINITIONS */
+#define GPU_PARTICLE_GROUP_PARTICLE_DATA_LENGTH 11 //floats per particle: position (3), velocity (3), age, lifetime, gravity, rotation, scale
+
+
+
+namespace gg
+{
+
+	/* ADDITIONAL STUFF */
+	enum GPUParticleEmitterType
+	{
+		GPU_PARTICLE_EMITTER_DIRECTION = 0,
+		GPU_PARTICLE_EMITTER_SPREAD = 1
+	};
+
+	struct GPUParticleEmitter //same parameters particle systems use on cpu; every value gets random error from -error to error
+	{
+		GPUParticleEmitterType type;
+		vector3 position, positionError;
+		vector3 direction, directionError; //used by direction emitters
+		float speed, speedError; //used by spread emitters
+		float lifetime, lifetimeError; //in seconds
+		float gravity, gravityError;
+		float rotation, rotationError; //in radians
+		float scale, scaleError;
+	};
+
+
+
+	class GPUParticleGroup //particles simulated with transform feedback; their state never goes back to cpu; owns opengl buffers, so it shouldn't be copied
+	{
+	private:
+		/* Variables */
+		unsigned int m_buffers[2]; //ping-ponged; update reads one and writes the other
+		unsigned int m_updateVAOs[2]; //read particles from m_buffers[i] as vertices
+		unsigned int m_renderVAOs[2]; //read particles from m_buffers[i] as instances
+		unsigned int m_currentBuffer; //index of buffer with newest particles
+
+		unsigned int m_particleCount;
+		GPUParticleEmitter m_emitter;
+		bool m_looping; //if true dead particles respawn at emitter; if false every particle lives once
+		float m_timeToSimulate; //gathered by scene updates, simulated by renderer in one step
+		unsigned int m_randomSeed; //changes every simulation step, so respawned particles differ
+
+		Texture* m_texture;
+		unsigned int m_startingTextureAtlasIndex, m_endingTextureAtlasIndex;
+		bool m_usingAdditiveBlending; //particles aren't sorted, so additive blending looks the best
+
+	public:
+		/* Constructors */
+		GPUParticleGroup(Texture* texture, const unsigned int count, const GPUParticleEmitter& emitter); //particles are spawned one after another over first lifetime, so looping group emits at constant rate
+		GPUParticleGroup(Texture* texture, const unsigned int startIndex, const unsigned int endIndex, const unsigned int count, const GPUParticleEmitter& emitter);
+
+		/* Destructor */
+		~GPUParticleGroup();
+
+		/* Functions */
+		void update(const float deltaTime); //deltaTime is given in seconds; only gathers time, gpu simulates it when group is rendered
+		void simulate(); //update shader has to be started and have uniforms set; swaps buffers
+
+		void bindForRendering() const; //binds instance vao of newest particles and texture
+		static void unbind();
+
+		// Setters
+		void setEmitter(const GPUParticleEmitter& emitter); //e.g. for moving emitter with player
+		void setEmitterPosition(const vector3& pos);
+		void setLooping(const bool value);
+		void setUsingAdditiveBlending(const bool value);
+
+		// Getters
+		inline unsigned int getParticleCount() const { return m_particleCount; }
+		inline const GPUParticleEmitter& getEmitter() const { return m_emitter; }
+		inline bool isLooping() const { return m_looping; }
+		inline float getTimeToSimulate() const { return m_timeToSimulate; }
+		inline unsigned int getRandomSeed() const { return m_randomSeed; }
+
+		inline bool usingAdditiveBlending() const { return m_usingAdditiveBlending; }
+
+		inline unsigned int getTextureAtlasRows() const { return m_texture->getAtlasRows(); }
+		inline unsigned int getStartingTextureAtlasIndex() const { return m_startingTextureAtlasIndex; }
+		inline unsigned int getTexturePhaseCount() const { return m_endingTextureAtlasIndex - m_startingTextureAtlasIndex + 1; }
+
+	private:
+		// Private Functions
+		void m_init();
+
+	};
+
+}
+
+
+
+#endif
\ No newline at end of file
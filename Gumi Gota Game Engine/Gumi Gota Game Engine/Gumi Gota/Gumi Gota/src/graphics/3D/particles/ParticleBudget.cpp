@@ -0,0 +1,176 @@
+
+/* INCLUDES */
+// Self Include
+#include "ParticleBudget.h"
+
+// Header Includes
+#include "../../../maths/trigonometry/Trigonometry.h"
+#include "../../../maths/general/BasicOperations.h"
+#include "../../../maths/geometry/VectorTransformations.h"
+
+#include "../../../Log.h"
+
+
+
+/* MACROS */
+#define PARTICLE_BUDGET_DEFAULT_FULL_RATE_DISTANCE 50.0f
+#define PARTICLE_BUDGET_DEFAULT_CULL_DISTANCE 200.0f
+#define PARTICLE_BUDGET_DEFAULT_OFF_SCREEN_SPAWN_SCALE 0.1f
+
+
+
+namespace gg
+{
+
+	/* Constructors */
+	ParticleBudget::ParticleBudget()
+		: m_maxParticles(PARTICLE_BUDGET_DEFAULT_MAX_PARTICLES), m_availableParticles(PARTICLE_BUDGET_DEFAULT_MAX_PARTICLES),
+		  m_fullRateDistance(PARTICLE_BUDGET_DEFAULT_FULL_RATE_DISTANCE), m_cullDistance(PARTICLE_BUDGET_DEFAULT_CULL_DISTANCE),
+		  m_offScreenSpawnScale(PARTICLE_BUDGET_DEFAULT_OFF_SCREEN_SPAWN_SCALE)
+	{
+		m_resetReport(m_currentReport, 0);
+		m_resetReport(m_report, 0);
+	}
+
+	ParticleBudget::ParticleBudget(const unsigned int maxParticles)
+		: m_maxParticles(maxParticles), m_availableParticles(maxParticles),
+		  m_fullRateDistance(PARTICLE_BUDGET_DEFAULT_FULL_RATE_DISTANCE), m_cullDistance(PARTICLE_BUDGET_DEFAULT_CULL_DISTANCE),
+		  m_offScreenSpawnScale(PARTICLE_BUDGET_DEFAULT_OFF_SCREEN_SPAWN_SCALE)
+	{
+		m_resetReport(m_currentReport, 0);
+		m_resetReport(m_report, 0);
+	}
+
+	/* Functions */
+	void ParticleBudget::beginFrame(const unsigned int aliveParticles)
+	{
+		// Finishing Previous Frame's Report
+		m_currentReport.pressure = m_maxParticles > 0 ? (float)(m_currentReport.aliveParticles + m_currentReport.requestedParticles) / (float)m_maxParticles : 0.0f;
+		m_report = m_currentReport;
+
+		// Starting New Frame
+		m_availableParticles = aliveParticles < m_maxParticles ? m_maxParticles - aliveParticles : 0;
+		m_resetReport(m_currentReport, aliveParticles);
+	}
+
+	unsigned int ParticleBudget::request(const unsigned int amount)
+	{
+		unsigned int granted = amount < m_availableParticles ? amount : m_availableParticles;
+		m_availableParticles -= granted;
+
+		// Reporting
+		m_currentReport.requestedParticles += amount;
+		m_currentReport.grantedParticles += granted;
+		m_currentReport.droppedParticles += amount - granted;
+
+
+		return granted;
+	}
+
+
+	float ParticleBudget::getSpawnScale(const Camera3D& cam, const vector3& pos, const float radius) const
+	{
+		// Distance Throttling (measured to the closest point of emitter's area; squared distances are compared first, so only emitters between both distances need square root)
+		float distanceSquared = (pos - cam.getPosition()).lengthSquared();
+		float cullLimit = m_cullDistance + radius;
+		float fullRateLimit = m_fullRateDistance + radius;
+		float scale = 1.0f;
+
+		if (distanceSquared >= cullLimit * cullLimit)
+			return 0.0f;
+
+		if (distanceSquared > fullRateLimit * fullRateLimit)
+			scale = (m_cullDistance - (squareRoot(distanceSquared) - radius)) / (m_cullDistance - m_fullRateDistance);
+
+		// Visibility Throttling
+		if (!m_isVisible(cam, pos, radius))
+			scale *= m_offScreenSpawnScale;
+
+
+		return scale;
+	}
+
+	void ParticleBudget::reportSpawnScale(const float scale)
+	{
+		if (scale <= 0.0f)
+			m_currentReport.culledEmitters++;
+		else if (scale < 1.0f)
+			m_currentReport.throttledEmitters++;
+	}
+
+
+	void ParticleBudget::logReport() const
+	{
+		LOG("[Info] Particle budget: " << m_report.aliveParticles << "/" << m_report.maxParticles << " alive, pressure " << (unsigned int)(m_report.pressure * 100.0f) << "%, "
+			<< "requested " << m_report.requestedParticles << ", granted " << m_report.grantedParticles << ", dropped " << m_report.droppedParticles << ", "
+			<< "throttled emitters " << m_report.throttledEmitters << ", culled emitters " << m_report.culledEmitters);
+	}
+
+
+	// Setters
+	void ParticleBudget::setMaxParticles(const unsigned int amount)
+	{
+		m_maxParticles = amount;
+		m_currentReport.maxParticles = amount;
+
+		if (m_availableParticles > amount)
+			m_availableParticles = amount;
+	}
+
+	void ParticleBudget::setDistances(const float fullRateDistance, const float cullDistance)
+	{
+		m_fullRateDistance = fullRateDistance;
+		m_cullDistance = cullDistance > fullRateDistance ? cullDistance : fullRateDistance;
+	}
+
+	void ParticleBudget::setOffScreenSpawnScale(const float scale)
+	{
+		m_offScreenSpawnScale = scale;
+	}
+
+	// Private Functions
+	void ParticleBudget::m_resetReport(ParticleBudgetReport& report, const unsigned int aliveParticles) const
+	{
+		report.maxParticles = m_maxParticles;
+		report.aliveParticles = aliveParticles;
+		report.requestedParticles = 0;
+		report.grantedParticles = 0;
+		report.droppedParticles = 0;
+		report.throttledEmitters = 0;
+		report.culledEmitters = 0;
+		report.pressure = 0.0f;
+	}
+
+	bool ParticleBudget::m_isVisible(const Camera3D& cam, const vector3& pos, const float radius) const
+	{
+		// Camera Axes (the same as in matrix4::fpsView)
+		float cp = cosine(cam.getPitch());
+		float sp = sine(cam.getPitch());
+		float cy = cosine(cam.getYaw());
+		float sy = sine(cam.getYaw());
+
+		vector3 xAxis(cy, 0.0f, -sy);
+		vector3 yAxis(sy * sp, cp, cy * sp);
+		vector3 zAxis(sy * cp, -sp, cp * cy);
+
+		// Position in View Space (camera looks along -z)
+		vector3 offset = pos - cam.getPosition();
+		float x = dotProduct(xAxis, offset);
+		float y = dotProduct(yAxis, offset);
+		float depth = -dotProduct(zAxis, offset);
+
+		if (depth < -radius)
+			return false;
+
+		// Testing Sphere Against Side Planes
+		float halfHeight = tangent(cam.getFOV() / 2.0f);
+		float halfWidth = halfHeight * cam.getAspectRatio();
+
+		float horizontalLimit = depth * halfWidth + radius * squareRoot(1.0f + halfWidth * halfWidth);
+		float verticalLimit = depth * halfHeight + radius * squareRoot(1.0f + halfHeight * halfHeight);
+
+
+		return (x <= horizontalLimit && -x <= horizontalLimit) && (y <= verticalLimit && -y <= verticalLimit);
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+#ifndef GUMIGOTA_PARTICLE_BUDGET_H
+#define GUMIGOTA_PARTICLE_BUDGET_H
+
+
+
+/* INCLUDES */
+// Header Includes
+#include "../Camera3D.h"
+
+
+
+/* DEFINITIONS */
+#define PARTICLE_BUDGET_DEFAULT_MAX_PARTICLES 200000
+
+
+
+namespace gg
+{
+
+	/* ADDITIONAL STUFF */
+	struct ParticleBudgetReport //counted from one Scene3D update to the next one
+	{
+		unsigned int maxParticles;
+		unsigned int aliveParticles; //when frame started
+		unsigned int requestedParticles; //by emitters (after throttling) and added groups
+		unsigned int grantedParticles;
+		unsigned int droppedParticles; //requested, but not granted
+		unsigned int throttledEmitters; //spawning less because of distance or being off screen
+		unsigned int culledEmitters; //not spawning at all
+		float pressure; //(alive + requested) / max; over 1.0 means budget is limiting spawning
+	};
+
+
+
+	class ParticleBudget //limits amount of particles alive in scene, so frame time doesn't depend on how many emitters are placed
+	{
+	private:
+		/* Variables */
+		unsigned int m_maxParticles;
+		unsigned int m_availableParticles; //left for current frame
+
+		float m_fullRateDistance; //emitters closer to camera spawn at full rate
+		float m_cullDistance; //emitters further from camera don't spawn; rate falls linearly between both distances
+		float m_offScreenSpawnScale; //multiplies spawn rate of emitters outside of camera's view
+
+		ParticleBudgetReport m_currentReport;
+		ParticleBudgetReport m_report; //of last finished frame
+
+	public:
+		/* Constructors */
+		ParticleBudget();
+		ParticleBudget(const unsigned int maxParticles);
+
+		/* Functions */
+		void beginFrame(const unsigned int aliveParticles); //called by Scene3D before emitters spawn
+		unsigned int request(const unsigned int amount); //returns amount of particles that can be spawned and takes them from budget
+
+		float getSpawnScale(const Camera3D& cam, const vector3& pos, const float radius) const; //from 0.0 to 1.0; radius is size of area particles usually reach around pos
+		void reportSpawnScale(const float scale); //counts throttled and culled emitters
+
+		void logReport() const; //prints last finished frame's report (in debug builds)
+
+		// Setters
+		void setMaxParticles(const unsigned int amount);
+		void setDistances(const float fullRateDistance, const float cullDistance);
+		void setOffScreenSpawnScale(const float scale);
+
+		// Getters
+		inline unsigned int getMaxParticles()       const { return m_maxParticles;       }
+		inline unsigned int getAvailableParticles() const { return m_availableParticles; }
+		inline float        getFullRateDistance()   const { return m_fullRateDistance;   }
+		inline float        getCullDistance()       const { return m_cullDistance;       }
+		inline float        getOffScreenSpawnScale() const { return m_offScreenSpawnScale; }
+
+		inline const ParticleBudgetReport& getReport() const { return m_report; }
+
+	private:
+		// Private Functions
+		void m_resetReport(ParticleBudgetReport& report, const unsigned int aliveParticles) const;
+		bool m_isVisible(const Camera3D& cam, const vector3& pos, const float radius) const;
+
+	};
+
+}
+
+
+
+#endif
\ No newline at end of file
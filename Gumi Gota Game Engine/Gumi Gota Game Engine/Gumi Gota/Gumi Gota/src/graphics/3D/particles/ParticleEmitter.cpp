@@ -0,0 +1,147 @@
+
+/* INCLUDES */
+// Self Include
+#include "ParticleEmitter.h"
+
+
+
+/* MACROS */
+#define PARTICLE_EMITTER_DEFAULT_BURST 0
+#define PARTICLE_EMITTER_DEFAULT_DURATION 0.0f
+#define PARTICLE_EMITTER_DEFAULT_PRIORITY 0
+#define PARTICLE_EMITTER_DEFAULT_RADIUS 5.0f
+
+
+
+namespace gg
+{
+
+	/* Constructors */
+	ParticleEmitter::ParticleEmitter(ParticleSystem* system, const vector3& pos, const float spawnRate)
+		: m_system(system), m_position(pos),
+		  m_spawnRate(spawnRate), m_burst(PARTICLE_EMITTER_DEFAULT_BURST), m_duration(PARTICLE_EMITTER_DEFAULT_DURATION), m_capacity(PARTICLE_GROUP_DEFAULT_CAPACITY),
+		  m_priority(PARTICLE_EMITTER_DEFAULT_PRIORITY), m_radius(PARTICLE_EMITTER_DEFAULT_RADIUS), m_spawnScale(1.0f),
+		  m_age(0.0f), m_spawnRemainder(0.0f), m_burstSpawned(false),
+		  m_poolIndex(-1)
+	{}
+
+	ParticleEmitter::ParticleEmitter(ParticleSystem* system, const vector3& pos, const float spawnRate, const unsigned int burst, const float duration)
+		: m_system(system), m_position(pos),
+		  m_spawnRate(spawnRate), m_burst(burst), m_duration(duration), m_capacity(PARTICLE_GROUP_DEFAULT_CAPACITY),
+		  m_priority(PARTICLE_EMITTER_DEFAULT_PRIORITY), m_radius(PARTICLE_EMITTER_DEFAULT_RADIUS), m_spawnScale(1.0f),
+		  m_age(0.0f), m_spawnRemainder(0.0f), m_burstSpawned(false),
+		  m_poolIndex(-1)
+	{}
+
+	/* Functions */
+	unsigned int ParticleEmitter::update(const float deltaTime)
+	{
+		if (isFinished())
+			return 0;
+
+		unsigned int amount = 0;
+
+		// Burst (scaled burst is rounded, so throttled emitters still spawn something)
+		if (!m_burstSpawned)
+		{
+			amount += (unsigned int)(m_burst * m_spawnScale + 0.5f);
+			m_burstSpawned = true;
+		}
+
+		// Continuous Emission (only until duration ends)
+		float emittingTime = deltaTime;
+		if (m_duration > 0.0f && m_age + deltaTime > m_duration)
+			emittingTime = m_duration - m_age;
+
+		m_spawnRemainder += m_spawnRate * m_spawnScale * emittingTime;
+
+		unsigned int spawned = (unsigned int)m_spawnRemainder;
+		m_spawnRemainder -= spawned;
+		amount += spawned;
+
+		m_age += deltaTime;
+
+
+		return amount;
+	}
+
+	void ParticleEmitter::restart()
+	{
+		m_age = 0.0f;
+		m_spawnRemainder = 0.0f;
+		m_burstSpawned = false;
+
+		m_random.seed(m_random.getSeed());
+	}
+
+	void ParticleEmitter::stop()
+	{
+		m_duration = m_age > 0.0f ? m_age : -1.0f; //negative duration, so emitter stopped before first update is finished too
+		m_burstSpawned = true;
+	}
+
+
+	// Setters
+	void ParticleEmitter::setSystem(ParticleSystem* system)
+	{
+		m_system = system;
+	}
+
+	void ParticleEmitter::setPosition(const vector3& pos)
+	{
+		m_position = pos;
+	}
+
+	void ParticleEmitter::setSpawnRate(const float rate)
+	{
+		m_spawnRate = rate;
+	}
+
+	void ParticleEmitter::setBurst(const unsigned int amount)
+	{
+		m_burst = amount;
+	}
+
+	void ParticleEmitter::setDuration(const float duration)
+	{
+		m_duration = duration;
+	}
+
+	void ParticleEmitter::setCapacity(const unsigned int amount)
+	{
+		m_capacity = amount;
+	}
+
+	void ParticleEmitter::setPriority(const int priority)
+	{
+		m_priority = priority;
+	}
+
+	void ParticleEmitter::setRadius(const float radius)
+	{
+		m_radius = radius;
+	}
+
+	void ParticleEmitter::setRandomSeed(const unsigned int seed)
+	{
+		m_random.seed(seed);
+	}
+
+
+	void ParticleEmitter::setPoolIndex(const int index)
+	{
+		m_poolIndex = index;
+	}
+
+	void ParticleEmitter::setSpawnScale(const float scale)
+	{
+		m_spawnScale = scale;
+	}
+
+	// Getters
+	bool ParticleEmitter::isFinished() const
+	{
+		return m_burstSpawned && m_duration != 0.0f && m_age >= m_duration;
+	}
+
+}
\ No newline at end of file
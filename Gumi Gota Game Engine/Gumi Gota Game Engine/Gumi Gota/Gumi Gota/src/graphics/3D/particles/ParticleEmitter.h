@@ -0,0 +1,83 @@
+#ifndef GUMIGOTA_PARTICLE_EMITTER_H
+#define GUMIGOTA_PARTICLE_EMITTER_H
+
+
+
+/* INCLUDES */
+// Header Includes
+#include "ParticleSystem.h"
+
+
+
+namespace gg
+{
+
+	class ParticleEmitter //spawns particles of a system over time into particle group pooled by Scene3D
+	{
+	private:
+		/* Variables */
+		ParticleSystem* m_system;
+		vector3 m_position;
+
+		float m_spawnRate; //particles per second
+		unsigned int m_burst; //particles spawned at once when emitter starts
+		float m_duration; //in seconds; emitter with duration 0 emits until it's stopped
+		unsigned int m_capacity; //max particles alive at once; particles over it aren't spawned
+		int m_priority; //emitters with higher priority get particles first when scene's particle budget is short
+		float m_radius; //size of area its particles usually reach; used for checking if emitter is on screen
+		float m_spawnScale; //multiplies spawn rate and burst; set by Scene3D from distance to camera and visibility
+
+		float m_age;
+		float m_spawnRemainder; //fraction of particle left from previous updates, so low spawn rates work with any frame rate
+		bool m_burstSpawned;
+
+		Random m_random; //own generator, so emitters don't affect each other and can be replayed with the same seed
+
+		int m_poolIndex; //index of pooled group in scene, -1 if emitter isn't in any scene
+
+	public:
+		/* Constructors */
+		ParticleEmitter(ParticleSystem* system, const vector3& pos, const float spawnRate);
+		ParticleEmitter(ParticleSystem* system, const vector3& pos, const float spawnRate, const unsigned int burst, const float duration);
+
+		/* Functions */
+		unsigned int update(const float deltaTime); //deltaTime is given in seconds; returns amount of particles that should be spawned
+		void restart(); //also restarts random sequence, so emitter spawns the same particles again
+		void stop(); //spawned particles live until their lifetime ends
+
+		// Setters
+		void setSystem(ParticleSystem* system); //used for groups set up after this call
+		void setPosition(const vector3& pos);
+		void setSpawnRate(const float rate);
+		void setBurst(const unsigned int amount);
+		void setDuration(const float duration);
+		void setCapacity(const unsigned int amount);
+		void setPriority(const int priority);
+		void setRadius(const float radius);
+		void setRandomSeed(const unsigned int seed);
+
+		void setPoolIndex(const int index); //used by Scene3D
+		void setSpawnScale(const float scale); //used by Scene3D
+
+		// Getters
+		inline ParticleSystem* getSystem()    const { return m_system;    }
+		inline const vector3&  getPosition()  const { return m_position;  }
+		inline float           getSpawnRate() const { return m_spawnRate; }
+		inline unsigned int    getBurst()     const { return m_burst;     }
+		inline float           getDuration()  const { return m_duration;  }
+		inline unsigned int    getCapacity()  const { return m_capacity;  }
+		inline int             getPriority()  const { return m_priority;  }
+		inline float           getRadius()    const { return m_radius;    }
+		inline int             getPoolIndex() const { return m_poolIndex; }
+
+		inline Random& getRandom() { return m_random; }
+
+		bool isFinished() const; //true if emitter won't spawn any more particles
+
+	};
+
+}
+
+
+
+#endif
\ No newline at end of file
@@ -3,12 +3,20 @@
 // Self Include
 #include "ParticleGroup.h"
 
+// Normal Includes
+#include <algorithm>
+
+// Header Includes
+#include "../../../utils/Sorting.h"
+
 
 
 /* MACROS */
 #define PARTICLE_GROUP_DEFAULT_USING_ADDITIVE_BLENDING false
 #define PARTICLE_GROUP_DEFAULT_SORT_PARTICLES true
 
+#define PARTICLE_GROUP_REMOVED_INDEX 0xFFFFFFFF
+
 
 
 namespace gg
@@ -16,15 +24,17 @@ namespace gg
 
 	/* Constructors */
 	ParticleGroup::ParticleGroup(Texture* texture)
-		: m_texture(texture), m_startingTextureAtlasIndex(0), m_endingTextureAtlasIndex(texture->getAtlasRows() * texture->getAtlasRows() - 1),
+		: m_particleCount(0), m_capacity(0),
+		  m_texture(texture), m_startingTextureAtlasIndex(0), m_endingTextureAtlasIndex(texture->getAtlasRows() * texture->getAtlasRows() - 1),
 		  m_texturePhaseCount(m_texture->getAtlasRows() * m_texture->getAtlasRows()),
-	      m_usingAdditiveBlending(PARTICLE_GROUP_DEFAULT_USING_ADDITIVE_BLENDING), m_sortParticles(PARTICLE_GROUP_DEFAULT_SORT_PARTICLES)
+		  m_usingAdditiveBlending(PARTICLE_GROUP_DEFAULT_USING_ADDITIVE_BLENDING), m_sortParticles(PARTICLE_GROUP_DEFAULT_SORT_PARTICLES)
 	{
 		m_init();
 	}
 
 	ParticleGroup::ParticleGroup(Texture* texture, const bool additiveBlending)
-		: m_texture(texture), m_startingTextureAtlasIndex(0), m_endingTextureAtlasIndex(texture->getAtlasRows() * texture->getAtlasRows() - 1),
+		: m_particleCount(0), m_capacity(0),
+		  m_texture(texture), m_startingTextureAtlasIndex(0), m_endingTextureAtlasIndex(texture->getAtlasRows() * texture->getAtlasRows() - 1),
 		  m_texturePhaseCount(m_texture->getAtlasRows() * m_texture->getAtlasRows()),
 		  m_usingAdditiveBlending(additiveBlending), m_sortParticles(PARTICLE_GROUP_DEFAULT_SORT_PARTICLES)
 	{
@@ -32,7 +42,8 @@ namespace gg
 	}
 
 	ParticleGroup::ParticleGroup(Texture* texture, const bool additiveBlending, const bool sortParticles)
-		: m_texture(texture), m_startingTextureAtlasIndex(0), m_endingTextureAtlasIndex(texture->getAtlasRows() * texture->getAtlasRows() - 1),
+		: m_particleCount(0), m_capacity(0),
+		  m_texture(texture), m_startingTextureAtlasIndex(0), m_endingTextureAtlasIndex(texture->getAtlasRows() * texture->getAtlasRows() - 1),
 		  m_texturePhaseCount(m_texture->getAtlasRows() * m_texture->getAtlasRows()),
 		  m_usingAdditiveBlending(additiveBlending), m_sortParticles(sortParticles)
 	{
@@ -40,7 +51,8 @@ namespace gg
 	}
 
 	ParticleGroup::ParticleGroup(Texture* texture, const unsigned int startIndex, const unsigned int endIndex)
-		: m_texture(texture), m_startingTextureAtlasIndex(startIndex), m_endingTextureAtlasIndex(endIndex),
+		: m_particleCount(0), m_capacity(0),
+		  m_texture(texture), m_startingTextureAtlasIndex(startIndex), m_endingTextureAtlasIndex(endIndex),
 		  m_texturePhaseCount(m_texture->getAtlasRows() * m_texture->getAtlasRows()),
 		  m_usingAdditiveBlending(PARTICLE_GROUP_DEFAULT_USING_ADDITIVE_BLENDING), m_sortParticles(PARTICLE_GROUP_DEFAULT_SORT_PARTICLES)
 	{
@@ -48,7 +60,8 @@ namespace gg
 	}
 
 	ParticleGroup::ParticleGroup(Texture* texture, const unsigned int startIndex, const unsigned int endIndex, const bool additiveBlending)
-		: m_texture(texture), m_startingTextureAtlasIndex(startIndex), m_endingTextureAtlasIndex(endIndex),
+		: m_particleCount(0), m_capacity(0),
+		  m_texture(texture), m_startingTextureAtlasIndex(startIndex), m_endingTextureAtlasIndex(endIndex),
 		  m_texturePhaseCount(m_texture->getAtlasRows() * m_texture->getAtlasRows()),
 		  m_usingAdditiveBlending(additiveBlending), m_sortParticles(PARTICLE_GROUP_DEFAULT_SORT_PARTICLES)
 	{
@@ -56,29 +69,37 @@ namespace gg
 	}
 
 	ParticleGroup::ParticleGroup(Texture* texture, const unsigned int startIndex, const unsigned int endIndex, const bool additiveBlending, const bool sortParticles)
-		: m_texture(texture), m_startingTextureAtlasIndex(startIndex), m_endingTextureAtlasIndex(endIndex),
-		m_texturePhaseCount(m_texture->getAtlasRows() * m_texture->getAtlasRows()),
-		m_usingAdditiveBlending(additiveBlending), m_sortParticles(sortParticles)
+		: m_particleCount(0), m_capacity(0),
+		  m_texture(texture), m_startingTextureAtlasIndex(startIndex), m_endingTextureAtlasIndex(endIndex),
+		  m_texturePhaseCount(m_texture->getAtlasRows() * m_texture->getAtlasRows()),
+		  m_usingAdditiveBlending(additiveBlending), m_sortParticles(sortParticles)
 	{
 		m_init();
 	}
 
 	/* Functions */
-	void ParticleGroup::update(const Camera3D& cam)
+	void ParticleGroup::update(const Camera3D& cam, const float deltaTime)
 	{
-		for (unsigned int i = 0; i < m_particles.size(); i++)
-		{
-			// Transition Stuff Updating
-			unsigned int phaseCount = m_endingTextureAtlasIndex - m_startingTextureAtlasIndex + 1;
-			m_particles[i].updateTransitionStuff(phaseCount, m_startingTextureAtlasIndex);
+		if (m_particleCount == 0)
+			return;
 
-			// Checking if Particle's Lifetime is Over
-			if (!m_particles[i].update(cam))
-			{
-				// Deleting Particle
-				m_particles.erase(m_particles.begin() + i);
-			}
-		}
+		// Integrating All Particles at Once
+		ParticleKernelData data = {
+			m_positionsX.data(), m_positionsY.data(), m_positionsZ.data(),
+			m_velocitiesX.data(), m_velocitiesY.data(), m_velocitiesZ.data(),
+			m_ages.data(), m_lifetimes.data(), m_gravities.data(),
+			m_textureAtlasIndices.data(), m_distancesFromCamera.data(),
+			m_particleCount
+		};
+
+		ParticleKernelParameters parameters = { deltaTime, cam.getPosition(), m_startingTextureAtlasIndex, m_endingTextureAtlasIndex - m_startingTextureAtlasIndex + 1 };
+
+		m_deadIndices.clear();
+		integrateParticles(data, parameters, m_deadIndices);
+
+		// Deleting Dead Particles
+		if (!m_deadIndices.empty())
+			m_removeDeadParticles();
 
 		// Sorting Particles by Distances From Camera
 		if (m_sortParticles && !m_usingAdditiveBlending)
@@ -88,17 +109,118 @@ namespace gg
 
 	void ParticleGroup::add(const Particle& particle)
 	{
-		m_particles.push_back(particle);
+		// Checking Capacity
+		if (m_capacity == 0)
+			reserve(PARTICLE_GROUP_DEFAULT_CAPACITY);
+
+		if (m_particleCount == m_capacity)
+			return;
+
+		// Storing Particle
+		unsigned int i = m_particleCount++;
+
+		m_positionsX[i] = particle.getPosition().x;
+		m_positionsY[i] = particle.getPosition().y;
+		m_positionsZ[i] = particle.getPosition().z;
+		m_velocitiesX[i] = particle.getVelocity().x;
+		m_velocitiesY[i] = particle.getVelocity().y;
+		m_velocitiesZ[i] = particle.getVelocity().z;
+		m_ages[i] = particle.getTimeAlive();
+		m_lifetimes[i] = particle.getLifetime();
+		m_gravities[i] = particle.getGravity();
+		m_rotations[i] = particle.getRotation();
+		m_scales[i] = particle.getScale();
+		m_textureAtlasIndices[i] = particle.getTextureAtlasIndex();
+		m_distancesFromCamera[i] = 0.0f;
+
+		// Drawing New Particle Last Until Next Sort
+		m_drawOrder[i] = i;
+		m_drawOrderPositions[i] = i;
 	}
 
 	void ParticleGroup::popBack()
 	{
-		m_particles.pop_back();
+		if (m_particleCount == 0)
+			return;
+
+		m_particleCount--;
+
+		// Closing Gap in Draw Order
+		for (unsigned int i = m_drawOrderPositions[m_particleCount]; i < m_particleCount; i++)
+		{
+			m_drawOrder[i] = m_drawOrder[i + 1];
+			m_drawOrderPositions[m_drawOrder[i]] = i;
+		}
+	}
+
+	void ParticleGroup::truncate(const unsigned int count)
+	{
+		if (count >= m_particleCount)
+			return;
+
+		// Removing Truncated Particles from Draw Order (one pass, order of the rest stays)
+		unsigned int keptCount = 0;
+
+		for (unsigned int i = 0; i < m_particleCount; i++)
+		{
+			if (m_drawOrder[i] >= count)
+				continue;
+
+			m_drawOrder[keptCount] = m_drawOrder[i];
+			m_drawOrderPositions[m_drawOrder[keptCount]] = keptCount;
+			keptCount++;
+		}
+
+		m_particleCount = count;
+	}
+
+	void ParticleGroup::clear()
+	{
+		m_particleCount = 0;
 	}
 
 	void ParticleGroup::reserve(const unsigned int amount)
 	{
-		m_particles.reserve(amount);
+		if (amount <= m_capacity)
+			return;
+
+		m_capacity = amount;
+
+		m_positionsX.resize(amount);
+		m_positionsY.resize(amount);
+		m_positionsZ.resize(amount);
+		m_velocitiesX.resize(amount);
+		m_velocitiesY.resize(amount);
+		m_velocitiesZ.resize(amount);
+		m_ages.resize(amount);
+		m_lifetimes.resize(amount);
+		m_gravities.resize(amount);
+		m_rotations.resize(amount);
+		m_scales.resize(amount);
+		m_textureAtlasIndices.resize(amount);
+		m_distancesFromCamera.resize(amount);
+		m_deadIndices.reserve(amount);
+
+		m_drawOrder.resize(amount);
+		m_drawOrderPositions.resize(amount);
+		m_sortKeys.resize(amount);
+		m_sortKeysBuffer.resize(amount);
+		m_drawOrderBuffer.resize(amount);
+	}
+
+
+	void ParticleGroup::reset(Texture* texture, const unsigned int startIndex, const unsigned int endIndex)
+	{
+		clear();
+
+		// Texture Setup
+		m_texture = texture;
+		m_startingTextureAtlasIndex = startIndex;
+		m_endingTextureAtlasIndex = endIndex;
+		m_texturePhaseCount = m_texture->getAtlasRows() * m_texture->getAtlasRows();
+
+		m_textureOffsets.clear();
+		m_init();
 	}
 
 
@@ -120,7 +242,7 @@ namespace gg
 
 	void ParticleGroup::setSortParticles(const bool value)
 	{
-		m_sortParticles = true;
+		m_sortParticles = value;
 	}
 
 	// Private Functions
@@ -152,27 +274,99 @@ namespace gg
 	}
 
 
+	void ParticleGroup::m_copyParticle(const unsigned int from, const unsigned int to)
+	{
+		m_positionsX[to] = m_positionsX[from];
+		m_positionsY[to] = m_positionsY[from];
+		m_positionsZ[to] = m_positionsZ[from];
+		m_velocitiesX[to] = m_velocitiesX[from];
+		m_velocitiesY[to] = m_velocitiesY[from];
+		m_velocitiesZ[to] = m_velocitiesZ[from];
+		m_ages[to] = m_ages[from];
+		m_lifetimes[to] = m_lifetimes[from];
+		m_gravities[to] = m_gravities[from];
+		m_rotations[to] = m_rotations[from];
+		m_scales[to] = m_scales[from];
+		m_textureAtlasIndices[to] = m_textureAtlasIndices[from];
+		m_distancesFromCamera[to] = m_distancesFromCamera[from];
+	}
+
+	void ParticleGroup::m_removeDeadParticles()
+	{
+		// Init
+		unsigned int previousCount = m_particleCount;
+
+		// Deleting Dead Particles (from the back, so particle moved into freed place is always alive)
+		for (unsigned int i = m_deadIndices.size(); i > 0; i--)
+		{
+			unsigned int dead = m_deadIndices[i - 1];
+			m_particleCount--;
+
+			m_drawOrder[m_drawOrderPositions[dead]] = PARTICLE_GROUP_REMOVED_INDEX;
+
+			if (dead != m_particleCount)
+			{
+				m_copyParticle(m_particleCount, dead);
+
+				// Moved Particle Keeps Its Place in Draw Order
+				m_drawOrderPositions[dead] = m_drawOrderPositions[m_particleCount];
+				m_drawOrder[m_drawOrderPositions[dead]] = dead;
+			}
+		}
+
+		// Closing Gaps in Draw Order
+		unsigned int keptCount = 0;
+
+		for (unsigned int i = 0; i < previousCount; i++)
+		{
+			if (m_drawOrder[i] == PARTICLE_GROUP_REMOVED_INDEX)
+				continue;
+
+			m_drawOrder[keptCount] = m_drawOrder[i];
+			m_drawOrderPositions[m_drawOrder[keptCount]] = keptCount;
+			keptCount++;
+		}
+	}
+
 	void ParticleGroup::m_sortParticlesByDistance()
 	{
-		// Insert Sort
-		for (unsigned int i = 0; i < m_particles.size(); i++)
+		// Fixing Last Frame's Order With Insert Sort (particles rarely pass each other between frames, so it's usually close to linear)
+		unsigned int movesLeft = m_particleCount * PARTICLE_GROUP_INSERTION_SORT_MOVE_LIMIT;
+		bool isSorted = true;
+
+		for (unsigned int i = 1; i < m_particleCount && isSorted; i++)
 		{
-			int partitionIndex = 0;
+			unsigned int index = m_drawOrder[i];
+			float distance = m_distancesFromCamera[index];
 
-			for (unsigned int j = i; j > 0; j--)
+			unsigned int j = i;
+			for (; j > 0 && m_distancesFromCamera[m_drawOrder[j - 1]] < distance; j--)
 			{
-				if (m_particles[i - partitionIndex].getDistanceFromCamera() > m_particles[j - 1].getDistanceFromCamera())
+				if (movesLeft == 0)
 				{
-					// Swapping Particles
-					Particle particleCopy = m_particles[i - partitionIndex];
-					m_particles[i - partitionIndex] = m_particles[j - 1];
-					m_particles[j - 1] = particleCopy;
-
-					// Raising Partition Index
-					partitionIndex++;
+					isSorted = false;
+					break;
 				}
+
+				m_drawOrder[j] = m_drawOrder[j - 1];
+				movesLeft--;
 			}
+
+			m_drawOrder[j] = index;
+		}
+
+		// Radix Sort of (Depth Key, Index) Pairs (if order changed too much; stable, so equally distant particles keep last frame's order)
+		if (!isSorted)
+		{
+			for (unsigned int i = 0; i < m_particleCount; i++)
+				m_sortKeys[i] = ~radixKey(m_distancesFromCamera[m_drawOrder[i]]); //inverted, so the furthest comes first
+
+			radixSortPairs(m_sortKeys.data(), m_drawOrder.data(), m_particleCount, m_sortKeysBuffer.data(), m_drawOrderBuffer.data());
 		}
+
+		// Updating Places in Draw Order
+		for (unsigned int i = 0; i < m_particleCount; i++)
+			m_drawOrderPositions[m_drawOrder[i]] = i;
 	}
 
 }
\ No newline at end of file
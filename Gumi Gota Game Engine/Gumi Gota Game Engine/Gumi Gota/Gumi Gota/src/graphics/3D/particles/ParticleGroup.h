@@ -9,6 +9,17 @@
 
 // Header Includes
 #include "Particle.h"
+#include "ParticleKernels.h"
+
+#include "../Camera3D.h"
+
+#include "../../Texture.h"
+
+
+
+/* DEFINITIONS */
+#define PARTICLE_GROUP_DEFAULT_CAPACITY 1000 //used if capacity wasn't reserved before first particle was added
+#define PARTICLE_GROUP_INSERTION_SORT_MOVE_LIMIT 8 //per particle; fixing last frame's order costing more moves than that falls back to radix sort
 
 
 
@@ -19,14 +30,32 @@ namespace gg
 	{
 	private:
 		/* Variables */
-		std::vector<Particle> m_particles;
+		// Particle Arrays (structure of arrays; element i of every array belongs to particle i)
+		std::vector<float> m_positionsX, m_positionsY, m_positionsZ;
+		std::vector<float> m_velocitiesX, m_velocitiesY, m_velocitiesZ;
+		std::vector<float> m_ages, m_lifetimes; //stored in seconds
+		std::vector<float> m_gravities;
+		std::vector<float> m_rotations; //stored in radians
+		std::vector<float> m_scales;
+		std::vector<unsigned int> m_textureAtlasIndices;
+		std::vector<float> m_distancesFromCamera; //squared
+		std::vector<unsigned int> m_deadIndices; //filled by integration kernel every update
+
+		// Draw Order (particles themselves are never moved by sorting)
+		std::vector<unsigned int> m_drawOrder; //particle indices from the furthest to the closest; kept between updates, so sorting starts from last frame's order
+		std::vector<unsigned int> m_drawOrderPositions; //place of every particle in m_drawOrder
+		std::vector<unsigned int> m_sortKeys, m_sortKeysBuffer, m_drawOrderBuffer;
+
+		unsigned int m_particleCount; //alive particles are kept at the front of arrays
+		unsigned int m_capacity; //arrays never grow past it, so updating doesn't allocate
+
 		Texture* m_texture;
 		unsigned int m_startingTextureAtlasIndex, m_endingTextureAtlasIndex;
 		unsigned int m_texturePhaseCount; //tells how many "sub-textures" texture atlas cointains
 		std::vector<vector2> m_textureOffsets; //stores texture offsets for every index of texture atlas
 
 		bool m_usingAdditiveBlending; //if true particles will be rendered using additive blending; if false particles will be rendered normally
-		bool m_sortParticles; //if true partices will be sorted from the closest to the furthest from camera; if false particles will not be sorted (increased performance) if m_usingAdditiveBlending is true, particles will not be sorted anyway
+		bool m_sortParticles; //if true draw order will be sorted from the furthest to the closest to camera; if false particles will not be sorted (increased performance) if m_usingAdditiveBlending is true, particles will not be sorted anyway
 
 	public:
 		/* Constructors */
@@ -38,11 +67,14 @@ namespace gg
 		ParticleGroup(Texture* texture, const unsigned int startIndex, const unsigned int endIndex, const bool additiveBlending, const bool sortParticles);
 
 		/* Functions */
-		void update(const Camera3D& cam);
+		void update(const Camera3D& cam, const float deltaTime); //deltaTime is given in seconds
 
-		void add(const Particle& particle);
+		void add(const Particle& particle); //particle is dropped if group is full
 		void popBack();
-		void reserve(const unsigned int amount);
+		void truncate(const unsigned int count); //removes newest particles, keeping first count of them
+		void clear(); //removes all particles, keeping capacity
+		void reserve(const unsigned int amount); //sets capacity; never shrinks
+		void reset(Texture* texture, const unsigned int startIndex, const unsigned int endIndex); //removes all particles and changes texture; keeps capacity, so recycled groups don't allocate
 
 		void bind() const;
 		static void unbind();
@@ -52,7 +84,16 @@ namespace gg
 		void setSortParticles(const bool value);
 
 		// Getters
-		const std::vector<Particle>& getParticles() const { return m_particles; }
+		unsigned int getParticleCount() const { return m_particleCount; }
+		unsigned int getCapacity() const { return m_capacity; }
+
+		vector3 getPosition(const unsigned int index) const { return vector3(m_positionsX[index], m_positionsY[index], m_positionsZ[index]); }
+		float getRotation(const unsigned int index) const { return m_rotations[index]; }
+		float getScale(const unsigned int index) const { return m_scales[index]; }
+		unsigned int getTextureAtlasIndex(const unsigned int index) const { return m_textureAtlasIndices[index]; }
+
+		const unsigned int* getDrawOrder() const { return m_drawOrder.data(); } //getParticleCount() particle indices, in order they should be rendered
+
 		const std::vector<vector2>& getTextureOffsets() const { return m_textureOffsets; }
 
 		bool usingAdditiveBlending() const { return m_usingAdditiveBlending; }
@@ -64,6 +105,8 @@ namespace gg
 		// Private Functions
 		void m_init();
 
+		void m_copyParticle(const unsigned int from, const unsigned int to);
+		void m_removeDeadParticles();
 		void m_sortParticlesByDistance();
 
 	};
@@ -0,0 +1,227 @@
+
+/* INCLUDES */
+// Self Include
+#include "ParticleKernels.h"
+
+// Normal Includes
+#include <atomic>
+
+// Header Includes
+#include "../../../utils/CPUFeatures.h"
+
+// Intrinsics Includes
+#ifdef GUMIGOTA_X86
+	#include <emmintrin.h>
+	#include <immintrin.h>
+#endif
+
+
+
+namespace gg
+{
+
+	/* ADDITIONAL STUFF */
+	static std::atomic<ParticleKernel> s_kernel(PARTICLE_KERNEL_AUTOMATIC); //resolved on first use; atomic, because first use can be on several scene threads at once
+
+
+
+	/* ADDITIONAL FUNCTIONS */
+	static ParticleKernel s_resolveKernel(const ParticleKernel kernel)
+	{
+		// Choosing Best Supported Kernel Not Better than Requested
+		if ((kernel == PARTICLE_KERNEL_AUTOMATIC || kernel == PARTICLE_KERNEL_AVX2) && cpuSupportsAVX2())
+			return PARTICLE_KERNEL_AVX2;
+
+		if (kernel != PARTICLE_KERNEL_SCALAR && cpuSupportsSSE2())
+			return PARTICLE_KERNEL_SSE2;
+
+		return PARTICLE_KERNEL_SCALAR;
+	}
+
+	static void s_integrateScalar(const ParticleKernelData& data, const ParticleKernelParameters& parameters, const unsigned int first, std::vector<unsigned int>& deadIndices)
+	{
+		const float deltaTime = parameters.deltaTime;
+
+		for (unsigned int i = first; i < data.count; i++)
+		{
+			// Aging
+			float age = data.ages[i] + deltaTime;
+			data.ages[i] = age;
+
+			// Moving
+			data.velocitiesY[i] -= data.gravities[i] * deltaTime;
+
+			data.positionsX[i] += data.velocitiesX[i] * deltaTime;
+			data.positionsY[i] += data.velocitiesY[i] * deltaTime;
+			data.positionsZ[i] += data.velocitiesZ[i] * deltaTime;
+
+			// Distance Calculating
+			float x = data.positionsX[i] - parameters.cameraPosition.x;
+			float y = data.positionsY[i] - parameters.cameraPosition.y;
+			float z = data.positionsZ[i] - parameters.cameraPosition.z;
+			data.distancesFromCamera[i] = x * x + y * y + z * z;
+
+			// Transition Stuff Updating
+			if (age < data.lifetimes[i])
+				data.textureAtlasIndices[i] = parameters.startingTextureAtlasIndex + (unsigned int)(age / data.lifetimes[i] * (float)parameters.phaseCount);
+			else
+				deadIndices.push_back(i);
+		}
+	}
+
+#ifdef GUMIGOTA_X86
+	GUMIGOTA_TARGET_SSE2 static unsigned int s_integrateSSE2(const ParticleKernelData& data, const ParticleKernelParameters& parameters, std::vector<unsigned int>& deadIndices) //returns amount of integrated particles; rest is left for scalar kernel
+	{
+		// Init
+		const __m128 deltaTime = _mm_set1_ps(parameters.deltaTime);
+		const __m128 cameraX = _mm_set1_ps(parameters.cameraPosition.x);
+		const __m128 cameraY = _mm_set1_ps(parameters.cameraPosition.y);
+		const __m128 cameraZ = _mm_set1_ps(parameters.cameraPosition.z);
+		const __m128 phaseCount = _mm_set1_ps((float)parameters.phaseCount);
+		const __m128i startingIndex = _mm_set1_epi32((int)parameters.startingTextureAtlasIndex);
+
+		unsigned int i = 0;
+		for (; i + 4 <= data.count; i += 4)
+		{
+			// Aging
+			__m128 age = _mm_add_ps(_mm_loadu_ps(data.ages + i), deltaTime);
+			__m128 lifetime = _mm_loadu_ps(data.lifetimes + i);
+			_mm_storeu_ps(data.ages + i, age);
+
+			// Moving
+			__m128 velocityY = _mm_sub_ps(_mm_loadu_ps(data.velocitiesY + i), _mm_mul_ps(_mm_loadu_ps(data.gravities + i), deltaTime));
+			_mm_storeu_ps(data.velocitiesY + i, velocityY);
+
+			__m128 positionX = _mm_add_ps(_mm_loadu_ps(data.positionsX + i), _mm_mul_ps(_mm_loadu_ps(data.velocitiesX + i), deltaTime));
+			__m128 positionY = _mm_add_ps(_mm_loadu_ps(data.positionsY + i), _mm_mul_ps(velocityY, deltaTime));
+			__m128 positionZ = _mm_add_ps(_mm_loadu_ps(data.positionsZ + i), _mm_mul_ps(_mm_loadu_ps(data.velocitiesZ + i), deltaTime));
+			_mm_storeu_ps(data.positionsX + i, positionX);
+			_mm_storeu_ps(data.positionsY + i, positionY);
+			_mm_storeu_ps(data.positionsZ + i, positionZ);
+
+			// Distance Calculating
+			__m128 x = _mm_sub_ps(positionX, cameraX);
+			__m128 y = _mm_sub_ps(positionY, cameraY);
+			__m128 z = _mm_sub_ps(positionZ, cameraZ);
+			_mm_storeu_ps(data.distancesFromCamera + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+
+			// Transition Stuff Updating (dead lanes get garbage, they are removed anyway)
+			__m128i atlasIndex = _mm_add_epi32(_mm_cvttps_epi32(_mm_mul_ps(_mm_div_ps(age, lifetime), phaseCount)), startingIndex);
+			_mm_storeu_si128((__m128i*)(data.textureAtlasIndices + i), atlasIndex);
+
+			// Culling
+			int deadMask = _mm_movemask_ps(_mm_cmpnlt_ps(age, lifetime));
+
+			for (unsigned int lane = 0; deadMask != 0; lane++, deadMask >>= 1)
+			{
+				if (deadMask & 1)
+					deadIndices.push_back(i + lane);
+			}
+		}
+
+		return i;
+	}
+
+	GUMIGOTA_TARGET_AVX2 static unsigned int s_integrateAVX2(const ParticleKernelData& data, const ParticleKernelParameters& parameters, std::vector<unsigned int>& deadIndices) //returns amount of integrated particles; rest is left for scalar kernel
+	{
+		// Init
+		const __m256 deltaTime = _mm256_set1_ps(parameters.deltaTime);
+		const __m256 cameraX = _mm256_set1_ps(parameters.cameraPosition.x);
+		const __m256 cameraY = _mm256_set1_ps(parameters.cameraPosition.y);
+		const __m256 cameraZ = _mm256_set1_ps(parameters.cameraPosition.z);
+		const __m256 phaseCount = _mm256_set1_ps((float)parameters.phaseCount);
+		const __m256i startingIndex = _mm256_set1_epi32((int)parameters.startingTextureAtlasIndex);
+
+		unsigned int i = 0;
+		for (; i + 8 <= data.count; i += 8)
+		{
+			// Aging
+			__m256 age = _mm256_add_ps(_mm256_loadu_ps(data.ages + i), deltaTime);
+			__m256 lifetime = _mm256_loadu_ps(data.lifetimes + i);
+			_mm256_storeu_ps(data.ages + i, age);
+
+			// Moving
+			__m256 velocityY = _mm256_sub_ps(_mm256_loadu_ps(data.velocitiesY + i), _mm256_mul_ps(_mm256_loadu_ps(data.gravities + i), deltaTime));
+			_mm256_storeu_ps(data.velocitiesY + i, velocityY);
+
+			__m256 positionX = _mm256_add_ps(_mm256_loadu_ps(data.positionsX + i), _mm256_mul_ps(_mm256_loadu_ps(data.velocitiesX + i), deltaTime));
+			__m256 positionY = _mm256_add_ps(_mm256_loadu_ps(data.positionsY + i), _mm256_mul_ps(velocityY, deltaTime));
+			__m256 positionZ = _mm256_add_ps(_mm256_loadu_ps(data.positionsZ + i), _mm256_mul_ps(_mm256_loadu_ps(data.velocitiesZ + i), deltaTime));
+			_mm256_storeu_ps(data.positionsX + i, positionX);
+			_mm256_storeu_ps(data.positionsY + i, positionY);
+			_mm256_storeu_ps(data.positionsZ + i, positionZ);
+
+			// Distance Calculating
+			__m256 x = _mm256_sub_ps(positionX, cameraX);
+			__m256 y = _mm256_sub_ps(positionY, cameraY);
+			__m256 z = _mm256_sub_ps(positionZ, cameraZ);
+			_mm256_storeu_ps(data.distancesFromCamera + i, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)), _mm256_mul_ps(z, z)));
+
+			// Transition Stuff Updating (dead lanes get garbage, they are removed anyway)
+			__m256i atlasIndex = _mm256_add_epi32(_mm256_cvttps_epi32(_mm256_mul_ps(_mm256_div_ps(age, lifetime), phaseCount)), startingIndex);
+			_mm256_storeu_si256((__m256i*)(data.textureAtlasIndices + i), atlasIndex);
+
+			// Culling
+			int deadMask = _mm256_movemask_ps(_mm256_cmp_ps(age, lifetime, _CMP_NLT_UQ));
+
+			for (unsigned int lane = 0; deadMask != 0; lane++, deadMask >>= 1)
+			{
+				if (deadMask & 1)
+					deadIndices.push_back(i + lane);
+			}
+		}
+
+		return i;
+	}
+#endif
+
+
+
+	/* FUNCTIONS */
+	void integrateParticles(const ParticleKernelData& data, const ParticleKernelParameters& parameters, std::vector<unsigned int>& deadIndices)
+	{
+		unsigned int integrated = 0;
+
+		// Vector Kernels
+#ifdef GUMIGOTA_X86
+		switch (getParticleKernel())
+		{
+		case PARTICLE_KERNEL_AVX2:
+			integrated = s_integrateAVX2(data, parameters, deadIndices);
+			break;
+
+		case PARTICLE_KERNEL_SSE2:
+			integrated = s_integrateSSE2(data, parameters, deadIndices);
+			break;
+
+		default:
+			break;
+
+		}
+#endif
+
+		// Remaining Particles
+		s_integrateScalar(data, parameters, integrated, deadIndices);
+	}
+
+
+	void setParticleKernel(const ParticleKernel kernel)
+	{
+		s_kernel.store(s_resolveKernel(kernel), std::memory_order_release);
+	}
+
+	ParticleKernel getParticleKernel()
+	{
+		ParticleKernel kernel = s_kernel.load(std::memory_order_acquire);
+
+		if (kernel == PARTICLE_KERNEL_AUTOMATIC)
+		{
+			kernel = s_resolveKernel(PARTICLE_KERNEL_AUTOMATIC); //threads racing here all resolve the same kernel
+			s_kernel.store(kernel, std::memory_order_release);
+		}
+
+
+		return kernel;
+	}
+
+}
\ No newline at end of file
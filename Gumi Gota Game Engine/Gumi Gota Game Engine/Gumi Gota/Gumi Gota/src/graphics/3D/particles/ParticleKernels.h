@@ -0,0 +1,59 @@
+#ifndef GUMIGOTA_PARTICLE_KERNELS_H
+#define GUMIGOTA_PARTICLE_KERNELS_H
+
+
+
+/* INCLUDES */
+// Normal Includes
+#include <vector>
+
+// Header Includes
+#include "../../../maths/vectors/vector3.h"
+
+
+
+namespace gg
+{
+
+	/* ADDITIONAL STUFF */
+	enum ParticleKernel
+	{
+		PARTICLE_KERNEL_AUTOMATIC = 0, //best kernel supported by cpu
+		PARTICLE_KERNEL_SCALAR,
+		PARTICLE_KERNEL_SSE2, //4 particles at a time
+		PARTICLE_KERNEL_AVX2  //8 particles at a time
+	};
+
+	struct ParticleKernelData //arrays of ParticleGroup
+	{
+		float* positionsX; float* positionsY; float* positionsZ;
+		float* velocitiesX; float* velocitiesY; float* velocitiesZ;
+		float* ages;
+		const float* lifetimes;
+		const float* gravities;
+		unsigned int* textureAtlasIndices;
+		float* distancesFromCamera; //squared
+		unsigned int count;
+	};
+
+	struct ParticleKernelParameters
+	{
+		float deltaTime;
+		vector3 cameraPosition;
+		unsigned int startingTextureAtlasIndex;
+		unsigned int phaseCount;
+	};
+
+
+
+	/* FUNCTIONS */
+	void integrateParticles(const ParticleKernelData& data, const ParticleKernelParameters& parameters, std::vector<unsigned int>& deadIndices); //ages and moves every particle; appends indices of dead particles in increasing order
+
+	void setParticleKernel(const ParticleKernel kernel); //falls back to scalar kernel if cpu doesn't support chosen one
+	ParticleKernel getParticleKernel(); //kernel that is actually used
+
+}
+
+
+
+#endif
\ No newline at end of file
@@ -9,6 +9,8 @@
 #define PARTICLE_SYSTEM_DEFAULT_USING_ADDITIVE_BLENDING false
 #define PARTICLE_SYSTEM_DEFAULT_SORT_PARTICLES true
 
+#define PARTICLE_SYSTEM_RANDOM_BATCH_SIZE 64 //particles whose random values are generated at once; buffer is on stack, so systems can be used from many threads
+
 
 
 namespace gg
@@ -22,6 +24,32 @@ namespace gg
 	{}
 
 	/* Functions */
+	void ParticleSystem::setupGroup(ParticleGroup& group) const
+	{
+		group.reset(m_texture, m_startingTextureAtlasIndex, m_endingTextureAtlasIndex);
+		group.setUsingAdditiveBlending(m_usingAdditiveBlending);
+		group.setSortParticles(m_sortParticles);
+	}
+
+	void ParticleSystem::addParticles(ParticleGroup& group, const vector3& center, const unsigned int amount)
+	{
+		addParticles(group, center, amount, m_random);
+	}
+
+	void ParticleSystem::addParticles(ParticleGroup& group, const vector3& center, const unsigned int amount, Random& random)
+	{
+		// Checking Capacity
+		if (group.getCapacity() == 0)
+			group.reserve(amount > PARTICLE_GROUP_DEFAULT_CAPACITY ? amount : PARTICLE_GROUP_DEFAULT_CAPACITY);
+
+		unsigned int freeSpace = group.getCapacity() - group.getParticleCount();
+
+		// Generating Particles
+		m_generateParticles(group, center, amount < freeSpace ? amount : freeSpace, random);
+	}
+
+
+	// Setters
 	void ParticleSystem::setStartingTextureAtlasIndex(const unsigned int index)
 	{
 		m_startingTextureAtlasIndex = index;
@@ -46,7 +74,31 @@ namespace gg
 
 	void ParticleSystem::setSortParticles(const bool value)
 	{
-		m_sortParticles = true;
+		m_sortParticles = value;
+	}
+
+
+	void ParticleSystem::setRandomSeed(const unsigned int seed)
+	{
+		m_random.seed(seed);
+	}
+
+	// Protected Functions
+	void ParticleSystem::m_generateParticles(ParticleGroup& group, const vector3& center, const unsigned int amount, Random& random)
+	{
+		float randomValues[PARTICLE_SYSTEM_RANDOM_BATCH_SIZE * PARTICLE_SYSTEM_RANDOM_VALUE_COUNT];
+
+		for (unsigned int first = 0; first < amount; first += PARTICLE_SYSTEM_RANDOM_BATCH_SIZE)
+		{
+			unsigned int batchSize = amount - first < PARTICLE_SYSTEM_RANDOM_BATCH_SIZE ? amount - first : PARTICLE_SYSTEM_RANDOM_BATCH_SIZE;
+
+			// Generating Random Values
+			random.fillSigned(randomValues, batchSize * PARTICLE_SYSTEM_RANDOM_VALUE_COUNT);
+
+			// Generating Particles
+			for (unsigned int i = 0; i < batchSize; i++)
+				group.add(m_generateRandomParticle(center, &randomValues[i * PARTICLE_SYSTEM_RANDOM_VALUE_COUNT]));
+		}
 	}
 
 }
\ No newline at end of file
@@ -6,6 +6,14 @@
 /* INCLUDES */
 // Header Includes
 #include "ParticleGroup.h"
+#include "GPUParticleGroup.h"
+
+#include "../../../utils/Random.h"
+
+
+
+/* DEFINITIONS */
+#define PARTICLE_SYSTEM_RANDOM_VALUE_COUNT 12 //random values generated for every particle, from -1.0 to 1.0
 
 
 
@@ -22,6 +30,8 @@ namespace gg
 		bool m_usingAdditiveBlending; //if true particles from generated groups will be rendered using additive blending; if false particles from generated groups will be rendered using alpha blending
 		bool m_sortParticles; //if true partices will be sorted from the closest to the furthest from camera; if false particles will not be sorted (increased performance) if m_usingAdditiveBlending is true, particles will not be sorted anyway
 
+		Random m_random; //used by generateParticles and addParticles without own generator
+
 	public:
 		/* Contructors */
 		ParticleSystem(Texture* texture);
@@ -29,6 +39,11 @@ namespace gg
 		/* Functions */
 		// Pure Virtual Functions
 		virtual ParticleGroup generateParticles(const vector3& center, const unsigned int amount) = 0; //center is a position where particles are coming from
+		virtual GPUParticleEmitter getGPUEmitter(const vector3& center) const = 0; //parameters of this system for GPUParticleGroup, which generates particles on gpu
+
+		void setupGroup(ParticleGroup& group) const; //clears group and gives it texture and settings of this system; group keeps its capacity
+		void addParticles(ParticleGroup& group, const vector3& center, const unsigned int amount); //adds particles to existing group without copying it; particles that don't fit are dropped
+		void addParticles(ParticleGroup& group, const vector3& center, const unsigned int amount, Random& random); //uses given generator (e.g. emitter's), so spawning doesn't depend on other users of this system
 
 		// Setters
 		void setStartingTextureAtlasIndex(const unsigned int index);
@@ -38,6 +53,16 @@ namespace gg
 		void setUsingAdditiveBlending(const bool value);
 		void setSortParticles(const bool value);
 
+		void setRandomSeed(const unsigned int seed);
+
+		// Getters
+		inline Texture* getTexture() const { return m_texture; }
+
+	protected:
+		// Protected Functions
+		void m_generateParticles(ParticleGroup& group, const vector3& center, const unsigned int amount, Random& random); //random values are generated in batches, then passed to m_generateRandomParticle
+		virtual Particle m_generateRandomParticle(const vector3& pos, const float* randomValues) = 0; //randomValues holds PARTICLE_SYSTEM_RANDOM_VALUE_COUNT values
+
 	};
 
 }
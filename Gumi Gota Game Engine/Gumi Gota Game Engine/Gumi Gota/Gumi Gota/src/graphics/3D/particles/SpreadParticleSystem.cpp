@@ -3,9 +3,6 @@
 // Self Include
 #include "SpreadParticleSystem.h"
 
-// Normal Includes
-#include <stdlib.h>
-
 
 
 /* MACROS */
@@ -22,21 +19,11 @@
 #define SPREAD_PARTICLE_SYSTEM_DEFAULT_LIFETIME_ERROR 0.0f
 #define SPREAD_PARTICLE_SYSTEM_DEFAULT_SCALE_ERROR 0.0f
 
-#define SPREAD_PARTICLE_SYSTEM_ACCURACY_DIVIDER 1000.0f
-
 
 
 namespace gg
 {
 
-	/* ADDITIONAL FUNCTIONS */
-	static float s_randomSign() //generates float with value 1.0 or -1.0 (50/50 chance)
-	{
-		return (rand() % 2 == 0) ? -1.0f : 1.0f;
-	}
-
-
-
 	/* Constructors */
 	SpreadParticleSystem::SpreadParticleSystem(Texture* texture)
 		: ParticleSystem(texture),
@@ -62,18 +49,36 @@ namespace gg
 		result.reserve(amount);
 
 		// Generating Particles
-		for (unsigned int i = 0; i < amount; i++)
-		{
-			Particle particle = m_generateRandomParticle(center);
-
-			result.add(particle);
-		}
+		m_generateParticles(result, center, amount, m_random);
 
 
 		// Finishing
 		return result;
 	}
 
+	GPUParticleEmitter SpreadParticleSystem::getGPUEmitter(const vector3& center) const
+	{
+		GPUParticleEmitter result;
+		result.type = GPU_PARTICLE_EMITTER_SPREAD;
+		result.position = center;
+		result.positionError = m_positionError;
+		result.direction = vector3(0.0f);
+		result.directionError = vector3(0.0f);
+		result.speed = m_speed;
+		result.speedError = m_speedError;
+		result.lifetime = m_lifetime;
+		result.lifetimeError = m_lifetimeError;
+		result.gravity = m_gravity;
+		result.gravityError = m_gravityError;
+		result.rotation = m_rotation;
+		result.rotationError = m_rotationError;
+		result.scale = m_scale;
+		result.scaleError = m_scaleError;
+
+
+		return result;
+	}
+
 
 	// Setters
 	void SpreadParticleSystem::setSpeed(const float speed)
@@ -133,93 +138,19 @@ namespace gg
 	}
 
 	// Private Functions
-	Particle SpreadParticleSystem::m_generateRandomParticle(const vector3& pos)
+	Particle SpreadParticleSystem::m_generateRandomParticle(const vector3& pos, const float* randomValues)
 	{
-		// Start Position Randomizing
-		vector3 randomizedPosition;
-
-		if (m_positionError.x != 0.0f && m_positionError.y != 0.0f && m_positionError.z != 0.0f)
-		{
-			randomizedPosition =
-				vector3
-				(
-					s_randomSign() * (float)(rand() % (int)(m_positionError.x * SPREAD_PARTICLE_SYSTEM_ACCURACY_DIVIDER)) / SPREAD_PARTICLE_SYSTEM_ACCURACY_DIVIDER,
-					s_randomSign() * (float)(rand() % (int)(m_positionError.y * SPREAD_PARTICLE_SYSTEM_ACCURACY_DIVIDER)) / SPREAD_PARTICLE_SYSTEM_ACCURACY_DIVIDER,
-					s_randomSign() * (float)(rand() % (int)(m_positionError.z * SPREAD_PARTICLE_SYSTEM_ACCURACY_DIVIDER)) / SPREAD_PARTICLE_SYSTEM_ACCURACY_DIVIDER
-				)
-				+ pos;
-		}
-		else
-		{
-			randomizedPosition = pos;
-		}
-
-		// Speed Randomizing
-		float randomizedSpeed;
-
-		if (m_rotationError != 0.0f)
-		{
-			randomizedSpeed = s_randomSign() * (float)(rand() % (int)(m_speedError * SPREAD_PARTICLE_SYSTEM_ACCURACY_DIVIDER)) / SPREAD_PARTICLE_SYSTEM_ACCURACY_DIVIDER + m_speed;
-		}
-		else
-		{
-			randomizedSpeed = m_speed;
-		}
-
-		// Rotation Randomizing
-		float randomizedRotation;
-
-		if (m_rotationError != 0.0f)
-		{
-			randomizedRotation = s_randomSign() * (float)(rand() % (int)(m_rotationError * SPREAD_PARTICLE_SYSTEM_ACCURACY_DIVIDER)) / SPREAD_PARTICLE_SYSTEM_ACCURACY_DIVIDER + m_rotation;
-		}
-		else
-		{
-			randomizedRotation = m_rotation;
-		}
-
-		// Gravity Randomizing
-		float randomizedGravity;
-
-		if (m_gravityError != 0.0f)
-		{
-			randomizedGravity = s_randomSign() * (float)(rand() % (int)(m_gravityError * SPREAD_PARTICLE_SYSTEM_ACCURACY_DIVIDER)) / SPREAD_PARTICLE_SYSTEM_ACCURACY_DIVIDER + m_gravity;
-		}
-		else
-		{
-			randomizedGravity = m_gravity;
-		}
-
-		// Lifetime Randomizing
-		float randomizedLifetime;
-
-		if (m_lifetimeError != 0.0f)
-		{
-			randomizedLifetime = s_randomSign() * (float)(rand() % (int)(m_lifetimeError * SPREAD_PARTICLE_SYSTEM_ACCURACY_DIVIDER)) / SPREAD_PARTICLE_SYSTEM_ACCURACY_DIVIDER + m_lifetime;
-		}
-		else
-		{
-			randomizedLifetime = m_lifetime;
-		}
-
-		// Scale Randomizing
-		float randomizedScale;
-
-		if (m_scaleError != 0.0f)
-		{
-			randomizedScale = s_randomSign() * (float)(rand() % (int)(m_scaleError * SPREAD_PARTICLE_SYSTEM_ACCURACY_DIVIDER)) / SPREAD_PARTICLE_SYSTEM_ACCURACY_DIVIDER + m_scale;
-		}
-		else
-		{
-			randomizedScale = m_scale;
-		}
-
-		// Direction Randomizings
-		vector3 randomizedDirection(
-			((float)(rand() % (int)(SPREAD_PARTICLE_SYSTEM_ACCURACY_DIVIDER) * 2) / SPREAD_PARTICLE_SYSTEM_ACCURACY_DIVIDER - 1.0f) * randomizedSpeed,
-			((float)(rand() % (int)(SPREAD_PARTICLE_SYSTEM_ACCURACY_DIVIDER) * 2) / SPREAD_PARTICLE_SYSTEM_ACCURACY_DIVIDER - 1.0f) * randomizedSpeed,
-			((float)(rand() % (int)(SPREAD_PARTICLE_SYSTEM_ACCURACY_DIVIDER) * 2) / SPREAD_PARTICLE_SYSTEM_ACCURACY_DIVIDER - 1.0f) * randomizedSpeed
-		);
+		// Randomizing (every value is moved by up to its error in both directions)
+		vector3 randomizedPosition = pos + m_positionError * vector3(randomValues[0], randomValues[1], randomValues[2]);
+
+		float randomizedSpeed = m_speed + m_speedError * randomValues[3];
+		float randomizedRotation = m_rotation + m_rotationError * randomValues[4];
+		float randomizedGravity = m_gravity + m_gravityError * randomValues[5];
+		float randomizedLifetime = m_lifetime + m_lifetimeError * randomValues[6];
+		float randomizedScale = m_scale + m_scaleError * randomValues[7];
+
+		// Direction Randomizing
+		vector3 randomizedDirection = vector3(randomValues[8], randomValues[9], randomValues[10]) * randomizedSpeed;
 
 		// Finishing
 		Particle result(randomizedPosition, randomizedDirection, randomizedLifetime);
@@ -3,28 +3,193 @@
 // Self Include
 #include "Font.h"
 
-// OpenGL Includes
-#include "GL/glew.h"
+// Normal Includes
+#include <vector>
 
 // Header Includes
-#include "Error Handling.h"
+#include "../Log.h"
 
 
 
 namespace gg
 {
 
+	/* ADDITIONAL STUFF */
+	static FT_Library s_library = nullptr;
+	static unsigned int s_fontCount = 0; //library is released with last font
+
+	static TextureAtlas* s_glyphAtlas = nullptr; //created with first glyph, so it's not created before opengl context
+
+
+
 	/* Constructors */
-	Font::Font(const char* filename)
-		: m_atlas(ftgl::texture_atlas_new(512, 512, 1)), m_font(ftgl::texture_font_new_from_file(m_atlas, 20, filename))
+	Font::Font(const std::string& filepath, const float size)
+		: m_face(nullptr), m_size(size), m_isSDF(false), m_scale(1.0f),
+		  m_ascender(0.0f), m_descender(0.0f), m_lineHeight(0.0f)
+	{
+		m_loadFace(filepath);
+	}
+
+	Font::Font(const std::string& filepath, const float size, const bool isSDF)
+		: m_face(nullptr), m_size(size), m_isSDF(isSDF), m_scale(1.0f),
+		  m_ascender(0.0f), m_descender(0.0f), m_lineHeight(0.0f)
+	{
+		m_loadFace(filepath);
+	}
+
+	/* Destructor */
+	Font::~Font()
 	{
-		ftgl::texture_font_get_glyph(m_font, "Kappa");
+		if (m_face != nullptr)
+			FT_Done_Face(m_face);
+
+		// Releasing Library
+		s_fontCount--;
+
+		if (s_fontCount == 0)
+		{
+			FT_Done_FreeType(s_library);
+			s_library = nullptr;
+		}
 	}
 
 	/* Functions */
-	void Font::bindFontTexture() const
+	const FontGlyph& Font::getGlyph(const unsigned int codepoint)
 	{
-		GLcall(glBindTexture(GL_TEXTURE_2D, m_atlas->id));
+		// Checking Cache
+		std::unordered_map<unsigned int, FontGlyph>::const_iterator cached = m_glyphs.find(codepoint);
+		if (cached != m_glyphs.end())
+			return cached->second;
+
+		// Init
+		FontGlyph& glyph = m_glyphs[codepoint];
+		glyph.region = nullptr;
+		glyph.offset = vector2(0.0f, 0.0f);
+		glyph.size = vector2(0.0f, 0.0f);
+		glyph.advance = 0.0f;
+
+		if (m_face == nullptr)
+			return glyph;
+
+		// Loading Glyph
+		if (FT_Load_Glyph(m_face, FT_Get_Char_Index(m_face, codepoint), FT_LOAD_DEFAULT) != 0)
+		{
+			LOG("[Warning] Couldn't load glyph " << codepoint << ".");
+			return glyph;
+		}
+
+		// Rasterizing
+		FT_Render_Mode renderMode = FT_RENDER_MODE_NORMAL;
+#if FREETYPE_MAJOR > 2 || (FREETYPE_MAJOR == 2 && FREETYPE_MINOR >= 11)
+		if (m_isSDF)
+			renderMode = FT_RENDER_MODE_SDF;
+#endif
+
+		if (FT_Render_Glyph(m_face->glyph, renderMode) != 0)
+		{
+			LOG("[Warning] Couldn't render glyph " << codepoint << ".");
+			return glyph;
+		}
+
+		const FT_GlyphSlot slot = m_face->glyph;
+		const FT_Bitmap& bitmap = slot->bitmap;
+
+		glyph.advance = (slot->advance.x / 64.0f) * m_scale;
+
+		// Adding Bitmap to Atlas
+		if (bitmap.width > 0 && bitmap.rows > 0)
+		{
+			std::vector<unsigned char> pixels(bitmap.width * bitmap.rows * 4);
+			unsigned int pitch = bitmap.pitch < 0 ? -bitmap.pitch : bitmap.pitch;
+
+			for (unsigned int row = 0; row < bitmap.rows; row++)
+			{
+				// Flipping Rows (atlas rows go from bottom to top, like loaded images)
+				unsigned int sourceRow = bitmap.pitch < 0 ? row : bitmap.rows - 1 - row;
+				const unsigned char* source = bitmap.buffer + sourceRow * pitch;
+
+				for (unsigned int column = 0; column < bitmap.width; column++)
+				{
+					unsigned char* destination = &pixels[(row * bitmap.width + column) * 4];
+
+					destination[0] = 255;
+					destination[1] = 255;
+					destination[2] = 255;
+					destination[3] = source[column]; //coverage, or distance to edge for sdf
+				}
+			}
+
+			glyph.region = getGlyphAtlas().add(pixels.data(), bitmap.width, bitmap.rows);
+			glyph.offset = vector2((float)slot->bitmap_left, (float)slot->bitmap_top - (float)bitmap.rows) * m_scale;
+			glyph.size = vector2((float)bitmap.width, (float)bitmap.rows) * m_scale;
+		}
+
+
+		return glyph;
+	}
+
+	float Font::getKerning(const unsigned int left, const unsigned int right) const
+	{
+		if (m_face == nullptr || !FT_HAS_KERNING(m_face))
+			return 0.0f;
+
+		FT_Vector kerning;
+		FT_Get_Kerning(m_face, FT_Get_Char_Index(m_face, left), FT_Get_Char_Index(m_face, right), FT_KERNING_DEFAULT, &kerning);
+
+
+		return (kerning.x / 64.0f) * m_scale;
+	}
+
+
+	TextureAtlas& Font::getGlyphAtlas()
+	{
+		if (s_glyphAtlas == nullptr)
+			s_glyphAtlas = new TextureAtlas(); //never deleted; opengl context is gone at static destruction time
+
+		return *s_glyphAtlas;
+	}
+
+	// Private Functions
+	void Font::m_loadFace(const std::string& filepath)
+	{
+		// Library Setup
+		if (s_library == nullptr && FT_Init_FreeType(&s_library) != 0)
+		{
+			LOG("[Error] Couldn't initialize FreeType.");
+			s_library = nullptr;
+		}
+
+		s_fontCount++;
+
+		// Loading Face
+		if (s_library == nullptr || FT_New_Face(s_library, filepath.c_str(), 0, &m_face) != 0)
+		{
+			LOG("[Error] Couldn't load font '" << filepath << "'.");
+			m_face = nullptr;
+			return;
+		}
+
+#if !(FREETYPE_MAJOR > 2 || (FREETYPE_MAJOR == 2 && FREETYPE_MINOR >= 11))
+		if (m_isSDF)
+		{
+			LOG("[Warning] FreeType is too old for sdf glyphs; font '" << filepath << "' uses normal glyphs.");
+			m_isSDF = false;
+		}
+#endif
+
+		// Size Setup
+		unsigned int rasterizedSize = m_isSDF ? FONT_SDF_SIZE : (unsigned int)(m_size + 0.5f);
+		if (rasterizedSize == 0)
+			rasterizedSize = 1;
+
+		FT_Set_Pixel_Sizes(m_face, 0, rasterizedSize);
+
+		m_scale = m_size / rasterizedSize;
+
+		// Metrics
+		m_ascender = (m_face->size->metrics.ascender / 64.0f) * m_scale;
+		m_descender = (m_face->size->metrics.descender / 64.0f) * m_scale;
+		m_lineHeight = (m_face->size->metrics.height / 64.0f) * m_scale;
 	}
 
 }
\ No newline at end of file
@@ -6,35 +6,77 @@
 /* INCLUDES */
 // Normal Includes
 #include <string>
+#include <unordered_map>
 
 // FreeType Includes
 #include <ft2build.h>
 #include FT_FREETYPE_H
 
-// FreeType-GL Includes
-#include "../../vendor/freetype-gl/freetype-gl-master/freetype-gl.h"
+// Header Includes
+#include "TextureAtlas.h"
+
+
+
+/* DEFINITIONS */
+#define FONT_SDF_SIZE 48 //pixel size sdf glyphs are rasterized at; other sizes are scaled from it
 
 
 
 namespace gg
 {
 
-	class Font
+	/* ADDITIONAL STUFF */
+	struct FontGlyph
+	{
+		const TextureAtlasRegion* region; //nullptr for glyphs without bitmap (e.g. space)
+		vector2 offset; //from pen position to bottom left corner of bitmap, in pixels of font size
+		vector2 size;
+		float advance;
+	};
+
+
+
+	class Font //rasterizes glyphs on demand into atlas shared by all fonts
 	{
 	private:
 		/* Variables */
-		ftgl::texture_atlas_t* m_atlas;
-		ftgl::texture_font_t* m_font;
+		FT_Face m_face;
+
+		float m_size;
+		bool m_isSDF;
+		float m_scale; //from rasterized size to font size
+
+		float m_ascender, m_descender, m_lineHeight; //in pixels of font size
+
+		std::unordered_map<unsigned int, FontGlyph> m_glyphs; //cache; key is unicode codepoint
 
 	public:
 		/* Constructors */
-		Font(const char* filename);
-		
+		Font(const std::string& filepath, const float size);
+		Font(const std::string& filepath, const float size, const bool isSDF); //sdf glyphs are rasterized at FONT_SDF_SIZE and stay sharp when scaled to font size; every font still caches its own glyphs
+
+		Font(const Font&) = delete; //font owns its face and is counted for releasing library, copies would release them twice
+		Font& operator=(const Font&) = delete;
+
+		/* Destructor */
+		~Font();
+
 		/* Functions */
-		void bindFontTexture() const;
+		const FontGlyph& getGlyph(const unsigned int codepoint); //rasterizes glyph on first use
+		float getKerning(const unsigned int left, const unsigned int right) const;
+
+		static TextureAtlas& getGlyphAtlas();
 
 		// Getters
-		inline const unsigned int& getTextureID() const { return m_atlas->id; } /// consider removing l8r
+		inline float getSize()       const { return m_size;       }
+		inline bool  isSDF()         const { return m_isSDF;      }
+		inline float getAscender()   const { return m_ascender;   }
+		inline float getDescender()  const { return m_descender;  }
+		inline float getLineHeight() const { return m_lineHeight; }
+
+	private:
+		// Private Functions
+		void m_loadFace(const std::string& filepath);
 
 	};
 
@@ -0,0 +1,340 @@
+
+/* INCLUDES */
+// Self Include
+#include "GLStateCache.h"
+
+// OpenGL Includes
+#include <GL/glew.h>
+
+// Header Includes
+#include "ErrorHandling.h"
+
+#include "../Log.h"
+
+
+
+/* MACROS */
+#define GL_STATE_CACHE_UNKNOWN 0xFFFFFFFF
+
+
+
+namespace gg
+{
+
+	/* ADDITIONAL STUFF */
+	// Bindings
+	static unsigned int s_program = GL_STATE_CACHE_UNKNOWN;
+	static unsigned int s_vao = GL_STATE_CACHE_UNKNOWN;
+	static unsigned int s_fbo = GL_STATE_CACHE_UNKNOWN;
+
+	static unsigned int s_activeTextureUnit = GL_STATE_CACHE_UNKNOWN;
+	static unsigned int s_textures2D[GL_STATE_CACHE_TEXTURE_UNITS];
+	static unsigned int s_cubeMaps[GL_STATE_CACHE_TEXTURE_UNITS];
+
+	// Capabilities (-1 = unknown)
+	static int s_blend = -1;
+	static int s_depthTest = -1;
+	static int s_depthMask = -1;
+	static int s_cullFace = -1;
+
+	static unsigned int s_blendSource = GL_STATE_CACHE_UNKNOWN;
+	static unsigned int s_blendDestination = GL_STATE_CACHE_UNKNOWN;
+	static unsigned int s_depthFunc = GL_STATE_CACHE_UNKNOWN;
+	static unsigned int s_cullFaceMode = GL_STATE_CACHE_UNKNOWN;
+
+	static int s_viewport[4];
+	static bool s_viewportKnown = false;
+
+	static float s_clearColor[4];
+	static bool s_clearColorKnown = false;
+
+	static bool s_texturesInitialized = false; //arrays can't be filled with unknown value statically
+
+
+
+	/* ADDITIONAL FUNCTIONS */
+	static unsigned int* s_getTextureArray(const unsigned int target)
+	{
+		// Initializing Arrays
+		if (!s_texturesInitialized)
+		{
+			for (unsigned int i = 0; i < GL_STATE_CACHE_TEXTURE_UNITS; i++)
+			{
+				s_textures2D[i] = GL_STATE_CACHE_UNKNOWN;
+				s_cubeMaps[i] = GL_STATE_CACHE_UNKNOWN;
+			}
+
+			s_texturesInitialized = true;
+		}
+
+		// Getting Array of Target
+		if (target == GL_TEXTURE_2D)
+			return s_textures2D;
+		else if (target == GL_TEXTURE_CUBE_MAP)
+			return s_cubeMaps;
+
+		return nullptr; //other targets aren't cached
+	}
+
+	static void s_setCapability(const unsigned int capability, const bool enabled, int& cached)
+	{
+		if (cached == (enabled ? 1 : 0))
+			return;
+
+		if (enabled)
+		{
+			GLcall(glEnable(capability));
+		}
+		else
+		{
+			GLcall(glDisable(capability));
+		}
+
+		cached = enabled ? 1 : 0;
+	}
+
+
+
+	/* Functions */
+	void GLStateCache::invalidate()
+	{
+		s_program = GL_STATE_CACHE_UNKNOWN;
+		s_vao = GL_STATE_CACHE_UNKNOWN;
+		s_fbo = GL_STATE_CACHE_UNKNOWN;
+
+		s_activeTextureUnit = GL_STATE_CACHE_UNKNOWN;
+		s_texturesInitialized = false;
+
+		s_blend = -1;
+		s_depthTest = -1;
+		s_depthMask = -1;
+		s_cullFace = -1;
+
+		s_blendSource = GL_STATE_CACHE_UNKNOWN;
+		s_blendDestination = GL_STATE_CACHE_UNKNOWN;
+		s_depthFunc = GL_STATE_CACHE_UNKNOWN;
+		s_cullFaceMode = GL_STATE_CACHE_UNKNOWN;
+
+		s_viewportKnown = false;
+		s_clearColorKnown = false;
+	}
+
+	// Binding Functions
+	void GLStateCache::useProgram(const unsigned int program)
+	{
+		if (s_program == program)
+			return;
+
+		GLcall(glUseProgram(program));
+		s_program = program;
+	}
+
+	void GLStateCache::bindVertexArray(const unsigned int vao)
+	{
+		if (s_vao == vao)
+			return;
+
+		GLcall(glBindVertexArray(vao));
+		s_vao = vao;
+	}
+
+	void GLStateCache::bindTexture(const unsigned int slot, const unsigned int target, const unsigned int texture)
+	{
+		if (slot >= GL_STATE_CACHE_TEXTURE_UNITS)
+		{
+			LOG("[Error] Texture Slot is out of range.");
+			return;
+		}
+
+		// Checking Bound Texture
+		unsigned int* textures = s_getTextureArray(target);
+		if (textures != nullptr && textures[slot] == texture)
+			return;
+
+		// Activating Unit
+		if (s_activeTextureUnit != slot)
+		{
+			GLcall(glActiveTexture(GL_TEXTURE0 + slot));
+			s_activeTextureUnit = slot;
+		}
+
+		// Binding
+		GLcall(glBindTexture(target, texture));
+
+		if (textures != nullptr)
+			textures[slot] = texture;
+	}
+
+	void GLStateCache::bindTexture(const unsigned int target, const unsigned int texture)
+	{
+		// Finding Active Unit
+		if (s_activeTextureUnit == GL_STATE_CACHE_UNKNOWN)
+		{
+			int activeTexture = GL_TEXTURE0;
+			GLcall(glGetIntegerv(GL_ACTIVE_TEXTURE, &activeTexture));
+
+			s_activeTextureUnit = activeTexture - GL_TEXTURE0;
+		}
+
+		bindTexture(s_activeTextureUnit, target, texture);
+	}
+
+	void GLStateCache::bindFramebuffer(const unsigned int fbo)
+	{
+		if (s_fbo == fbo)
+			return;
+
+		GLcall(glBindFramebuffer(GL_FRAMEBUFFER, fbo));
+		s_fbo = fbo;
+	}
+
+	// State Functions
+	void GLStateCache::setBlend(const bool enabled)
+	{
+		s_setCapability(GL_BLEND, enabled, s_blend);
+	}
+
+	void GLStateCache::setBlendFunc(const unsigned int source, const unsigned int destination)
+	{
+		if (s_blendSource == source && s_blendDestination == destination)
+			return;
+
+		GLcall(glBlendFunc(source, destination));
+		s_blendSource = source;
+		s_blendDestination = destination;
+	}
+
+
+	void GLStateCache::setDepthTest(const bool enabled)
+	{
+		s_setCapability(GL_DEPTH_TEST, enabled, s_depthTest);
+	}
+
+	void GLStateCache::setDepthFunc(const unsigned int function)
+	{
+		if (s_depthFunc == function)
+			return;
+
+		GLcall(glDepthFunc(function));
+		s_depthFunc = function;
+	}
+
+	void GLStateCache::setDepthMask(const bool enabled)
+	{
+		if (s_depthMask == (enabled ? 1 : 0))
+			return;
+
+		GLcall(glDepthMask(enabled ? GL_TRUE : GL_FALSE));
+		s_depthMask = enabled ? 1 : 0;
+	}
+
+
+	void GLStateCache::setCullFace(const bool enabled)
+	{
+		s_setCapability(GL_CULL_FACE, enabled, s_cullFace);
+	}
+
+	void GLStateCache::setCullFaceMode(const unsigned int mode)
+	{
+		if (s_cullFaceMode == mode)
+			return;
+
+		GLcall(glCullFace(mode));
+		s_cullFaceMode = mode;
+	}
+
+
+	void GLStateCache::setViewport(const int x, const int y, const int width, const int height)
+	{
+		if (s_viewportKnown && s_viewport[0] == x && s_viewport[1] == y && s_viewport[2] == width && s_viewport[3] == height)
+			return;
+
+		GLcall(glViewport(x, y, width, height));
+
+		s_viewport[0] = x;
+		s_viewport[1] = y;
+		s_viewport[2] = width;
+		s_viewport[3] = height;
+		s_viewportKnown = true;
+	}
+
+	void GLStateCache::setClearColor(const float r, const float g, const float b, const float a)
+	{
+		if (s_clearColorKnown && s_clearColor[0] == r && s_clearColor[1] == g && s_clearColor[2] == b && s_clearColor[3] == a)
+			return;
+
+		GLcall(glClearColor(r, g, b, a));
+
+		s_clearColor[0] = r;
+		s_clearColor[1] = g;
+		s_clearColor[2] = b;
+		s_clearColor[3] = a;
+		s_clearColorKnown = true;
+	}
+
+	// Deletion Functions
+	void GLStateCache::onProgramDeleted(const unsigned int program)
+	{
+		if (s_program == program)
+			s_program = GL_STATE_CACHE_UNKNOWN;
+	}
+
+	void GLStateCache::onVertexArrayDeleted(const unsigned int vao)
+	{
+		if (s_vao == vao)
+			s_vao = GL_STATE_CACHE_UNKNOWN;
+	}
+
+	void GLStateCache::onTextureDeleted(const unsigned int texture)
+	{
+		if (!s_texturesInitialized)
+			return;
+
+		for (unsigned int i = 0; i < GL_STATE_CACHE_TEXTURE_UNITS; i++)
+		{
+			if (s_textures2D[i] == texture)
+				s_textures2D[i] = GL_STATE_CACHE_UNKNOWN;
+
+			if (s_cubeMaps[i] == texture)
+				s_cubeMaps[i] = GL_STATE_CACHE_UNKNOWN;
+		}
+	}
+
+	void GLStateCache::onFramebufferDeleted(const unsigned int fbo)
+	{
+		if (s_fbo == fbo)
+			s_fbo = GL_STATE_CACHE_UNKNOWN;
+	}
+
+	// Getters
+	void GLStateCache::getViewport(int* viewport)
+	{
+		// Querying Driver Only Once
+		if (!s_viewportKnown)
+		{
+			GLcall(glGetIntegerv(GL_VIEWPORT, s_viewport));
+			s_viewportKnown = true;
+		}
+
+		viewport[0] = s_viewport[0];
+		viewport[1] = s_viewport[1];
+		viewport[2] = s_viewport[2];
+		viewport[3] = s_viewport[3];
+	}
+
+	void GLStateCache::getClearColor(float* color)
+	{
+		// Querying Driver Only Once
+		if (!s_clearColorKnown)
+		{
+			GLcall(glGetFloatv(GL_COLOR_CLEAR_VALUE, s_clearColor));
+			s_clearColorKnown = true;
+		}
+
+		color[0] = s_clearColor[0];
+		color[1] = s_clearColor[1];
+		color[2] = s_clearColor[2];
+		color[3] = s_clearColor[3];
+	}
+
+}
\ No newline at end of file
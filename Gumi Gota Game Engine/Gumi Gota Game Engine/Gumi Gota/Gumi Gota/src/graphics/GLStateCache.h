@@ -0,0 +1,57 @@
+#ifndef GUMIGOTA_GLSTATECACHE_H
+#define GUMIGOTA_GLSTATECACHE_H
+
+
+
+/* DEFINITIONS */
+#define GL_STATE_CACHE_TEXTURE_UNITS 32
+
+
+
+namespace gg
+{
+
+	class GLStateCache //shadows OpenGL state, so binding something that is already bound doesn't reach the driver
+	{
+	public:
+		/* Functions */
+		static void invalidate(); //forgets all shadowed state; has to be called after changing state without the cache (e.g. by external library)
+
+		// Binding Functions
+		static void useProgram(const unsigned int program);
+		static void bindVertexArray(const unsigned int vao);
+		static void bindTexture(const unsigned int slot, const unsigned int target, const unsigned int texture);
+		static void bindTexture(const unsigned int target, const unsigned int texture); //binds to currently active texture unit
+		static void bindFramebuffer(const unsigned int fbo);
+
+		// State Functions
+		static void setBlend(const bool enabled);
+		static void setBlendFunc(const unsigned int source, const unsigned int destination);
+
+		static void setDepthTest(const bool enabled);
+		static void setDepthFunc(const unsigned int function);
+		static void setDepthMask(const bool enabled);
+
+		static void setCullFace(const bool enabled);
+		static void setCullFaceMode(const unsigned int mode);
+
+		static void setViewport(const int x, const int y, const int width, const int height);
+		static void setClearColor(const float r, const float g, const float b, const float a);
+
+		// Deletion Functions (OpenGL reuses names of deleted objects, so they can't stay in the cache)
+		static void onProgramDeleted(const unsigned int program);
+		static void onVertexArrayDeleted(const unsigned int vao);
+		static void onTextureDeleted(const unsigned int texture);
+		static void onFramebufferDeleted(const unsigned int fbo);
+
+		// Getters
+		static void getViewport(int* viewport); //viewport has to have 4 elements; driver is queried only if viewport wasn't set through the cache
+		static void getClearColor(float* color); //color has to have 4 elements; same rules as getViewport
+
+	};
+
+}
+
+
+
+#endif
\ No newline at end of file
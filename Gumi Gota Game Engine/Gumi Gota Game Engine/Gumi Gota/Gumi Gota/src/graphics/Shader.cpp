@@ -9,116 +9,608 @@
 // Normal Includes
 #include <fstream>
 #include <sstream>
+#include <cstring>
+
+#ifdef _WIN32
+	#include <direct.h>
+#else
+	#include <sys/stat.h>
+#endif
 
 // Header Includes
 #include "ErrorHandling.h"
+#include "GLStateCache.h"
 
 #include "../Log.h"
 
 
 
+/* MACROS */
+#define SHADER_BINARY_CACHE_MAGIC	  0x42504747 //"GGPB"
+#define SHADER_BINARY_CACHE_EXTENSION ".bin"
+#define SHADER_BINARY_CACHE_DIRECTORY "shader cache" //default, kept out of source directories
+
+
+
 namespace gg
 {
 
+	/* ADDITIONAL STUFF */
+	static std::unordered_map<unsigned long long, ShaderProgramBinary> s_programRegistry; //linked programs of the whole process, keyed by source hash
+	static bool s_binaryCacheEnabled = true;
+	static std::string s_binaryCacheDirectory = SHADER_BINARY_CACHE_DIRECTORY;
+	static bool s_binaryCacheDirectoryCreated = false;
+
+	static std::unordered_map<std::string, ShaderProgramSource> s_parsedSources; //filepath -> parsed file, so shaders used by more layers and renderers are read only once
+
+	static std::unordered_map<std::string, unsigned int> s_uniformHandles; //uniform name -> handle, shared by all shaders
+	static std::vector<std::string> s_uniformNames; //handle -> uniform name
+
+	static const int s_unresolvedLocation = -2; //location of handle that wasn't found in program yet
+
+
+
+	/* ADDITIONAL FUNCTIONS */
+	static unsigned long long s_hashSource(const ShaderProgramSource& source)
+	{
+		// FNV-1a (std::hash isn't guaranteed to be the same between runs, so it can't be used for the cache files)
+		unsigned long long hash = 14695981039346656037ULL;
+
+		for (char c : source.vertexSource)
+		{
+			hash ^= (unsigned char)c;
+			hash *= 1099511628211ULL;
+		}
+
+		hash ^= 0xFF; //separator, so moving text between the stages changes the hash
+		hash *= 1099511628211ULL;
+
+		for (char c : source.fragmentSource)
+		{
+			hash ^= (unsigned char)c;
+			hash *= 1099511628211ULL;
+		}
+
+		return hash;
+	}
+
+	static bool s_programBinarySupported()
+	{
+		static int supported = -1; //checked once, after OpenGL is initialized
+
+		if (supported == -1)
+		{
+			int formatCount = 0;
+
+			if (GLEW_VERSION_4_1 || GLEW_ARB_get_program_binary)
+			{
+				GLcall(glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount));
+			}
+
+			supported = formatCount > 0 ? 1 : 0;
+		}
+
+		return supported == 1;
+	}
+
+	static std::string s_getDriverString()
+	{
+		const char* vendor = (const char*)glGetString(GL_VENDOR);
+		const char* renderer = (const char*)glGetString(GL_RENDERER);
+		const char* version = (const char*)glGetString(GL_VERSION);
+
+		return std::string(vendor ? vendor : "") + "|" + (renderer ? renderer : "") + "|" + (version ? version : "");
+	}
+
+
+	static bool s_loadBinaryFromFile(const std::string& filepath, const unsigned long long hash, ShaderProgramBinary& binary)
+	{
+		std::ifstream stream(filepath, std::ios::binary);
+		if (!stream.is_open())
+			return false;
+
+		// Header
+		unsigned int magic = 0;
+		unsigned long long fileHash = 0;
+		unsigned int driverLength = 0;
+
+		stream.read((char*)&magic, sizeof(magic));
+		stream.read((char*)&fileHash, sizeof(fileHash));
+		stream.read((char*)&driverLength, sizeof(driverLength));
+
+		if (!stream || magic != SHADER_BINARY_CACHE_MAGIC || fileHash != hash || driverLength > 1024)
+			return false;
+
+		std::string driver(driverLength, '\0');
+		stream.read(&driver[0], driverLength);
+
+		if (!stream || driver != s_getDriverString())
+		{
+			LOG("[Info] Shader binary cache '" << filepath << "' was created by a different driver, recompiling");
+			return false;
+		}
+
+		// Binary
+		unsigned int length = 0;
+
+		stream.read((char*)&binary.format, sizeof(binary.format));
+		stream.read((char*)&length, sizeof(length));
+
+		binary.data.resize(length);
+		stream.read(binary.data.data(), length);
+
+
+		return (bool)stream;
+	}
+
+	static void s_saveBinaryToFile(const std::string& filepath, const unsigned long long hash, const ShaderProgramBinary& binary)
+	{
+		// Creating Cache Directory
+		if (!s_binaryCacheDirectoryCreated)
+		{
+#ifdef _WIN32
+			_mkdir(s_binaryCacheDirectory.c_str());
+#else
+			mkdir(s_binaryCacheDirectory.c_str(), 0755);
+#endif
+			s_binaryCacheDirectoryCreated = true; //fails if directory already exists, which is fine
+		}
+
+		std::ofstream stream(filepath, std::ios::binary | std::ios::trunc);
+		if (!stream.is_open())
+		{
+			LOG("[Warning] Couldn't write shader binary cache '" << filepath << "'");
+			return;
+		}
+
+		// Header
+		unsigned int magic = SHADER_BINARY_CACHE_MAGIC;
+		std::string driver = s_getDriverString();
+		unsigned int driverLength = driver.size();
+
+		stream.write((const char*)&magic, sizeof(magic));
+		stream.write((const char*)&hash, sizeof(hash));
+		stream.write((const char*)&driverLength, sizeof(driverLength));
+		stream.write(driver.data(), driverLength);
+
+		// Binary
+		unsigned int length = binary.data.size();
+
+		stream.write((const char*)&binary.format, sizeof(binary.format));
+		stream.write((const char*)&length, sizeof(length));
+		stream.write(binary.data.data(), length);
+	}
+
+
+
 	/* Constructors */
 	Shader::Shader(const std::string& filepath)
 		: m_filepath(filepath)
 	{
 		ShaderProgramSource source = m_parseShader(filepath);
-		m_programID = m_createShader(source.vertexSource, source.fragmentSource);
+		m_programID = m_loadProgram(source);
+
+		m_reflectUniforms();
+	}
+
+	Shader::Shader(const std::string& filepath, const std::string& defines)
+		: m_filepath(filepath), m_defines(defines)
+	{
+		ShaderProgramSource source = m_parseShader(filepath);
+		m_injectDefines(source.vertexSource);
+		m_injectDefines(source.fragmentSource);
+
+		m_programID = m_loadProgram(source);
+
+		m_reflectUniforms();
+	}
+
+	Shader::Shader(const std::string& filepath, const std::vector<std::string>& feedbackVaryings)
+		: m_filepath(filepath), m_feedbackVaryings(feedbackVaryings)
+	{
+		ShaderProgramSource source = m_parseShader(filepath);
+		m_programID = m_loadProgram(source);
+
+		m_reflectUniforms();
 	}
 
 	/* Destructor */
 	Shader::~Shader()
 	{
 		GLcall(glDeleteProgram(m_programID));
+		GLStateCache::onProgramDeleted(m_programID);
 	}
 
 	/* Functions */
 	void Shader::start() const
 	{
-		GLcall(glUseProgram(m_programID));
+		GLStateCache::useProgram(m_programID);
 	}
 
 	void Shader::stop()
 	{
-		GLcall(glUseProgram(0));
+		GLStateCache::useProgram(0);
+	}
+
+
+	void Shader::setBinaryCacheEnabled(const bool value)
+	{
+		s_binaryCacheEnabled = value;
+	}
+
+	void Shader::setBinaryCacheDirectory(const std::string& directory)
+	{
+		s_binaryCacheDirectory = directory;
+		s_binaryCacheDirectoryCreated = false;
 	}
 
 	// Uniform Functions
+	unsigned int Shader::getUniformHandle(const std::string& name)
+	{
+		// Finding Existing Handle
+		std::unordered_map<std::string, unsigned int>::const_iterator handle = s_uniformHandles.find(name);
+		if (handle != s_uniformHandles.end())
+			return handle->second;
+
+		// Creating New Handle
+		unsigned int newHandle = s_uniformNames.size();
+
+		s_uniformHandles[name] = newHandle;
+		s_uniformNames.push_back(name);
+
+
+		return newHandle;
+	}
+
+	std::vector<unsigned int> Shader::getUniformArrayHandles(const std::string& name, const unsigned int count)
+	{
+		std::vector<unsigned int> handles;
+		handles.reserve(count);
+
+		for (unsigned int i = 0; i < count; i++)
+			handles.push_back(getUniformHandle(name + "[" + std::to_string(i) + "]"));
+
+		return handles;
+	}
+
+	bool Shader::hasUniform(const unsigned int handle) const
+	{
+		return handle < m_uniformLocations.size() && m_uniformLocations[handle] >= 0;
+	}
+
+
 	void Shader::setUniform1i(const std::string& name, const int value)
 	{
-		GLcall(glUniform1i(m_getUniformLocation(name), value));
+		setUniform1i(getUniformHandle(name), value);
 	}
 
 
 	void Shader::setUniform1f(const std::string& name, const float value)
 	{
-		GLcall(glUniform1f(m_getUniformLocation(name), value));
+		setUniform1f(getUniformHandle(name), value);
 	}
 
 	void Shader::setUniform2f(const std::string& name, const float v0, const float v1)
 	{
-		GLcall(glUniform2f(m_getUniformLocation(name), v0, v1));
+		setUniform2f(getUniformHandle(name), v0, v1);
 	}
 
 	void Shader::setUniform2f(const std::string& name, const vector2& values)
 	{
-		GLcall(glUniform2f(m_getUniformLocation(name), values.x, values.y));
+		setUniform2f(getUniformHandle(name), values.x, values.y);
 	}
 
 	void Shader::setUniform3f(const std::string& name, const float v0, const float v1, const float v2)
 	{
-		GLcall(glUniform3f(m_getUniformLocation(name), v0, v1, v2));
+		setUniform3f(getUniformHandle(name), v0, v1, v2);
 	}
 
 	void Shader::setUniform3f(const std::string& name, const vector3& values)
 	{
-		GLcall(glUniform3f(m_getUniformLocation(name), values.x, values.y, values.z));
+		setUniform3f(getUniformHandle(name), values.x, values.y, values.z);
 	}
 
 	void Shader::setUniform3f(const std::string& name, const Color& values)
 	{
-		GLcall(glUniform3f(m_getUniformLocation(name), values.r, values.g, values.b));
+		setUniform3f(getUniformHandle(name), values.r, values.g, values.b);
 	}
 
 	void Shader::setUniform4f(const std::string& name, const float v0, const float v1, const float v2, const float v3)
 	{
-		GLcall(glUniform4f(m_getUniformLocation(name), v0, v1, v2, v3));
+		setUniform4f(getUniformHandle(name), v0, v1, v2, v3);
 	}
 
 	void Shader::setUniform4f(const std::string& name, const vector4& values)
 	{
-		GLcall(glUniform4f(m_getUniformLocation(name), values.x, values.y, values.z, values.w));
+		setUniform4f(getUniformHandle(name), values.x, values.y, values.z, values.w);
 	}
 
 	void Shader::setUniform4f(const std::string& name, const Color& values)
 	{
-		GLcall(glUniform4f(m_getUniformLocation(name), values.r, values.g, values.b, values.a));
+		setUniform4f(getUniformHandle(name), values.r, values.g, values.b, values.a);
 	}
 
 
 	void Shader::setUniformMatrix4f(const std::string& name, const matrix4& mat)
 	{
-		GLcall(glUniformMatrix4fv(m_getUniformLocation(name), 1, GL_FALSE, mat.elements));
+		setUniformMatrix4f(getUniformHandle(name), mat);
+	}
+
+
+	void Shader::setUniform1i(const unsigned int handle, const int value)
+	{
+		float values[1];
+		std::memcpy(values, &value, sizeof(int)); //stored bitwise, it's only compared
+
+		if (m_uniformValueChanged(handle, values, 1))
+		{
+			GLcall(glUniform1i(m_getUniformLocation(handle), value));
+		}
+	}
+
+
+	void Shader::setUniform1f(const unsigned int handle, const float value)
+	{
+		if (m_uniformValueChanged(handle, &value, 1))
+		{
+			GLcall(glUniform1f(m_getUniformLocation(handle), value));
+		}
+	}
+
+	void Shader::setUniform2f(const unsigned int handle, const float v0, const float v1)
+	{
+		float values[] = { v0, v1 };
+
+		if (m_uniformValueChanged(handle, values, 2))
+		{
+			GLcall(glUniform2f(m_getUniformLocation(handle), v0, v1));
+		}
+	}
+
+	void Shader::setUniform2f(const unsigned int handle, const vector2& values)
+	{
+		setUniform2f(handle, values.x, values.y);
+	}
+
+	void Shader::setUniform3f(const unsigned int handle, const float v0, const float v1, const float v2)
+	{
+		float values[] = { v0, v1, v2 };
+
+		if (m_uniformValueChanged(handle, values, 3))
+		{
+			GLcall(glUniform3f(m_getUniformLocation(handle), v0, v1, v2));
+		}
+	}
+
+	void Shader::setUniform3f(const unsigned int handle, const vector3& values)
+	{
+		setUniform3f(handle, values.x, values.y, values.z);
+	}
+
+	void Shader::setUniform3f(const unsigned int handle, const Color& values)
+	{
+		setUniform3f(handle, values.r, values.g, values.b);
+	}
+
+	void Shader::setUniform4f(const unsigned int handle, const float v0, const float v1, const float v2, const float v3)
+	{
+		float values[] = { v0, v1, v2, v3 };
+
+		if (m_uniformValueChanged(handle, values, 4))
+		{
+			GLcall(glUniform4f(m_getUniformLocation(handle), v0, v1, v2, v3));
+		}
+	}
+
+	void Shader::setUniform4f(const unsigned int handle, const vector4& values)
+	{
+		setUniform4f(handle, values.x, values.y, values.z, values.w);
+	}
+
+	void Shader::setUniform4f(const unsigned int handle, const Color& values)
+	{
+		setUniform4f(handle, values.r, values.g, values.b, values.a);
+	}
+
+
+	void Shader::setUniformMatrix4f(const unsigned int handle, const matrix4& mat)
+	{
+		if (m_uniformValueChanged(handle, mat.elements, 16))
+		{
+			GLcall(glUniformMatrix4fv(m_getUniformLocation(handle), 1, GL_FALSE, mat.elements));
+		}
 	}
 
 	// Private Functions
-	int Shader::m_getUniformLocation(const std::string& name)
+	int Shader::m_getUniformLocation(const unsigned int handle)
 	{
-		if (m_uniformLocationCache.find(name) != m_uniformLocationCache.end())
-			return m_uniformLocationCache[name];
+		// Checking if Location is Known
+		if (handle < m_uniformLocations.size() && m_uniformLocations[handle] != s_unresolvedLocation)
+			return m_uniformLocations[handle];
+
+		if (handle >= m_uniformLocations.size())
+			m_uniformLocations.resize(handle + 1, s_unresolvedLocation);
 
-		int location = glGetUniformLocation(m_programID, name.c_str());
+		// Resolving Location (all active uniforms were found at link time, so this is only reached once per missing uniform)
+		int location = glGetUniformLocation(m_programID, s_uniformNames[handle].c_str());
 		if (location == -1)
-			LOG("[Warning] Uniform '" << name << "', in file '" << m_filepath << "' doesn't exist!");
+			LOG("[Warning] Uniform '" << s_uniformNames[handle] << "', in file '" << m_filepath << "' doesn't exist!");
 
-		m_uniformLocationCache[name] = location;
+		m_uniformLocations[handle] = location;
 
 
 		return location;
 	}
 
+	bool Shader::m_uniformValueChanged(const unsigned int handle, const float* values, const unsigned int count)
+	{
+		// Missing Uniforms Never Get Uploaded
+		if (m_getUniformLocation(handle) == -1)
+			return false;
+
+		if (handle >= m_uniformValueOffsets.size())
+			m_uniformValueOffsets.resize(handle + 1, -1);
+
+		// First Upload
+		if (m_uniformValueOffsets[handle] == -1)
+		{
+			m_uniformValueOffsets[handle] = m_uniformValues.size();
+			m_uniformValues.insert(m_uniformValues.end(), values, values + count);
+
+			return true;
+		}
+
+		// Comparing with Last Uploaded Value (bitwise, so ints stored in floats work too)
+		float* cached = &m_uniformValues[m_uniformValueOffsets[handle]];
+
+		if (std::memcmp(cached, values, count * sizeof(float)) == 0)
+			return false;
+
+		std::memcpy(cached, values, count * sizeof(float));
+
+
+		return true;
+	}
+
+	void Shader::m_reflectUniforms()
+	{
+		if (m_programID == 0)
+			return;
+
+		// Getting Active Uniforms
+		int uniformCount = 0;
+		int maxNameLength = 0;
+		GLcall(glGetProgramiv(m_programID, GL_ACTIVE_UNIFORMS, &uniformCount));
+		GLcall(glGetProgramiv(m_programID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength));
+
+		std::vector<char> nameBuffer(maxNameLength + 1);
+
+		for (int i = 0; i < uniformCount; i++)
+		{
+			int nameLength = 0;
+			int size = 0;
+			unsigned int type = 0;
+			GLcall(glGetActiveUniform(m_programID, i, nameBuffer.size(), &nameLength, &size, &type, nameBuffer.data()));
+
+			std::string name(nameBuffer.data(), nameLength);
+
+			// Registering Uniform
+			if (size > 1 || (name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0)) // Array
+			{
+				std::string baseName = name.substr(0, name.find('['));
+
+				for (int element = 0; element < size; element++)
+				{
+					std::string elementName = baseName + "[" + std::to_string(element) + "]";
+					unsigned int handle = getUniformHandle(elementName);
+
+					if (handle >= m_uniformLocations.size())
+						m_uniformLocations.resize(handle + 1, s_unresolvedLocation);
+
+					m_uniformLocations[handle] = glGetUniformLocation(m_programID, elementName.c_str());
+				}
+
+				// Base Name Refers to First Element
+				unsigned int baseHandle = getUniformHandle(baseName);
+
+				if (baseHandle >= m_uniformLocations.size())
+					m_uniformLocations.resize(baseHandle + 1, s_unresolvedLocation);
+
+				m_uniformLocations[baseHandle] = m_uniformLocations[getUniformHandle(baseName + "[0]")];
+			}
+			else
+			{
+				unsigned int handle = getUniformHandle(name);
+
+				if (handle >= m_uniformLocations.size())
+					m_uniformLocations.resize(handle + 1, s_unresolvedLocation);
+
+				m_uniformLocations[handle] = glGetUniformLocation(m_programID, name.c_str());
+			}
+		}
+	}
+
+
+	unsigned int Shader::m_loadProgram(const ShaderProgramSource& source)
+	{
+		// Checking Support
+		if (!s_programBinarySupported())
+			return m_createShader(source.vertexSource, source.fragmentSource);
+
+		ShaderProgramSource hashedSource = source;
+		for (const std::string& varying : m_feedbackVaryings)
+			hashedSource.vertexSource += "\n" + varying; //captured varyings are part of linked program
+
+		unsigned long long hash = s_hashSource(hashedSource);
+
+		// Program Already Linked by This Process
+		std::unordered_map<unsigned long long, ShaderProgramBinary>::const_iterator registered = s_programRegistry.find(hash);
+		if (registered != s_programRegistry.end())
+		{
+			unsigned int program = m_createProgramFromBinary(registered->second);
+			if (program != 0)
+				return program;
+		}
+
+		// Program Cached on Disk
+		ShaderProgramBinary binary;
+		std::string cacheFilepath = m_getCacheFilepath();
+
+		if (s_binaryCacheEnabled && s_loadBinaryFromFile(cacheFilepath, hash, binary))
+		{
+			unsigned int program = m_createProgramFromBinary(binary);
+			if (program != 0)
+			{
+				s_programRegistry[hash] = binary;
+
+				return program;
+			}
+		}
+
+		// Compiling Program
+		unsigned int program = m_createShader(source.vertexSource, source.fragmentSource);
+		if (program == 0)
+			return 0;
+
+		// Retrieving Binary
+		int length = 0;
+		GLcall(glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length));
+
+		if (length > 0)
+		{
+			binary.data.resize(length);
+			GLcall(glGetProgramBinary(program, length, nullptr, &binary.format, binary.data.data()));
+
+			s_programRegistry[hash] = binary;
+
+			if (s_binaryCacheEnabled)
+				s_saveBinaryToFile(cacheFilepath, hash, binary);
+		}
+
+
+		return program;
+	}
+
+	unsigned int Shader::m_createProgramFromBinary(const ShaderProgramBinary& binary)
+	{
+		// Creating Program
+		unsigned int program = glCreateProgram();
+		GLcall(glProgramBinary(program, binary.format, binary.data.data(), binary.data.size()));
+
+		// Error Handling
+		int result = 0;
+		GLcall(glGetProgramiv(program, GL_LINK_STATUS, &result));
+
+		if (result == GL_FALSE) //driver rejected the binary (e.g. after an update), so program has to be compiled
+		{
+			GLcall(glDeleteProgram(program));
+
+			return 0;
+		}
+
+		return program;
+	}
+
 
 	unsigned int Shader::m_compileShader(const unsigned int type, const std::string& source)
 	{
@@ -152,11 +644,30 @@ namespace gg
 		// Compiling Shaders
 		unsigned int program = glCreateProgram();
 		unsigned int vs = m_compileShader(GL_VERTEX_SHADER, vertexShader);
-		unsigned int fs = m_compileShader(GL_FRAGMENT_SHADER, fragmentShader);
+		unsigned int fs = fragmentShader.empty() ? 0 : m_compileShader(GL_FRAGMENT_SHADER, fragmentShader); //transform feedback programs don't need fragment stage
 
 		// Creating Program
 		GLcall(glAttachShader(program, vs));
-		GLcall(glAttachShader(program, fs));
+		if (fs != 0)
+		{
+			GLcall(glAttachShader(program, fs));
+		}
+
+		// Transform Feedback Setup (has to be done before linking)
+		if (!m_feedbackVaryings.empty())
+		{
+			std::vector<const char*> varyings;
+			for (const std::string& varying : m_feedbackVaryings)
+				varyings.push_back(varying.c_str());
+
+			GLcall(glTransformFeedbackVaryings(program, varyings.size(), varyings.data(), GL_INTERLEAVED_ATTRIBS));
+		}
+
+		if (s_programBinarySupported())
+		{
+			GLcall(glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE));
+		}
+
 		GLcall(glLinkProgram(program));
 		GLcall(glValidateProgram(program));
 
@@ -175,13 +686,21 @@ namespace gg
 
 		// Deleting Shaders
 		GLcall(glDeleteShader(vs));
-		GLcall(glDeleteShader(fs));
+		if (fs != 0)
+		{
+			GLcall(glDeleteShader(fs));
+		}
 
 		return program;
 	}
 
 	ShaderProgramSource Shader::m_parseShader(const std::string& filepath)
 	{
+		// File Already Parsed
+		std::unordered_map<std::string, ShaderProgramSource>::const_iterator parsed = s_parsedSources.find(filepath);
+		if (parsed != s_parsedSources.end())
+			return parsed->second;
+
 		std::ifstream stream(filepath);
 
 		enum class ShaderType
@@ -209,7 +728,43 @@ namespace gg
 			}
 		}
 
-		return { ss[0].str(), ss[1].str() };
+		ShaderProgramSource source = { ss[0].str(), ss[1].str() };
+		s_parsedSources[filepath] = source;
+
+		return source;
+	}
+
+	void Shader::m_injectDefines(std::string& source) const
+	{
+		if (m_defines.empty())
+			return;
+
+		// Finding Version Line (it has to stay first, so defines go right after it)
+		size_t position = 0;
+		size_t version = source.find("#version");
+
+		if (version != std::string::npos)
+		{
+			position = source.find('\n', version);
+			position = (position == std::string::npos) ? source.size() : position + 1;
+		}
+
+		// Inserting Defines
+		source.insert(position, m_defines);
+	}
+
+	std::string Shader::m_getCacheFilepath() const
+	{
+		// File Name Without Directories
+		size_t separator = m_filepath.find_last_of("/\\");
+		std::string name = (separator == std::string::npos) ? m_filepath : m_filepath.substr(separator + 1);
+
+		// Every Shader File and Variant Gets Its Own File (hash of full path keeps same names in different directories apart)
+		ShaderProgramSource keySource = { m_filepath, m_defines };
+		std::stringstream ss;
+		ss << s_binaryCacheDirectory << "/" << name << "." << std::hex << s_hashSource(keySource) << SHADER_BINARY_CACHE_EXTENSION;
+
+		return ss.str();
 	}
 
 }
\ No newline at end of file
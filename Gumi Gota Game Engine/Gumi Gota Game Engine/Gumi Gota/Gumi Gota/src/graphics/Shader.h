@@ -7,6 +7,7 @@
 // Normal Includes
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 // Header Includes
 #include "../maths/vectors/vector2.h"
@@ -28,6 +29,12 @@ namespace gg
 		std::string fragmentSource;
 	};
 
+	struct ShaderProgramBinary //linked program in driver specific format, used for skipping compilation
+	{
+		unsigned int format;
+		std::vector<char> data;
+	};
+
 
 
 	class Shader
@@ -35,12 +42,18 @@ namespace gg
 	private:
 		/* Variables */
 		std::string m_filepath;
+		std::string m_defines; //injected after '#version' line of every stage
+		std::vector<std::string> m_feedbackVaryings; //vertex outputs captured by transform feedback (interleaved, in this order)
 		unsigned int m_programID;
-		std::unordered_map<std::string, int> m_uniformLocationCache;
+		std::vector<int> m_uniformLocations; //indexed by uniform handle; filled at link time from active uniforms
+		std::vector<int> m_uniformValueOffsets; //indexed by uniform handle; offset of last uploaded value in m_uniformValues, -1 if not uploaded yet
+		std::vector<float> m_uniformValues;
 
 	public:
 		/* Constructors */
 		Shader(const std::string& filepath);
+		Shader(const std::string& filepath, const std::string& defines); //defines are lines like '#define NAME VALUE', used for compiling variants of one source
+		Shader(const std::string& filepath, const std::vector<std::string>& feedbackVaryings); //transform feedback program; fragment stage can be left out of the file
 
 		/* Destructor */
 		~Shader();
@@ -49,7 +62,14 @@ namespace gg
 		void start() const;
 		static void stop();
 
+		static void setBinaryCacheEnabled(const bool value); //if enabled, linked programs are saved in cache directory and loaded on next start instead of compiling
+		static void setBinaryCacheDirectory(const std::string& directory); //created if it doesn't exist; relative to working directory
+
 		// Uniform Functions
+		static unsigned int getUniformHandle(const std::string& name); //handles are the same for every shader, so they can be resolved once at init and used on the hot path without hashing
+		static std::vector<unsigned int> getUniformArrayHandles(const std::string& name, const unsigned int count); //handles of elements name[0] - name[count - 1]
+		bool hasUniform(const unsigned int handle) const; //true if uniform is active in this program (variants strip unused ones)
+
 		void setUniform1i(const std::string& name, const int value);
 
 		void setUniform1f(const std::string& name, const float value);
@@ -64,13 +84,34 @@ namespace gg
 
 		void setUniformMatrix4f(const std::string& name, const matrix4& mat);
 
+		void setUniform1i(const unsigned int handle, const int value);
+
+		void setUniform1f(const unsigned int handle, const float value);
+		void setUniform2f(const unsigned int handle, const float v0, const float v1);
+		void setUniform2f(const unsigned int handle, const vector2& values);
+		void setUniform3f(const unsigned int handle, const float v0, const float v1, const float v2);
+		void setUniform3f(const unsigned int handle, const vector3& values);
+		void setUniform3f(const unsigned int handle, const Color& values);
+		void setUniform4f(const unsigned int handle, const float v0, const float v1, const float v2, const float v3);
+		void setUniform4f(const unsigned int handle, const vector4& values);
+		void setUniform4f(const unsigned int handle, const Color& values);
+
+		void setUniformMatrix4f(const unsigned int handle, const matrix4& mat);
+
 	private:
 		// Private Functions
-		int m_getUniformLocation(const std::string& name);
+		int m_getUniformLocation(const unsigned int handle);
+		bool m_uniformValueChanged(const unsigned int handle, const float* values, const unsigned int count); //stores value and returns true if it differs from the last uploaded one
+		void m_reflectUniforms();
+
+		unsigned int m_loadProgram(const ShaderProgramSource& source);
+		unsigned int m_createProgramFromBinary(const ShaderProgramBinary& binary);
 
 		unsigned int m_compileShader(const unsigned int type, const std::string& source);
 		unsigned int m_createShader(const std::string& vertexShader, const std::string& fragmentShader);
 		ShaderProgramSource m_parseShader(const std::string& filepath);
+		void m_injectDefines(std::string& source) const;
+		std::string m_getCacheFilepath() const;
 
 	};
 
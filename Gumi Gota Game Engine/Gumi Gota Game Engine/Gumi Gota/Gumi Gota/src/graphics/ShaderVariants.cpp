@@ -0,0 +1,162 @@
+
+/* INCLUDES */
+// Self Include
+#include "ShaderVariants.h"
+
+
+
+namespace gg
+{
+
+	/* Constructors */
+	ShaderVariants::ShaderVariants(const std::string& filepath, const std::vector<std::string>& featureDefines, const std::string& countDefine)
+		: m_filepath(filepath), m_featureDefines(featureDefines), m_countDefine(countDefine)
+	{}
+
+	/* Destructor */
+	ShaderVariants::~ShaderVariants()
+	{
+		for (std::pair<const unsigned long long, Shader*>& variant : m_variants)
+		{
+			delete variant.second;
+		}
+	}
+
+	/* Functions */
+	Shader& ShaderVariants::get(const unsigned int features, const unsigned int count)
+	{
+		// Finding Existing Variant
+		unsigned long long key = ((unsigned long long)count << 32) | features;
+
+		std::unordered_map<unsigned long long, Shader*>::const_iterator variant = m_variants.find(key);
+		if (variant != m_variants.end())
+			return *variant->second;
+
+		// Preparing Defines
+		std::string defines;
+
+		for (unsigned int i = 0; i < m_featureDefines.size(); i++)
+		{
+			if (features & (1 << i))
+				defines += "#define " + m_featureDefines[i] + "\n";
+		}
+
+		if (!m_countDefine.empty())
+			defines += "#define " + m_countDefine + " " + std::to_string(count) + "\n";
+
+		// Compiling Variant
+		Shader* shader = new Shader(m_filepath, defines);
+		m_variants[key] = shader;
+
+		// Loading Persistent Uniforms
+		shader->start();
+
+		for (const ShaderVariantUniform& uniform : m_persistentUniforms)
+			m_applyUniform(*shader, uniform);
+
+		Shader::stop();
+
+
+		return *shader;
+	}
+
+	// Persistent Uniform Functions
+	void ShaderVariants::setUniform1i(const unsigned int handle, const int value)
+	{
+		ShaderVariantUniform uniform = { handle, 0, value, { 0.0f, 0.0f, 0.0f, 0.0f } };
+		m_setPersistentUniform(uniform);
+	}
+
+
+	void ShaderVariants::setUniform1f(const unsigned int handle, const float value)
+	{
+		ShaderVariantUniform uniform = { handle, 1, 0, { value, 0.0f, 0.0f, 0.0f } };
+		m_setPersistentUniform(uniform);
+	}
+
+	void ShaderVariants::setUniform2f(const unsigned int handle, const vector2& values)
+	{
+		ShaderVariantUniform uniform = { handle, 2, 0, { values.x, values.y, 0.0f, 0.0f } };
+		m_setPersistentUniform(uniform);
+	}
+
+	void ShaderVariants::setUniform3f(const unsigned int handle, const vector3& values)
+	{
+		ShaderVariantUniform uniform = { handle, 3, 0, { values.x, values.y, values.z, 0.0f } };
+		m_setPersistentUniform(uniform);
+	}
+
+	void ShaderVariants::setUniform3f(const unsigned int handle, const Color& values)
+	{
+		ShaderVariantUniform uniform = { handle, 3, 0, { values.r, values.g, values.b, 0.0f } };
+		m_setPersistentUniform(uniform);
+	}
+
+	void ShaderVariants::setUniform4f(const unsigned int handle, const vector4& values)
+	{
+		ShaderVariantUniform uniform = { handle, 4, 0, { values.x, values.y, values.z, values.w } };
+		m_setPersistentUniform(uniform);
+	}
+
+	// Private Functions
+	void ShaderVariants::m_setPersistentUniform(const ShaderVariantUniform& uniform)
+	{
+		// Remembering Value
+		if (uniform.handle >= m_persistentUniformIndices.size())
+			m_persistentUniformIndices.resize(uniform.handle + 1, -1);
+
+		if (m_persistentUniformIndices[uniform.handle] == -1)
+		{
+			m_persistentUniformIndices[uniform.handle] = m_persistentUniforms.size();
+			m_persistentUniforms.push_back(uniform);
+		}
+		else
+		{
+			m_persistentUniforms[m_persistentUniformIndices[uniform.handle]] = uniform;
+		}
+
+		// Setting Value in Compiled Variants
+		for (std::pair<const unsigned long long, Shader*>& variant : m_variants)
+		{
+			if (!variant.second->hasUniform(uniform.handle))
+				continue;
+
+			variant.second->start();
+			m_applyUniform(*variant.second, uniform);
+		}
+
+		Shader::stop();
+	}
+
+	void ShaderVariants::m_applyUniform(Shader& shader, const ShaderVariantUniform& uniform)
+	{
+		if (!shader.hasUniform(uniform.handle))
+			return; //variant doesn't use this uniform
+
+		switch (uniform.componentCount)
+		{
+
+		case 0:
+			shader.setUniform1i(uniform.handle, uniform.intValue);
+			break;
+
+		case 1:
+			shader.setUniform1f(uniform.handle, uniform.values[0]);
+			break;
+
+		case 2:
+			shader.setUniform2f(uniform.handle, uniform.values[0], uniform.values[1]);
+			break;
+
+		case 3:
+			shader.setUniform3f(uniform.handle, uniform.values[0], uniform.values[1], uniform.values[2]);
+			break;
+
+		case 4:
+			shader.setUniform4f(uniform.handle, uniform.values[0], uniform.values[1], uniform.values[2], uniform.values[3]);
+			break;
+
+		}
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,76 @@
+#ifndef GUMIGOTA_SHADERVARIANTS_H
+#define GUMIGOTA_SHADERVARIANTS_H
+
+
+
+/* INCLUDES */
+// Normal Includes
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+// Header Includes
+#include "Shader.h"
+
+
+
+namespace gg
+{
+
+	/* ADDITIONAL STUFF */
+	struct ShaderVariantUniform //uniform value remembered by variants, so lazily compiled variants get it too
+	{
+		unsigned int handle;
+		unsigned int componentCount; //0 for int uniforms
+		int intValue;
+		float values[4];
+	};
+
+
+
+	class ShaderVariants
+	{
+	private:
+		/* Variables */
+		std::string m_filepath;
+		std::vector<std::string> m_featureDefines; //bit i of features mask enables '#define m_featureDefines[i]'
+		std::string m_countDefine; //define that gets the count passed to get(), e.g. '#define LIGHT_COUNT 8'
+
+		std::unordered_map<unsigned long long, Shader*> m_variants;
+		std::vector<ShaderVariantUniform> m_persistentUniforms;
+		std::vector<int> m_persistentUniformIndices; //indexed by uniform handle; -1 if uniform wasn't set
+
+	public:
+		/* Constructors */
+		ShaderVariants(const std::string& filepath, const std::vector<std::string>& featureDefines, const std::string& countDefine);
+
+		/* Destructor */
+		~ShaderVariants();
+
+		/* Functions */
+		Shader& get(const unsigned int features, const unsigned int count); //compiles variant on first use
+
+		// Persistent Uniform Functions (set on every variant, including ones compiled later)
+		void setUniform1i(const unsigned int handle, const int value);
+
+		void setUniform1f(const unsigned int handle, const float value);
+		void setUniform2f(const unsigned int handle, const vector2& values);
+		void setUniform3f(const unsigned int handle, const vector3& values);
+		void setUniform3f(const unsigned int handle, const Color& values);
+		void setUniform4f(const unsigned int handle, const vector4& values);
+
+		// Getters
+		inline unsigned int getVariantCount() const { return m_variants.size(); }
+
+	private:
+		// Private Functions
+		void m_setPersistentUniform(const ShaderVariantUniform& uniform);
+		static void m_applyUniform(Shader& shader, const ShaderVariantUniform& uniform);
+
+	};
+
+}
+
+
+
+#endif
\ No newline at end of file
@@ -11,6 +11,7 @@
 
 // Header Includes
 #include "ErrorHandling.h"
+#include "GLStateCache.h"
 
 #include "../Log.h"
 
@@ -40,35 +41,35 @@ namespace gg
 		  m_atlasRows(1)
 	{}
 
+	Texture::Texture(Texture&& other)
+		: m_textureID(other.m_textureID),
+		  m_width(other.m_width), m_height(other.m_height),
+		  m_atlasRows(other.m_atlasRows)
+	{
+		other.m_textureID = 0; //deleting texture 0 is ignored by opengl
+	}
+
 	/* Destructor */
 	Texture::~Texture()
 	{
 		GLcall(glDeleteTextures(1, &m_textureID));
+		GLStateCache::onTextureDeleted(m_textureID);
 	}
 
 	/* Functions */
 	void Texture::bind() const
 	{
-		GLcall(glActiveTexture(GL_TEXTURE0));
-		GLcall(glBindTexture(GL_TEXTURE_2D, m_textureID));
+		GLStateCache::bindTexture(0, GL_TEXTURE_2D, m_textureID);
 	}
 
 	void Texture::bind(const unsigned int slot) const
 	{
-		if (slot < 32)
-		{
-			GLcall(glActiveTexture(GL_TEXTURE0 + slot));
-			GLcall(glBindTexture(GL_TEXTURE_2D, m_textureID));
-		}
-		else
-		{
-			LOG("[Error] Texture Slot is out of range.");
-		}
+		GLStateCache::bindTexture(slot, GL_TEXTURE_2D, m_textureID);
 	}
 
 	void Texture::unbind()
 	{
-		GLcall(glBindTexture(GL_TEXTURE_2D, 0));
+		GLStateCache::bindTexture(GL_TEXTURE_2D, 0);
 	}
 
 	// Private Functions
@@ -87,7 +88,7 @@ namespace gg
 
 		// Creating Texture
 		GLcall(glGenTextures(1, &m_textureID));
-		GLcall(glBindTexture(GL_TEXTURE_2D, m_textureID));
+		GLStateCache::bindTexture(GL_TEXTURE_2D, m_textureID);
 
 		// Texture Setup
 		GLcall(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
@@ -99,7 +100,7 @@ namespace gg
 		GLcall(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, m_width, m_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, m_textureData));
 
 		// Finishing
-		GLcall(glBindTexture(GL_TEXTURE_2D, 0));
+		GLStateCache::bindTexture(GL_TEXTURE_2D, 0);
 
 		// Freeing Data
 		stbi_image_free(m_textureData);
@@ -28,6 +28,10 @@ namespace gg
 		Texture(const std::string& filepath, const unsigned int atlasRows); //constructor for texture atlas; atlasRows is amount of rows and columns of texture atlas
 
 		Texture(const unsigned int textureID, const unsigned int width, const unsigned int height); //constructor for opengl textures; textureID is id of a texture generated by opengl
+		Texture(Texture&& other); //takes ownership of other's texture
+
+		Texture(const Texture&) = delete; //texture owns opengl texture, copies would delete it twice
+		Texture& operator=(const Texture&) = delete;
 
 		/* Destructor */
 		~Texture();
@@ -0,0 +1,390 @@
+
+/* INCLUDES */
+// Self Include
+#include "TextureAtlas.h"
+
+// OpenGL Includes
+#include <GL/glew.h>
+
+// STBI Image Includes
+#include <stb_image.h>
+
+// Header Includes
+#include "ErrorHandling.h"
+#include "GLStateCache.h"
+
+#include "../Log.h"
+
+
+
+namespace gg
+{
+
+	/* ADDITIONAL FUNCTIONS */
+	static unsigned int s_roundUp(const unsigned int value, const unsigned int multiple)
+	{
+		return (value + multiple - 1) / multiple * multiple;
+	}
+
+	static unsigned int s_clamp(const int value, const unsigned int max) //clamps value to range 0 - max
+	{
+		if (value < 0)
+			return 0;
+		else if ((unsigned int)value > max)
+			return max;
+
+		return (unsigned int)value;
+	}
+
+
+
+	/* Constructors */
+	TextureAtlas::TextureAtlas()
+		: TextureAtlas(TEXTURE_ATLAS_DEFAULT_PADDING)
+	{}
+
+	TextureAtlas::TextureAtlas(const unsigned int padding)
+		: m_padding(padding), m_alignment(1), m_maxMipmapLevel(0)
+	{
+		// Mipmap Levels Safe for Padding
+		while ((m_alignment << 1) <= m_padding)
+		{
+			m_alignment <<= 1;
+			m_maxMipmapLevel++;
+		}
+
+		// Max Size Setup
+		int maxTextureSize = TEXTURE_ATLAS_MAX_SIZE;
+		GLcall(glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize));
+
+		m_maxSize = maxTextureSize < TEXTURE_ATLAS_MAX_SIZE ? (unsigned int)maxTextureSize : TEXTURE_ATLAS_MAX_SIZE;
+
+		// Copying FBO
+		GLcall(glGenFramebuffers(1, &m_copyFBO));
+	}
+
+	/* Destructor */
+	TextureAtlas::~TextureAtlas()
+	{
+		for (TextureAtlasPage& page : m_pages)
+			delete page.texture;
+
+		for (TextureAtlasRegion* region : m_regions)
+			delete region;
+
+		GLcall(glDeleteFramebuffers(1, &m_copyFBO));
+		GLStateCache::onFramebufferDeleted(m_copyFBO);
+	}
+
+	/* Functions */
+	const TextureAtlasRegion* TextureAtlas::add(const std::string& filepath)
+	{
+		// Loading Image
+		int width, height, BPP;
+
+		stbi_set_flip_vertically_on_load(1);
+		unsigned char* pixels = stbi_load(filepath.c_str(), &width, &height, &BPP, 4);
+
+		if (!pixels)
+		{
+			LOG("[Error] Couldn't load texture '" << filepath << "'.");
+			return nullptr;
+		}
+
+		// Packing
+		const TextureAtlasRegion* region = add(pixels, width, height);
+
+		stbi_image_free(pixels);
+
+
+		return region;
+	}
+
+	const TextureAtlasRegion* TextureAtlas::add(const unsigned char* pixels, const unsigned int width, const unsigned int height)
+	{
+		// Calculating Packed Size
+		unsigned int packedWidth = s_roundUp(width + m_padding * 2, m_alignment);
+		unsigned int packedHeight = s_roundUp(height + m_padding * 2, m_alignment);
+
+		if (packedWidth > m_maxSize || packedHeight > m_maxSize)
+		{
+			LOG("[Error] Image is too big for texture atlas.");
+			return nullptr;
+		}
+
+		// Finding Place in Existing Pages
+		unsigned int pageIndex = 0, nodeIndex = 0, x = 0, y = 0;
+		bool found = false;
+
+		for (unsigned int i = 0; i < m_pages.size() && !found; i++)
+		{
+			found = m_findPosition(m_pages[i], packedWidth, packedHeight, nodeIndex, x, y);
+			pageIndex = i;
+		}
+
+		// Growing Last Page
+		while (!found && !m_pages.empty() && m_growPage(m_pages.size() - 1))
+		{
+			pageIndex = m_pages.size() - 1;
+			found = m_findPosition(m_pages[pageIndex], packedWidth, packedHeight, nodeIndex, x, y);
+		}
+
+		// Creating New Page
+		if (!found)
+		{
+			m_createPage();
+			pageIndex = m_pages.size() - 1;
+
+			while (!(found = m_findPosition(m_pages[pageIndex], packedWidth, packedHeight, nodeIndex, x, y)) && m_growPage(pageIndex));
+		}
+
+		if (!found)
+		{
+			LOG("[Error] Couldn't find place for image in texture atlas.");
+			return nullptr;
+		}
+
+		TextureAtlasPage& page = m_pages[pageIndex];
+		m_insertNode(page, nodeIndex, x, y, packedWidth, packedHeight);
+
+		// Extruding Edges into Padding
+		std::vector<unsigned char> packedPixels(packedWidth * packedHeight * 4);
+
+		for (unsigned int row = 0; row < packedHeight; row++)
+		{
+			unsigned int sourceRow = s_clamp((int)row - (int)m_padding, height - 1);
+
+			for (unsigned int column = 0; column < packedWidth; column++)
+			{
+				unsigned int sourceColumn = s_clamp((int)column - (int)m_padding, width - 1);
+
+				const unsigned char* source = &pixels[(sourceRow * width + sourceColumn) * 4];
+				unsigned char* destination = &packedPixels[(row * packedWidth + column) * 4];
+
+				destination[0] = source[0];
+				destination[1] = source[1];
+				destination[2] = source[2];
+				destination[3] = source[3];
+			}
+		}
+
+		// Uploading
+		page.texture->bind();
+		GLcall(glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, packedWidth, packedHeight, GL_RGBA, GL_UNSIGNED_BYTE, packedPixels.data()));
+		GLcall(glGenerateMipmap(GL_TEXTURE_2D));
+		Texture::unbind();
+
+		// Region Setup
+		TextureAtlasRegion* region = new TextureAtlasRegion();
+		region->texture = page.texture;
+		region->page = pageIndex;
+		region->x = x + m_padding;
+		region->y = y + m_padding;
+		region->width = width;
+		region->height = height;
+		m_updateRegionUVs(*region);
+
+		m_regions.push_back(region);
+
+
+		return region;
+	}
+
+	// Private Functions
+	bool TextureAtlas::m_findPosition(const TextureAtlasPage& page, const unsigned int width, const unsigned int height, unsigned int& nodeIndex, unsigned int& x, unsigned int& y) const
+	{
+		// Bottom Left Rule (lowest position, then narrowest node)
+		unsigned int bestY = 0xFFFFFFFF;
+		unsigned int bestWidth = 0xFFFFFFFF;
+
+		for (unsigned int i = 0; i < page.skyline.size(); i++)
+		{
+			const TextureAtlasSkylineNode& node = page.skyline[i];
+
+			if (node.x + width > page.size)
+				break; //nodes are sorted by x
+
+			// Finding Height of Skyline Under Rectangle
+			unsigned int top = 0;
+			unsigned int covered = 0;
+			bool fits = true;
+
+			for (unsigned int j = i; covered < width; j++)
+			{
+				if (j >= page.skyline.size())
+				{
+					fits = false;
+					break;
+				}
+
+				top = page.skyline[j].y > top ? page.skyline[j].y : top;
+				covered += page.skyline[j].width;
+
+				if (top + height > page.size)
+				{
+					fits = false;
+					break;
+				}
+			}
+
+			// Choosing Best Node
+			if (fits && (top < bestY || (top == bestY && node.width < bestWidth)))
+			{
+				bestY = top;
+				bestWidth = node.width;
+
+				nodeIndex = i;
+				x = node.x;
+				y = top;
+			}
+		}
+
+
+		return bestY != 0xFFFFFFFF;
+	}
+
+	void TextureAtlas::m_insertNode(TextureAtlasPage& page, const unsigned int nodeIndex, const unsigned int x, const unsigned int y, const unsigned int width, const unsigned int height)
+	{
+		// Adding Node on Top of Rectangle
+		TextureAtlasSkylineNode node;
+		node.x = x;
+		node.y = y + height;
+		node.width = width;
+
+		page.skyline.insert(page.skyline.begin() + nodeIndex, node);
+
+		// Shrinking Nodes Covered by Rectangle
+		for (unsigned int i = nodeIndex + 1; i < page.skyline.size(); i++)
+		{
+			TextureAtlasSkylineNode& previous = page.skyline[i - 1];
+			TextureAtlasSkylineNode& current = page.skyline[i];
+
+			if (current.x >= previous.x + previous.width)
+				break;
+
+			unsigned int shrink = previous.x + previous.width - current.x;
+
+			if (shrink >= current.width)
+			{
+				page.skyline.erase(page.skyline.begin() + i);
+				i--;
+			}
+			else
+			{
+				current.x += shrink;
+				current.width -= shrink;
+				break;
+			}
+		}
+
+		// Merging Nodes of Same Height
+		for (unsigned int i = 1; i < page.skyline.size(); i++)
+		{
+			if (page.skyline[i - 1].y == page.skyline[i].y)
+			{
+				page.skyline[i - 1].width += page.skyline[i].width;
+				page.skyline.erase(page.skyline.begin() + i);
+				i--;
+			}
+		}
+	}
+
+
+	void TextureAtlas::m_createPage()
+	{
+		TextureAtlasPage page;
+		page.size = TEXTURE_ATLAS_INITIAL_SIZE < m_maxSize ? TEXTURE_ATLAS_INITIAL_SIZE : m_maxSize;
+		page.texture = m_createPageTexture(page.size);
+
+		TextureAtlasSkylineNode node;
+		node.x = 0;
+		node.y = 0;
+		node.width = page.size;
+		page.skyline.push_back(node);
+
+		m_pages.push_back(page);
+	}
+
+	bool TextureAtlas::m_growPage(const unsigned int pageIndex)
+	{
+		TextureAtlasPage& page = m_pages[pageIndex];
+
+		if (page.size * 2 > m_maxSize)
+			return false;
+
+		// Copying Content to Bigger Texture
+		Texture* texture = m_createPageTexture(page.size * 2);
+
+		GLStateCache::bindFramebuffer(m_copyFBO);
+		GLcall(glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, page.texture->getID(), 0));
+
+		texture->bind();
+		GLcall(glCopyTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 0, 0, page.size, page.size));
+		GLcall(glGenerateMipmap(GL_TEXTURE_2D));
+		Texture::unbind();
+
+		GLcall(glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0));
+		GLStateCache::bindFramebuffer(0);
+
+		// Replacing Page Texture
+		delete page.texture;
+		page.texture = texture;
+
+		// Extending Skyline to New Width
+		TextureAtlasSkylineNode node;
+		node.x = page.size;
+		node.y = 0;
+		node.width = page.size;
+		page.skyline.push_back(node);
+
+		page.size *= 2;
+
+		// Updating Regions
+		for (TextureAtlasRegion* region : m_regions)
+		{
+			if (region->page == pageIndex)
+			{
+				region->texture = page.texture;
+				m_updateRegionUVs(*region);
+			}
+		}
+
+
+		return true;
+	}
+
+	Texture* TextureAtlas::m_createPageTexture(const unsigned int size) const
+	{
+		// Creating Texture
+		unsigned int textureID;
+		GLcall(glGenTextures(1, &textureID));
+		GLStateCache::bindTexture(GL_TEXTURE_2D, textureID);
+
+		// Texture Setup
+		GLcall(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR));
+		GLcall(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
+		GLcall(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
+		GLcall(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+		GLcall(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, m_maxMipmapLevel));
+
+		// Allocating Storage
+		GLcall(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, size, size, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+		GLcall(glGenerateMipmap(GL_TEXTURE_2D));
+
+		// Finishing
+		GLStateCache::bindTexture(GL_TEXTURE_2D, 0);
+
+
+		return new Texture(textureID, size, size);
+	}
+
+
+	void TextureAtlas::m_updateRegionUVs(TextureAtlasRegion& region) const
+	{
+		float size = (float)m_pages[region.page].size;
+
+		region.uvMin = vector2(region.x / size, region.y / size);
+		region.uvMax = vector2((region.x + region.width) / size, (region.y + region.height) / size);
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+#ifndef GUMIGOTA_TEXTUREATLAS_H
+#define GUMIGOTA_TEXTUREATLAS_H
+
+
+
+/* INCLUDES */
+// Normal Includes
+#include <string>
+#include <vector>
+
+// Header Includes
+#include "Texture.h"
+
+#include "../maths/vectors/vector2.h"
+
+
+
+/* DEFINITIONS */
+#define TEXTURE_ATLAS_INITIAL_SIZE 512
+#define TEXTURE_ATLAS_MAX_SIZE 4096
+#define TEXTURE_ATLAS_DEFAULT_PADDING 4 //pixels of repeated edge around every image; mipmap levels are limited so neighbours never bleed in
+
+
+
+namespace gg
+{
+
+	/* ADDITIONAL STUFF */
+	struct TextureAtlasRegion
+	{
+		Texture* texture; //page the image was packed into; changes when page grows
+		unsigned int page;
+		unsigned int x, y, width, height; //in pixels, without padding
+		vector2 uvMin, uvMax;
+	};
+
+	struct TextureAtlasSkylineNode
+	{
+		unsigned int x, y, width;
+	};
+
+	struct TextureAtlasPage
+	{
+		Texture* texture;
+		unsigned int size;
+		std::vector<TextureAtlasSkylineNode> skyline;
+	};
+
+
+
+	class TextureAtlas //packs many small images into few big textures, so sprites using them can be drawn in one batch
+	{
+	private:
+		/* Variables */
+		std::vector<TextureAtlasPage> m_pages;
+		std::vector<TextureAtlasRegion*> m_regions;
+
+		unsigned int m_padding;
+		unsigned int m_alignment; //regions start at multiples of it, so mipmap texels don't mix neighbours
+		unsigned int m_maxMipmapLevel;
+		unsigned int m_maxSize;
+
+		unsigned int m_copyFBO; //used for copying page content when page grows
+
+	public:
+		/* Constructors */
+		TextureAtlas();
+		TextureAtlas(const unsigned int padding);
+
+		/* Destructor */
+		~TextureAtlas();
+
+		/* Functions */
+		const TextureAtlasRegion* add(const std::string& filepath); //returns nullptr if image couldn't be loaded or is too big
+		const TextureAtlasRegion* add(const unsigned char* pixels, const unsigned int width, const unsigned int height); //pixels are rgba, rows from bottom to top
+
+		// Getters
+		inline unsigned int getPageCount() const { return m_pages.size(); }
+		inline const Texture* getPage(const unsigned int index) const { return m_pages[index].texture; }
+
+	private:
+		// Private Functions
+		bool m_findPosition(const TextureAtlasPage& page, const unsigned int width, const unsigned int height, unsigned int& nodeIndex, unsigned int& x, unsigned int& y) const;
+		void m_insertNode(TextureAtlasPage& page, const unsigned int nodeIndex, const unsigned int x, const unsigned int y, const unsigned int width, const unsigned int height);
+
+		void m_createPage();
+		bool m_growPage(const unsigned int pageIndex); //doubles page size, keeping content and updating uvs of its regions
+		Texture* m_createPageTexture(const unsigned int size) const;
+
+		void m_updateRegionUVs(TextureAtlasRegion& region) const;
+
+	};
+
+}
+
+
+
+#endif
\ No newline at end of file
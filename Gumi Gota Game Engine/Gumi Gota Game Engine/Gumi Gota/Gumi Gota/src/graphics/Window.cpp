@@ -9,6 +9,7 @@
 
 // Header Includes
 #include "ErrorHandling.h"
+#include "GLStateCache.h"
 
 #include "../Log.h"
 
@@ -60,7 +61,7 @@ namespace gg
 
 	void Window::setClearColor(const Color& color) const
 	{
-		GLcall(glClearColor(color.r, color.g, color.b, color.a));
+		GLStateCache::setClearColor(color.r, color.g, color.b, color.a);
 	}
 
 	void Window::setMousePosition(vector2 pos)
@@ -199,7 +200,7 @@ namespace gg
 		Window* win = (Window*)glfwGetWindowUserPointer(window); //getting the window class
 
 		// Resizing Stuff
-		GLcall(glViewport(0, 0, width, height));
+		GLStateCache::setViewport(0, 0, width, height);
 
 		// Updating Window Class Variables
 		win->m_width = width;
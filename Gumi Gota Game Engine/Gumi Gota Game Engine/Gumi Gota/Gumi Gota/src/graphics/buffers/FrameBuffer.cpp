@@ -9,6 +9,7 @@
 // Header Includes
 #include "../../Log.h"
 #include "../ErrorHandling.h"
+#include "../GLStateCache.h"
 
 
 
@@ -17,16 +18,17 @@ namespace gg
 
 	/* Constructors */
 	FrameBuffer::FrameBuffer()
+		: m_colorTextureID(0), m_depthTextureID(0), m_depthBufferID(0)
 	{
 		// Creating FBO
 		GLcall( glGenFramebuffers(1, &m_id) );
 
 		// FBO Setup
-		GLcall( glBindFramebuffer(GL_FRAMEBUFFER, m_id) );
+		GLStateCache::bindFramebuffer(m_id);
 		GLcall( glDrawBuffer(GL_COLOR_ATTACHMENT0) );
 
 		// Finishing
-		GLcall( glBindFramebuffer(GL_FRAMEBUFFER, 0) );
+		GLStateCache::bindFramebuffer(0);
 	}
 
 	/* Destructor */
@@ -34,9 +36,12 @@ namespace gg
 	{
 		// Deleting Buffers and Textures
 		GLcall( glDeleteFramebuffers(1, &m_id) );
+		GLStateCache::onFramebufferDeleted(m_id);
 
 		GLcall( glDeleteTextures(1, &m_colorTextureID) );
 		GLcall( glDeleteTextures(1, &m_depthTextureID) );
+		GLStateCache::onTextureDeleted(m_colorTextureID);
+		GLStateCache::onTextureDeleted(m_depthTextureID);
 		GLcall( glDeleteRenderbuffers(1, &m_depthBufferID) );
 	}
 
@@ -44,13 +49,13 @@ namespace gg
 	void FrameBuffer::attachTexture(const unsigned int width, const unsigned int height)
 	{
 		// Binding FBO
-		GLcall( glBindFramebuffer(GL_FRAMEBUFFER, m_id) );
+		GLStateCache::bindFramebuffer(m_id);
 
 		// Creating Texture
 		GLcall( glGenTextures(1, &m_colorTextureID) );
 
 		// Depth Texture Setup
-		GLcall( glBindTexture(GL_TEXTURE_2D, m_colorTextureID) );
+		GLStateCache::bindTexture(GL_TEXTURE_2D, m_colorTextureID);
 		GLcall( glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR) );
 		GLcall( glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR) );
 		GLcall( glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT) );
@@ -61,20 +66,44 @@ namespace gg
 		GLcall( glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_colorTextureID, 0) );
 
 		// Finishing
-		GLcall( glBindTexture(GL_TEXTURE_2D, 0) );
-		GLcall( glBindFramebuffer(GL_FRAMEBUFFER, 0) );
+		GLStateCache::bindTexture(GL_TEXTURE_2D, 0);
+		GLStateCache::bindFramebuffer(0);
+	}
+
+	void FrameBuffer::attachFloatTexture(const unsigned int width, const unsigned int height)
+	{
+		// Binding FBO
+		GLStateCache::bindFramebuffer(m_id);
+
+		// Creating Texture
+		GLcall( glGenTextures(1, &m_colorTextureID) );
+
+		// Texture Setup
+		GLStateCache::bindTexture(GL_TEXTURE_2D, m_colorTextureID);
+		GLcall( glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR) );
+		GLcall( glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR) );
+		GLcall( glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE) );
+		GLcall( glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE) );
+		GLcall( glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB16F, width, height, 0, GL_RGB, GL_FLOAT, nullptr) );
+
+		// Attaching Texture to FBO
+		GLcall( glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_colorTextureID, 0) );
+
+		// Finishing
+		GLStateCache::bindTexture(GL_TEXTURE_2D, 0);
+		GLStateCache::bindFramebuffer(0);
 	}
 
 	void FrameBuffer::attachDepthTexture(const unsigned int width, const unsigned int height)
 	{
 		// Binding FBO
-		GLcall( glBindFramebuffer(GL_FRAMEBUFFER, m_id) );
+		GLStateCache::bindFramebuffer(m_id);
 
 		// Creating Depth Texture
 		GLcall( glGenTextures(1, &m_depthTextureID) );
 
 		// Texture Setup
-		GLcall( glBindTexture(GL_TEXTURE_2D, m_depthTextureID) );
+		GLStateCache::bindTexture(GL_TEXTURE_2D, m_depthTextureID);
 		GLcall( glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR) );
 		GLcall( glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR) );
 		GLcall( glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT) );
@@ -88,14 +117,14 @@ namespace gg
 		GLcall( glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, m_depthTextureID, 0) );
 
 		// Finishing
-		GLcall( glBindTexture(GL_TEXTURE_2D, 0) );
-		GLcall( glBindFramebuffer(GL_FRAMEBUFFER, 0) );
+		GLStateCache::bindTexture(GL_TEXTURE_2D, 0);
+		GLStateCache::bindFramebuffer(0);
 	}
 
 	void FrameBuffer::attachDepthBuffer(const unsigned int width, const unsigned int height)
 	{
 		// Binding FBO
-		GLcall( glBindFramebuffer(GL_FRAMEBUFFER, m_id) );
+		GLStateCache::bindFramebuffer(m_id);
 
 		// Creating Depth Buffer
 		GLcall( glGenRenderbuffers(1, &m_depthBufferID) );
@@ -107,53 +136,37 @@ namespace gg
 
 		// Finishing
 		GLcall( glBindRenderbuffer(GL_RENDERBUFFER, 0) );
-		GLcall( glBindFramebuffer(GL_FRAMEBUFFER, 0) );
+		GLStateCache::bindFramebuffer(0);
 	}
 
 
 	void FrameBuffer::bind(const unsigned int width, const unsigned int height) const
 	{
-		GLcall( glBindFramebuffer(GL_FRAMEBUFFER, m_id) );
-		GLcall( glViewport(0, 0, width, height) );
+		GLStateCache::bindFramebuffer(m_id);
+		GLStateCache::setViewport(0, 0, width, height);
 	}
 
 	void FrameBuffer::unbind(const unsigned int width, const unsigned int height)
 	{
-		GLcall( glBindFramebuffer(GL_FRAMEBUFFER, 0) );
-		GLcall( glViewport(0, 0, width, height) );
+		GLStateCache::bindFramebuffer(0);
+		GLStateCache::setViewport(0, 0, width, height);
 	}
 
 	void FrameBuffer::unbind(const Window& window)
 	{
-		GLcall( glBindFramebuffer(GL_FRAMEBUFFER, 0) );
-		GLcall( glViewport(0, 0, window.getWidth(), window.getHeight()) );
+		GLStateCache::bindFramebuffer(0);
+		GLStateCache::setViewport(0, 0, window.getWidth(), window.getHeight());
 	}
 
 
 	void FrameBuffer::bindColorTexture(const unsigned int slot) const
 	{
-		if (slot < 32)
-		{
-			GLcall( glActiveTexture(GL_TEXTURE0 + slot) );
-			GLcall( glBindTexture(GL_TEXTURE_2D, m_colorTextureID) );
-		}
-		else
-		{
-			LOG("[Error] Color Texture Slot is out of range.");
-		}
+		GLStateCache::bindTexture(slot, GL_TEXTURE_2D, m_colorTextureID);
 	}
 
 	void FrameBuffer::bindDepthTexture(const unsigned int slot) const
 	{
-		if (slot < 32)
-		{
-			GLcall( glActiveTexture(GL_TEXTURE0 + slot) );
-			GLcall( glBindTexture(GL_TEXTURE_2D, m_depthTextureID) );
-		}
-		else
-		{
-			LOG("[Error] Depth Texture Slot is out of range.");
-		}
+		GLStateCache::bindTexture(slot, GL_TEXTURE_2D, m_depthTextureID);
 	}
 
 }
\ No newline at end of file
@@ -34,6 +34,7 @@ namespace gg
 
 		/* Functions */
 		void attachTexture(const unsigned int width, const unsigned int height);
+		void attachFloatTexture(const unsigned int width, const unsigned int height); //16 bit float color clamped to edge; for values above 1 (e.g. light maps)
 		void attachDepthTexture(const unsigned int width, const unsigned int height);
 		void attachDepthBuffer(const unsigned int width, const unsigned int height);
 
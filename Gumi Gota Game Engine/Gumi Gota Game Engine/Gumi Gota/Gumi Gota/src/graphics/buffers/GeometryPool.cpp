@@ -0,0 +1,179 @@
+
+/* INCLUDES */
+// Self Include
+#include "GeometryPool.h"
+
+// OpenGL Includes
+#include <GL/glew.h>
+
+// Header Includes
+#include "../../Log.h"
+#include "../ErrorHandling.h"
+
+
+
+namespace gg
+{
+
+	/* ADDITIONAL STUFF */
+	const static unsigned int s_instanceAttributesFirstIndex = 3;
+	const static unsigned int s_instanceAttributesCount = 6;
+
+	const static unsigned int s_instanceAttributesLengths[] = { 4, 4, 4, 4, 4, 2 }; //model matrix columns, texture data, material data
+	const static unsigned int s_instanceAttributesOffsets[] = { 0, 4, 8, 12, 16, 20 };
+
+
+
+	/* Constructors */
+	GeometryPool::GeometryPool(const unsigned int maxVertices, const unsigned int maxIndices, const unsigned int maxInstances)
+		: m_vao(), m_ibo(nullptr, maxIndices),
+		  m_indirectBufferID(0),
+		  m_maxVertices(maxVertices), m_maxIndices(maxIndices), m_maxInstances(maxInstances),
+		  m_usedVertices(0), m_usedIndices(0),
+		  m_multiDrawIndirectSupported(GLEW_VERSION_4_3 || GLEW_ARB_multi_draw_indirect)
+	{
+		// Creating Vertex Buffers
+		m_positionsVBO = new VertexBuffer(nullptr, maxVertices * 3, 3);
+		m_textureCoordinatesVBO = new VertexBuffer(nullptr, maxVertices * 2, 2);
+		m_normalsVBO = new VertexBuffer(nullptr, maxVertices * 3, 3);
+		m_instanceVBO = new VertexBuffer(nullptr, maxInstances * GEOMETRY_POOL_INSTANCE_DATA_LENGTH, GEOMETRY_POOL_INSTANCE_DATA_LENGTH, VERTEX_BUFFER_STREAM_DRAW);
+
+		// Attaching VBOs to VAO
+		m_vao.addAttribute(m_positionsVBO, 0);
+		m_vao.addAttribute(m_textureCoordinatesVBO, 1);
+		m_vao.addAttribute(m_normalsVBO, 2);
+
+		for (unsigned int i = 0; i < s_instanceAttributesCount; i++)
+			m_vao.addInstancedAttribute(m_instanceVBO, s_instanceAttributesFirstIndex + i, s_instanceAttributesLengths[i], GEOMETRY_POOL_INSTANCE_DATA_LENGTH, s_instanceAttributesOffsets[i]);
+
+		// Creating Indirect Buffer
+		if (m_multiDrawIndirectSupported)
+		{
+			GLcall( glGenBuffers(1, &m_indirectBufferID) );
+		}
+		else
+		{
+			LOG("[Info] Multi draw indirect is not supported, geometry pool will use separate draw calls");
+		}
+
+		// Finishing
+		VertexArray::unbind();
+	}
+
+	/* Destructor */
+	GeometryPool::~GeometryPool()
+	{
+		if (m_indirectBufferID != 0)
+		{
+			GLcall( glDeleteBuffers(1, &m_indirectBufferID) );
+		}
+	}
+
+	/* Functions */
+	bool GeometryPool::allocate(const float* vertices, const float* texCoords, const float* normals, const unsigned int vertexCount, const unsigned int* indices, const unsigned int indexCount, GeometryPoolRange& range)
+	{
+		// Checking Free Space
+		if (m_usedVertices + vertexCount > m_maxVertices || m_usedIndices + indexCount > m_maxIndices)
+			return false;
+
+		// Setting Range
+		range.firstIndex = m_usedIndices;
+		range.indexCount = indexCount;
+		range.baseVertex = m_usedVertices;
+		range.vertexCount = vertexCount;
+
+		// Buffering Data
+		VertexArray::unbind(); //making sure no vao gets its index buffer changed
+
+		m_positionsVBO->bind();
+		m_positionsVBO->bufferSubData(vertices, vertexCount * 3, m_usedVertices * 3);
+
+		m_textureCoordinatesVBO->bind();
+		m_textureCoordinatesVBO->bufferSubData(texCoords, vertexCount * 2, m_usedVertices * 2);
+
+		m_normalsVBO->bind();
+		m_normalsVBO->bufferSubData(normals, vertexCount * 3, m_usedVertices * 3);
+
+		VertexBuffer::unbind();
+
+		m_ibo.bufferSubData(indices, indexCount, m_usedIndices); //indices stay relative to the model, base vertex is added while drawing
+
+		// Updating Used Space
+		m_usedVertices += vertexCount;
+		m_usedIndices += indexCount;
+
+		return true;
+	}
+
+
+	void GeometryPool::bufferInstanceData(const float* data, const unsigned int instanceCount)
+	{
+		m_instanceVBO->bind();
+		m_instanceVBO->bufferData(nullptr, m_maxInstances * GEOMETRY_POOL_INSTANCE_DATA_LENGTH, VERTEX_BUFFER_STREAM_DRAW);
+		m_instanceVBO->bufferSubData(data, instanceCount * GEOMETRY_POOL_INSTANCE_DATA_LENGTH);
+		VertexBuffer::unbind();
+	}
+
+	void GeometryPool::bufferCommands(const std::vector<DrawElementsIndirectCommand>& commands)
+	{
+		m_commands = commands;
+
+		if (m_multiDrawIndirectSupported)
+		{
+			GLcall( glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_indirectBufferID) );
+			GLcall( glBufferData(GL_DRAW_INDIRECT_BUFFER, commands.size() * sizeof(DrawElementsIndirectCommand), commands.data(), GL_STREAM_DRAW) );
+			GLcall( glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0) );
+		}
+	}
+
+
+	void GeometryPool::drawIndirect(const unsigned int firstCommand, const unsigned int commandCount)
+	{
+		if (m_multiDrawIndirectSupported) // One Call for All Commands
+		{
+			GLcall( glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_indirectBufferID) );
+			GLcall( glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, static_cast<char const*>(0) + firstCommand * sizeof(DrawElementsIndirectCommand), commandCount, 0) );
+			GLcall( glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0) );
+		}
+		else // One Call per Command
+		{
+			for (unsigned int i = firstCommand; i < firstCommand + commandCount; i++)
+			{
+				const DrawElementsIndirectCommand& command = m_commands[i];
+
+				m_setInstanceAttributesOffset(command.baseInstance);
+
+				GLcall( glDrawElementsInstancedBaseVertex(GL_TRIANGLES, command.count, GL_UNSIGNED_INT, static_cast<char const*>(0) + command.firstIndex * sizeof(unsigned int), command.instanceCount, command.baseVertex) );
+			}
+
+			m_setInstanceAttributesOffset(0);
+		}
+	}
+
+
+	void GeometryPool::bind() const
+	{
+		m_vao.bind();
+		m_ibo.bind();
+	}
+
+	void GeometryPool::unbind()
+	{
+		VertexArray::unbind();
+		IndexBuffer::unbind();
+	}
+
+	// Private Functions
+	void GeometryPool::m_setInstanceAttributesOffset(const unsigned int firstInstance)
+	{
+		m_instanceVBO->bind();
+
+		for (unsigned int i = 0; i < s_instanceAttributesCount; i++)
+		{
+			GLcall( glVertexAttribPointer(s_instanceAttributesFirstIndex + i, s_instanceAttributesLengths[i], GL_FLOAT, GL_FALSE, GEOMETRY_POOL_INSTANCE_DATA_LENGTH * sizeof(float), static_cast<char const*>(0) + (firstInstance * GEOMETRY_POOL_INSTANCE_DATA_LENGTH + s_instanceAttributesOffsets[i]) * sizeof(float)) );
+		}
+
+		VertexBuffer::unbind();
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,100 @@
+#ifndef GUMIGOTA_GEOMETRYPOOL_H
+#define GUMIGOTA_GEOMETRYPOOL_H
+
+
+
+/* INCLUDES */
+// Normal Includes
+#include <vector>
+
+// Header Includes
+#include "VertexArray.h"
+#include "VertexBuffer.h"
+#include "IndexBuffer.h"
+
+
+
+/* DEFINITIONS */
+#define GEOMETRY_POOL_INSTANCE_DATA_LENGTH 22 //model matrix (16), texture offset (2), texture rows (1), fake lighting (1), shine damper (1), reflectivity (1)
+
+
+
+namespace gg
+{
+
+	/* ADDITIONAL STUFF */
+	struct DrawElementsIndirectCommand //layout required by glMultiDrawElementsIndirect
+	{
+		unsigned int count;
+		unsigned int instanceCount;
+		unsigned int firstIndex;
+		unsigned int baseVertex;
+		unsigned int baseInstance;
+	};
+
+	struct GeometryPoolRange //part of the pool taken by one model
+	{
+		unsigned int firstIndex;
+		unsigned int indexCount;
+		unsigned int baseVertex;
+		unsigned int vertexCount;
+	};
+
+
+
+	class GeometryPool
+	{
+	private:
+		/* Variables */
+		VertexArray m_vao;
+		VertexBuffer* m_positionsVBO;
+		VertexBuffer* m_textureCoordinatesVBO;
+		VertexBuffer* m_normalsVBO;
+		VertexBuffer* m_instanceVBO;
+		IndexBuffer m_ibo;
+
+		unsigned int m_indirectBufferID;
+		std::vector<DrawElementsIndirectCommand> m_commands; //copy of buffered commands used when multi draw indirect isn't supported
+
+		unsigned int m_maxVertices, m_maxIndices, m_maxInstances;
+		unsigned int m_usedVertices, m_usedIndices;
+
+		bool m_multiDrawIndirectSupported;
+
+	public:
+		/* Constructors */
+		GeometryPool(const unsigned int maxVertices, const unsigned int maxIndices, const unsigned int maxInstances);
+
+		/* Destructor */
+		~GeometryPool();
+
+		/* Functions */
+		bool allocate(const float* vertices, const float* texCoords, const float* normals, const unsigned int vertexCount, const unsigned int* indices, const unsigned int indexCount, GeometryPoolRange& range); //vertexCount is amount of vertices (not floats); returns false if there is not enough space left in the pool
+
+		void bufferInstanceData(const float* data, const unsigned int instanceCount); //data has GEOMETRY_POOL_INSTANCE_DATA_LENGTH floats per instance
+		void bufferCommands(const std::vector<DrawElementsIndirectCommand>& commands);
+
+		void drawIndirect(const unsigned int firstCommand, const unsigned int commandCount); //draws range of buffered commands; pool has to be bound
+
+		void bind() const;
+		static void unbind();
+
+		// Getters
+		inline unsigned int getMaxInstances() const { return m_maxInstances; }
+
+		inline unsigned int getUsedVertices() const { return m_usedVertices; }
+		inline unsigned int getUsedIndices()  const { return m_usedIndices;  }
+
+		inline bool isMultiDrawIndirectSupported() const { return m_multiDrawIndirectSupported; }
+
+	private:
+		// Private Functions
+		void m_setInstanceAttributesOffset(const unsigned int firstInstance); //used instead of base instance on OpenGL 3.3
+
+	};
+
+}
+
+
+
+#endif
\ No newline at end of file
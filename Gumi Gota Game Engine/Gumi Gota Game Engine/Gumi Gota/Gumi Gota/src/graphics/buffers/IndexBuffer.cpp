@@ -44,39 +44,40 @@ namespace gg
 	{
 		m_count = count;
 
-		if (data != nullptr)
-		{
-			GLcall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_id));
-			GLcall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(unsigned int), data, GL_STATIC_DRAW));
-			GLcall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
-		}
+		GLcall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_id));
+		GLcall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(unsigned int), data, GL_STATIC_DRAW)); //null data only allocates the storage
+		GLcall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
 	}
 
 	void IndexBuffer::bufferData(const unsigned int* data, const unsigned int count, IndexBufferDrawType usage)
 	{
 		m_count = count;
 
-		if (data != nullptr)
+		switch (usage)
 		{
-			switch (usage)
-			{
-
-			case INDEX_BUFFER_DRAW_STATIC:
-				GLcall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_id));
-				GLcall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(unsigned int), data, GL_STATIC_DRAW));
-				GLcall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
-				break;
-
-			case INDEX_BUFFER_DRAW_DYNAMIC:
-				GLcall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_id));
-				GLcall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(unsigned int), data, GL_DYNAMIC_DRAW));
-				GLcall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
-				break;
-
-			}
+
+		case INDEX_BUFFER_DRAW_STATIC:
+			GLcall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_id));
+			GLcall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(unsigned int), data, GL_STATIC_DRAW)); //null data only allocates the storage
+			GLcall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
+			break;
+
+		case INDEX_BUFFER_DRAW_DYNAMIC:
+			GLcall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_id));
+			GLcall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(unsigned int), data, GL_DYNAMIC_DRAW)); //null data only allocates the storage
+			GLcall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
+			break;
+
 		}
 	}
 
+	void IndexBuffer::bufferSubData(const unsigned int* data, const unsigned int count, const unsigned int offset)
+	{
+		GLcall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_id));
+		GLcall(glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset * sizeof(unsigned int), count * sizeof(unsigned int), data));
+		GLcall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
+	}
+
 
 	void IndexBuffer::bind() const
 	{
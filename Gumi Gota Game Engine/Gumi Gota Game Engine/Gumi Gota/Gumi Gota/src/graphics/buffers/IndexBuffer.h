@@ -33,6 +33,7 @@ namespace gg
 		/* Functions */
 		void bufferData(const unsigned int* data, const unsigned int count);
 		void bufferData(const unsigned int* data, const unsigned int count, IndexBufferDrawType usage);
+		void bufferSubData(const unsigned int* data, const unsigned int count, const unsigned int offset); //offset is in indices amount
 
 		void bind() const;
 		static void unbind();
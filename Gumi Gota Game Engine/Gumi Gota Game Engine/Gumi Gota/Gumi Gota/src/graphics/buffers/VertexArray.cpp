@@ -8,6 +8,7 @@
 
 // Header Includes
 #include "../../graphics/ErrorHandling.h"
+#include "../../graphics/GLStateCache.h"
 
 #include <iostream> ///remove l8r
 
@@ -20,7 +21,7 @@ namespace gg
 	VertexArray::VertexArray()
 	{
 		GLcall(glGenVertexArrays(1, &m_id));
-		GLcall(glBindVertexArray(m_id));
+		GLStateCache::bindVertexArray(m_id);
 	}
 
 	/* Destructor */
@@ -32,6 +33,7 @@ namespace gg
 		}
 
 		GLcall(glDeleteVertexArrays(1, &m_id));
+		GLStateCache::onVertexArrayDeleted(m_id);
 	}
 
 	/* Functions */
@@ -63,6 +65,34 @@ namespace gg
 		unbind();
 	}
 
+	void VertexArray::addAttribute(VertexBuffer* vbo, const unsigned int index, const unsigned int dataLength, const unsigned int stride, const unsigned int offset)
+	{
+		bind();
+		vbo->bind();
+
+		GLcall(glEnableVertexAttribArray(index));
+		GLcall(glVertexAttribPointer(index, dataLength, GL_FLOAT, GL_FALSE, stride * sizeof(float), static_cast<char const*>(0) + offset * sizeof(float)));
+
+		m_addBuffer(vbo);
+
+		vbo->unbind();
+		unbind();
+	}
+
+	void VertexArray::addPackedColorAttribute(VertexBuffer* vbo, const unsigned int index, const unsigned int stride, const unsigned int offset)
+	{
+		bind();
+		vbo->bind();
+
+		GLcall(glEnableVertexAttribArray(index));
+		GLcall(glVertexAttribPointer(index, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride * sizeof(float), static_cast<char const*>(0) + offset * sizeof(float)));
+
+		m_addBuffer(vbo);
+
+		vbo->unbind();
+		unbind();
+	}
+
 	void VertexArray::addInstancedAttribute(VertexBuffer* vbo, const unsigned int index, const unsigned int dataLength, const unsigned int stride, const unsigned int offset)
 	{
 		bind();
@@ -81,12 +111,12 @@ namespace gg
 
 	void VertexArray::bind() const
 	{
-		GLcall(glBindVertexArray(m_id));
+		GLStateCache::bindVertexArray(m_id);
 	}
 
 	void VertexArray::unbind()
 	{
-		GLcall(glBindVertexArray(0));
+		GLStateCache::bindVertexArray(0);
 	}
 
 	// Private Functions
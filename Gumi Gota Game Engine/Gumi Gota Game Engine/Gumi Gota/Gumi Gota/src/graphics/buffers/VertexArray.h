@@ -32,6 +32,8 @@ namespace gg
 		/* Functions */
 		void addAttribute(VertexBuffer* vbo, const unsigned int index);
 		void addAttribute(VertexBuffer* vbo, const unsigned int index, const unsigned int stride); //stride is in floats amount
+		void addAttribute(VertexBuffer* vbo, const unsigned int index, const unsigned int dataLength, const unsigned int stride, const unsigned int offset); //stride is in floats amount; offset is in floats amount
+		void addPackedColorAttribute(VertexBuffer* vbo, const unsigned int index, const unsigned int stride, const unsigned int offset); //color packed as 4 normalized bytes in place of one float; stride is in floats amount; offset is in floats amount
 		void addInstancedAttribute(VertexBuffer* vbo, const unsigned int index, const unsigned int dataLength, const unsigned int stride, const unsigned int offset); //stride is in floats amount; offset is in floats amount
 
 		void bind() const;
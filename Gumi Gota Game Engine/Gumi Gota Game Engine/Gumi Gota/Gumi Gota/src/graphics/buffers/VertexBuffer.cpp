@@ -91,6 +91,11 @@ namespace gg
 		GLcall(glBufferSubData(GL_ARRAY_BUFFER, 0, size * sizeof(float), data));
 	}
 
+	void VertexBuffer::bufferSubData(const void* data, const unsigned int size, const unsigned int offset)
+	{
+		GLcall(glBufferSubData(GL_ARRAY_BUFFER, offset * sizeof(float), size * sizeof(float), data));
+	}
+
 
 	void VertexBuffer::bind() const
 	{
@@ -35,6 +35,7 @@ namespace gg
 		void bufferData(const void* data, const unsigned int size); //size is in floats amount
 		void bufferData(const void* data, const unsigned int size, VertexBufferDrawType usage); //size is in floats amount
 		void bufferSubData(const void* data, const unsigned int size); //size is in floats amount
+		void bufferSubData(const void* data, const unsigned int size, const unsigned int offset); //size is in floats amount; offset is in floats amount
 
 		void bind() const;
 		static void unbind();
@@ -8,6 +8,9 @@
 
 #include <iostream> ///remove l8r
 
+// Header Includes
+#include "../../utils/Sorting.h"
+
 
 
 namespace gg
@@ -16,12 +19,12 @@ namespace gg
 	/* FUNCTIONS */
 	float power(const float base, const float exponent)
 	{
-		return pow(base, exponent);
+		return std::pow(base, exponent);
 	}
 
 	float squareRoot(const float number)
 	{
-		return power(number, 0.5f);
+		return std::sqrt(number); //exact and much cheaper than pow; see FastMath.h for approximations
 	}
 
 
@@ -51,36 +54,18 @@ namespace gg
 
 	std::vector<float> lowestValues(const std::vector<float>& numbers, const unsigned int amount)
 	{
-		// Init
-		std::vector<float> lowestValues;
-		std::vector<int> lowestIndices;
+		// Finding Lowest Values
+		std::vector<unsigned int> indices = selectLowestIndices(numbers, amount);
 
+		std::vector<float> lowestValues;
 		lowestValues.reserve(amount);
-		lowestIndices.reserve(amount);
-
-		for (unsigned int i = 0; i < amount; i++)
-		{
-			lowestValues.push_back(100000000.0f);
-			lowestIndices.push_back(-1);
-		}
-
-		// Finding Lowest Values
-		for (unsigned int i = 0; i < numbers.size(); i++)
-		{
-			for (unsigned int j = 0; j < amount; j++)
-			{
-				if (numbers[i] < lowestValues[j])
-				{
-					lowestValues.erase(lowestValues.end() - 1);
-					lowestIndices.erase(lowestIndices.end() - 1);
 
-					lowestValues.insert(lowestValues.begin() + j, numbers[i]);
-					lowestIndices.insert(lowestIndices.begin() + j, i);
+		for (unsigned int index : indices)
+			lowestValues.push_back(numbers[index]);
 
-					j = amount;
-				}
-			}
-		}
+		// Filling Missing Values
+		while (lowestValues.size() < amount)
+			lowestValues.push_back(100000000.0f);
 
 
 		return lowestValues;
@@ -88,36 +73,14 @@ namespace gg
 
 	std::vector<int> lowestIndices(const std::vector<float>& numbers, const unsigned int amount)
 	{
-		// Init
-		std::vector<float> lowestValues;
-		std::vector<int> lowestIndices;
+		// Finding Lowest Values
+		std::vector<unsigned int> indices = selectLowestIndices(numbers, amount);
 
-		lowestValues.reserve(amount);
-		lowestIndices.reserve(amount);
+		std::vector<int> lowestIndices(indices.begin(), indices.end());
 
-		for (unsigned int i = 0; i < amount; i++)
-		{
-			lowestValues.push_back(100000000.0f);
+		// Filling Missing Indices
+		while (lowestIndices.size() < amount)
 			lowestIndices.push_back(-1);
-		}
-
-		// Finding Lowest Values
-		for (unsigned int i = 0; i < numbers.size(); i++)
-		{
-			for (unsigned int j = 0; j < amount; j++)
-			{
-				if (numbers[i] < lowestValues[j])
-				{
-					lowestValues.erase(lowestValues.end() - 1);
-					lowestIndices.erase(lowestIndices.end() - 1);
-
-					lowestValues.insert(lowestValues.begin() + j, numbers[i]);
-					lowestIndices.insert(lowestIndices.begin() + j, i);
-
-					j = amount;
-				}
-			}
-		}
 
 
 		return lowestIndices;
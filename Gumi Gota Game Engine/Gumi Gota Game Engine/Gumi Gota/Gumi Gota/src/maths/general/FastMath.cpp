@@ -0,0 +1,82 @@
+
+/* INCLUDES */
+// Self Include
+#include "FastMath.h"
+
+
+
+namespace gg
+{
+
+	/* ADDITIONAL FUNCTIONS */
+	static inline simdFloat4 s_loadTail(const float* values, const unsigned int count) //count is below 4; missing lanes are 1, so no function gets invalid input
+	{
+		float padded[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+		for (unsigned int i = 0; i < count; i++)
+			padded[i] = values[i];
+
+
+		return simdLoad(padded);
+	}
+
+	static inline void s_storeTail(float* results, const simdFloat4 value, const unsigned int count)
+	{
+		float padded[4];
+		simdStore(padded, value);
+
+		for (unsigned int i = 0; i < count; i++)
+			results[i] = padded[i];
+	}
+
+
+
+	/* FUNCTIONS */
+	void fastSineCosine(const float* radians, float* sines, float* cosines, const unsigned int count, const FastMathAccuracy accuracy)
+	{
+		simdFloat4 s, c;
+
+		// Full Groups
+		unsigned int i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			simdFastSineCosine(simdLoad(radians + i), s, c, accuracy);
+
+			simdStore(sines + i, s);
+			simdStore(cosines + i, c);
+		}
+
+		// Remaining Values
+		if (i == count)
+			return;
+
+		simdFastSineCosine(s_loadTail(radians + i, count - i), s, c, accuracy);
+
+		s_storeTail(sines + i, s, count - i);
+		s_storeTail(cosines + i, c, count - i);
+	}
+
+	void fastInverseSquareRoot(const float* values, float* results, const unsigned int count, const FastMathAccuracy accuracy)
+	{
+		// Full Groups
+		unsigned int i = 0;
+		for (; i + 4 <= count; i += 4)
+			simdStore(results + i, simdFastInverseSquareRoot(simdLoad(values + i), accuracy));
+
+		// Remaining Values
+		if (i < count)
+			s_storeTail(results + i, simdFastInverseSquareRoot(s_loadTail(values + i, count - i), accuracy), count - i);
+	}
+
+	void fastExponential(const float* values, float* results, const unsigned int count, const FastMathAccuracy accuracy)
+	{
+		// Full Groups
+		unsigned int i = 0;
+		for (; i + 4 <= count; i += 4)
+			simdStore(results + i, simdFastExponential(simdLoad(values + i), accuracy));
+
+		// Remaining Values
+		if (i < count)
+			s_storeTail(results + i, simdFastExponential(s_loadTail(values + i, count - i), accuracy), count - i);
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,199 @@
+#ifndef GUMIGOTA_FASTMATH_H
+#define GUMIGOTA_FASTMATH_H
+
+
+
+/* INCLUDES */
+// Header Includes
+#include "SIMD.h"
+
+
+
+/* DEFINITIONS */
+#define FAST_MATH_ROUNDING_MAGIC 12582912.0f //1.5 * 2^23; adding and subtracting it rounds float to nearest integer
+
+#define FAST_MATH_2_DIVIDED_BY_PI 0.636619772367581343f
+#define FAST_MATH_PI_DIVIDED_BY_2_PART0 1.5703125f //pi / 2 split in 3 parts, so quadrant * part is exact and reduced angle keeps its precision
+#define FAST_MATH_PI_DIVIDED_BY_2_PART1 4.837512969970703125e-4f
+#define FAST_MATH_PI_DIVIDED_BY_2_PART2 7.54978995489188216e-8f
+
+#define FAST_MATH_LOG2_E 1.44269504088896341f
+#define FAST_MATH_LN2_PART0 0.693359375f //ln 2 split in 2 parts, the same way as pi / 2
+#define FAST_MATH_LN2_PART1 -2.12194440e-4f
+#define FAST_MATH_EXPONENTIAL_MIN -87.3365447f //ln of smallest normal float
+#define FAST_MATH_EXPONENTIAL_MAX 88.3762626f //ln of biggest float that 2^127 * polynomial can't overflow
+
+#define FAST_MATH_INVERSE_SQUARE_ROOT_MAGIC 0x5f375a86
+
+
+
+namespace gg
+{
+
+	/* ADDITIONAL STUFF */
+	enum FastMathAccuracy
+	{
+		FAST_MATH_LOW = 0, //shorter polynomials and fewer newton steps; for visuals (particles, animation)
+		FAST_MATH_HIGH     //close to float precision; for transformations
+	};
+
+
+
+	/* FUNCTIONS */
+	// Measured Error Bounds (against double precision libm, see accuracy test in Engine Tester)
+	//   sine, cosine:        low 1.3e-5 absolute, high 1.0e-7 absolute; for |radians| < 8192, above it error grows with angle
+	//   inverse square root: low 1.8e-3 relative, high 1.6e-7 relative; for positive normal floats
+	//   exponential:         low 1.3e-4 relative, high 1.0e-7 relative; inputs are clamped to [-87.34, 88.38], so results never overflow or become denormal
+	// Scalar functions run the simd code on one lane, so scalar and vectorized results are the same bit for bit
+
+	// Vectorized
+	inline simdFloat4 simdRound(const simdFloat4 value) //to nearest integer, ties to even; |value| has to be below 2^22
+	{
+		simdFloat4 magic = simdSplat(FAST_MATH_ROUNDING_MAGIC);
+
+		return simdSubtract(simdAdd(value, magic), magic);
+	}
+
+	inline void simdFastSineCosine(const simdFloat4 radians, simdFloat4& sines, simdFloat4& cosines, const FastMathAccuracy accuracy = FAST_MATH_HIGH)
+	{
+		// Range Reduction (radians = quadrant * pi / 2 + r, where r is in [-pi / 4, pi / 4])
+		simdFloat4 quadrant = simdRound(simdMultiply(radians, simdSplat(FAST_MATH_2_DIVIDED_BY_PI)));
+
+		simdFloat4 r = simdSubtract(radians, simdMultiply(quadrant, simdSplat(FAST_MATH_PI_DIVIDED_BY_2_PART0)));
+		r = simdSubtract(r, simdMultiply(quadrant, simdSplat(FAST_MATH_PI_DIVIDED_BY_2_PART1)));
+		r = simdSubtract(r, simdMultiply(quadrant, simdSplat(FAST_MATH_PI_DIVIDED_BY_2_PART2)));
+
+		simdFloat4 r2 = simdMultiply(r, r);
+		simdFloat4 one = simdSplat(1.0f);
+
+		// Polynomials (minimax on [-pi / 4, pi / 4])
+		simdFloat4 s, c;
+
+		if (accuracy == FAST_MATH_LOW)
+		{
+			s = simdAdd(simdMultiply(simdSplat(8.15299234e-3f), r2), simdSplat(-1.66628338e-1f));
+			s = simdAdd(r, simdMultiply(simdMultiply(s, r2), r));
+
+			c = simdAdd(simdMultiply(simdSplat(4.04889358e-2f), r2), simdSplat(-4.99776307e-1f));
+			c = simdAdd(one, simdMultiply(c, r2));
+		}
+		else
+		{
+			s = simdAdd(simdMultiply(simdSplat(-1.9515295891e-4f), r2), simdSplat(8.3321608736e-3f));
+			s = simdAdd(simdMultiply(s, r2), simdSplat(-1.6666654611e-1f));
+			s = simdAdd(r, simdMultiply(simdMultiply(s, r2), r));
+
+			c = simdAdd(simdMultiply(simdSplat(2.443315711809948e-5f), r2), simdSplat(-1.388731625493765e-3f));
+			c = simdAdd(simdMultiply(c, r2), simdSplat(4.166664568298827e-2f));
+			c = simdAdd(simdSubtract(one, simdMultiply(r2, simdSplat(0.5f))), simdMultiply(simdMultiply(c, r2), r2));
+		}
+
+		// Quadrant (odd quadrants swap sine and cosine, bit 1 and bit 0 xor 1 flip their signs; computed with floats, so scalar code stays identical)
+		simdFloat4 half = simdRound(simdSubtract(simdMultiply(quadrant, simdSplat(0.5f)), simdSplat(0.25f))); //floor(quadrant / 2)
+		simdFloat4 odd = simdSubtract(quadrant, simdAdd(half, half));
+		simdFloat4 second = simdSubtract(half, simdMultiply(simdRound(simdSubtract(simdMultiply(half, simdSplat(0.5f)), simdSplat(0.25f))), simdSplat(2.0f)));
+
+		simdFloat4 even = simdSubtract(one, odd);
+		simdFloat4 sineSign = simdSubtract(one, simdAdd(second, second));
+		simdFloat4 cosineSign = simdMultiply(sineSign, simdSubtract(one, simdAdd(odd, odd)));
+
+		sines = simdMultiply(simdAdd(simdMultiply(s, even), simdMultiply(c, odd)), sineSign);
+		cosines = simdMultiply(simdAdd(simdMultiply(c, even), simdMultiply(s, odd)), cosineSign);
+	}
+
+	inline simdFloat4 simdFastSine(const simdFloat4 radians, const FastMathAccuracy accuracy = FAST_MATH_HIGH)
+	{
+		simdFloat4 sines, cosines;
+		simdFastSineCosine(radians, sines, cosines, accuracy);
+
+		return sines;
+	}
+
+	inline simdFloat4 simdFastCosine(const simdFloat4 radians, const FastMathAccuracy accuracy = FAST_MATH_HIGH)
+	{
+		simdFloat4 sines, cosines;
+		simdFastSineCosine(radians, sines, cosines, accuracy);
+
+		return cosines;
+	}
+
+	inline simdFloat4 simdFastInverseSquareRoot(const simdFloat4 value, const FastMathAccuracy accuracy = FAST_MATH_HIGH)
+	{
+		// Initial Guess (from float bits; the same on every cpu, unlike hardware estimates)
+		simdFloat4 result = simdAsFloat(simdIntSubtract(simdIntSplat(FAST_MATH_INVERSE_SQUARE_ROOT_MAGIC), simdIntShiftRight<1>(simdAsInt(value))));
+
+		// Newton Steps (every step roughly squares relative error)
+		simdFloat4 halfValue = simdMultiply(value, simdSplat(0.5f));
+		simdFloat4 threeHalves = simdSplat(1.5f);
+
+		unsigned int steps = accuracy == FAST_MATH_LOW ? 1 : 3;
+		for (unsigned int i = 0; i < steps; i++)
+			result = simdMultiply(result, simdSubtract(threeHalves, simdMultiply(halfValue, simdMultiply(result, result))));
+
+
+		return result;
+	}
+
+	inline simdFloat4 simdFastExponential(const simdFloat4 value, const FastMathAccuracy accuracy = FAST_MATH_HIGH)
+	{
+		// Range Reduction (e^value = 2^k * e^r, where r is in [-ln 2 / 2, ln 2 / 2])
+		simdFloat4 x = simdMaximum(simdMinimum(value, simdSplat(FAST_MATH_EXPONENTIAL_MAX)), simdSplat(FAST_MATH_EXPONENTIAL_MIN));
+		simdFloat4 k = simdRound(simdMultiply(x, simdSplat(FAST_MATH_LOG2_E)));
+
+		simdFloat4 r = simdSubtract(x, simdMultiply(k, simdSplat(FAST_MATH_LN2_PART0)));
+		r = simdSubtract(r, simdMultiply(k, simdSplat(FAST_MATH_LN2_PART1)));
+
+		simdFloat4 r2 = simdMultiply(r, r);
+		simdFloat4 one = simdSplat(1.0f);
+
+		// Polynomial (minimax on [-ln 2 / 2, ln 2 / 2])
+		simdFloat4 p;
+
+		if (accuracy == FAST_MATH_LOW)
+		{
+			p = simdAdd(simdMultiply(simdSplat(1.66628108e-1f), r), simdSplat(5.03941027e-1f));
+		}
+		else
+		{
+			p = simdAdd(simdMultiply(simdSplat(1.9875691500e-4f), r), simdSplat(1.3981999507e-3f));
+			p = simdAdd(simdMultiply(p, r), simdSplat(8.3334519073e-3f));
+			p = simdAdd(simdMultiply(p, r), simdSplat(4.1665795894e-2f));
+			p = simdAdd(simdMultiply(p, r), simdSplat(1.6666665459e-1f));
+			p = simdAdd(simdMultiply(p, r), simdSplat(5.0000001201e-1f));
+		}
+
+		p = simdAdd(simdAdd(simdMultiply(p, r2), r), one);
+
+		// Scaling by 2^k (built directly in exponent bits)
+		simdFloat4 scale = simdAsFloat(simdIntShiftLeft<23>(simdIntAdd(simdConvertToInt(k), simdIntSplat(127))));
+
+
+		return simdMultiply(p, scale);
+	}
+
+	// Scalar
+	inline void fastSineCosine(const float radians, float& sine, float& cosine, const FastMathAccuracy accuracy = FAST_MATH_HIGH)
+	{
+		simdFloat4 sines, cosines;
+		simdFastSineCosine(simdSplat(radians), sines, cosines, accuracy);
+
+		sine = simdGetX(sines);
+		cosine = simdGetX(cosines);
+	}
+
+	inline float fastSine(const float radians, const FastMathAccuracy accuracy = FAST_MATH_HIGH)   { return simdGetX(simdFastSine(simdSplat(radians), accuracy));   }
+	inline float fastCosine(const float radians, const FastMathAccuracy accuracy = FAST_MATH_HIGH) { return simdGetX(simdFastCosine(simdSplat(radians), accuracy)); }
+
+	inline float fastInverseSquareRoot(const float value, const FastMathAccuracy accuracy = FAST_MATH_HIGH) { return simdGetX(simdFastInverseSquareRoot(simdSplat(value), accuracy)); }
+	inline float fastExponential(const float value, const FastMathAccuracy accuracy = FAST_MATH_HIGH)       { return simdGetX(simdFastExponential(simdSplat(value), accuracy));       }
+
+	// Arrays (4 values per simd operation; defined in FastMath.cpp)
+	void fastSineCosine(const float* radians, float* sines, float* cosines, const unsigned int count, const FastMathAccuracy accuracy = FAST_MATH_HIGH);
+	void fastInverseSquareRoot(const float* values, float* results, const unsigned int count, const FastMathAccuracy accuracy = FAST_MATH_HIGH);
+	void fastExponential(const float* values, float* results, const unsigned int count, const FastMathAccuracy accuracy = FAST_MATH_HIGH);
+
+}
+
+
+
+#endif
\ No newline at end of file
@@ -0,0 +1,326 @@
+#ifndef GUMIGOTA_SIMD_H
+#define GUMIGOTA_SIMD_H
+
+
+
+/* DEFINITIONS */
+#ifndef GUMIGOTA_MATHS_SCALAR //define it for checking scalar code; results are the same bit for bit
+	#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define GUMIGOTA_MATHS_SSE //sse2 is part of every x64 cpu (and default for 32-bit msvc builds), so no runtime check is needed
+	#elif defined(__ARM_NEON) && defined(__aarch64__)
+		#define GUMIGOTA_MATHS_NEON //32-bit neon has no division, so it uses scalar code
+	#endif
+#endif
+
+
+
+/* INCLUDES */
+// Intrinsics Includes
+#if defined(GUMIGOTA_MATHS_SSE)
+	#include <emmintrin.h>
+#elif defined(GUMIGOTA_MATHS_NEON)
+	#include <arm_neon.h>
+#else
+	#include <cstring>
+#endif
+
+
+
+namespace gg
+{
+
+	/* ADDITIONAL STUFF */
+#if defined(GUMIGOTA_MATHS_SSE)
+	typedef __m128 simdFloat4;
+	typedef __m128i simdInt4;
+#elif defined(GUMIGOTA_MATHS_NEON)
+	typedef float32x4_t simdFloat4;
+	typedef int32x4_t simdInt4;
+#else
+	struct simdFloat4
+	{
+		float lanes[4];
+	};
+
+	struct simdInt4
+	{
+		int lanes[4];
+	};
+#endif
+
+
+
+	/* FUNCTIONS */
+	// Four floats processed at once; every function is a plain per-lane operation (no fused multiply-add, no approximations), so scalar code gives the same results
+	inline simdFloat4 simdLoad(const float* values) //values don't have to be aligned
+	{
+#if defined(GUMIGOTA_MATHS_SSE)
+		return _mm_loadu_ps(values);
+#elif defined(GUMIGOTA_MATHS_NEON)
+		return vld1q_f32(values);
+#else
+		simdFloat4 result = { { values[0], values[1], values[2], values[3] } };
+		return result;
+#endif
+	}
+
+	inline void simdStore(float* result, const simdFloat4 value)
+	{
+#if defined(GUMIGOTA_MATHS_SSE)
+		_mm_storeu_ps(result, value);
+#elif defined(GUMIGOTA_MATHS_NEON)
+		vst1q_f32(result, value);
+#else
+		for (unsigned int i = 0; i < 4; i++)
+			result[i] = value.lanes[i];
+#endif
+	}
+
+	inline simdFloat4 simdSet(const float x, const float y, const float z, const float w)
+	{
+#if defined(GUMIGOTA_MATHS_SSE)
+		return _mm_setr_ps(x, y, z, w);
+#elif defined(GUMIGOTA_MATHS_NEON)
+		float values[4] = { x, y, z, w };
+		return vld1q_f32(values);
+#else
+		simdFloat4 result = { { x, y, z, w } };
+		return result;
+#endif
+	}
+
+	inline simdFloat4 simdSplat(const float value)
+	{
+#if defined(GUMIGOTA_MATHS_SSE)
+		return _mm_set1_ps(value);
+#elif defined(GUMIGOTA_MATHS_NEON)
+		return vdupq_n_f32(value);
+#else
+		simdFloat4 result = { { value, value, value, value } };
+		return result;
+#endif
+	}
+
+	inline float simdGetX(const simdFloat4 value)
+	{
+#if defined(GUMIGOTA_MATHS_SSE)
+		return _mm_cvtss_f32(value);
+#elif defined(GUMIGOTA_MATHS_NEON)
+		return vgetq_lane_f32(value, 0);
+#else
+		return value.lanes[0];
+#endif
+	}
+
+
+	inline simdFloat4 simdAdd(const simdFloat4 left, const simdFloat4 right)
+	{
+#if defined(GUMIGOTA_MATHS_SSE)
+		return _mm_add_ps(left, right);
+#elif defined(GUMIGOTA_MATHS_NEON)
+		return vaddq_f32(left, right);
+#else
+		simdFloat4 result = { { left.lanes[0] + right.lanes[0], left.lanes[1] + right.lanes[1], left.lanes[2] + right.lanes[2], left.lanes[3] + right.lanes[3] } };
+		return result;
+#endif
+	}
+
+	inline simdFloat4 simdSubtract(const simdFloat4 left, const simdFloat4 right)
+	{
+#if defined(GUMIGOTA_MATHS_SSE)
+		return _mm_sub_ps(left, right);
+#elif defined(GUMIGOTA_MATHS_NEON)
+		return vsubq_f32(left, right);
+#else
+		simdFloat4 result = { { left.lanes[0] - right.lanes[0], left.lanes[1] - right.lanes[1], left.lanes[2] - right.lanes[2], left.lanes[3] - right.lanes[3] } };
+		return result;
+#endif
+	}
+
+	inline simdFloat4 simdMultiply(const simdFloat4 left, const simdFloat4 right)
+	{
+#if defined(GUMIGOTA_MATHS_SSE)
+		return _mm_mul_ps(left, right);
+#elif defined(GUMIGOTA_MATHS_NEON)
+		return vmulq_f32(left, right);
+#else
+		simdFloat4 result = { { left.lanes[0] * right.lanes[0], left.lanes[1] * right.lanes[1], left.lanes[2] * right.lanes[2], left.lanes[3] * right.lanes[3] } };
+		return result;
+#endif
+	}
+
+	inline simdFloat4 simdDivide(const simdFloat4 left, const simdFloat4 right)
+	{
+#if defined(GUMIGOTA_MATHS_SSE)
+		return _mm_div_ps(left, right);
+#elif defined(GUMIGOTA_MATHS_NEON)
+		return vdivq_f32(left, right);
+#else
+		simdFloat4 result = { { left.lanes[0] / right.lanes[0], left.lanes[1] / right.lanes[1], left.lanes[2] / right.lanes[2], left.lanes[3] / right.lanes[3] } };
+		return result;
+#endif
+	}
+
+	inline simdFloat4 simdMinimum(const simdFloat4 left, const simdFloat4 right)
+	{
+#if defined(GUMIGOTA_MATHS_SSE)
+		return _mm_min_ps(left, right);
+#elif defined(GUMIGOTA_MATHS_NEON)
+		return vminq_f32(left, right);
+#else
+		simdFloat4 result;
+		for (unsigned int i = 0; i < 4; i++)
+			result.lanes[i] = left.lanes[i] < right.lanes[i] ? left.lanes[i] : right.lanes[i];
+		return result;
+#endif
+	}
+
+	inline simdFloat4 simdMaximum(const simdFloat4 left, const simdFloat4 right)
+	{
+#if defined(GUMIGOTA_MATHS_SSE)
+		return _mm_max_ps(left, right);
+#elif defined(GUMIGOTA_MATHS_NEON)
+		return vmaxq_f32(left, right);
+#else
+		simdFloat4 result;
+		for (unsigned int i = 0; i < 4; i++)
+			result.lanes[i] = left.lanes[i] > right.lanes[i] ? left.lanes[i] : right.lanes[i];
+		return result;
+#endif
+	}
+
+
+	// Four 32-bit integers; used for building and reading float bits
+	inline simdInt4 simdAsInt(const simdFloat4 value) //bits aren't changed
+	{
+#if defined(GUMIGOTA_MATHS_SSE)
+		return _mm_castps_si128(value);
+#elif defined(GUMIGOTA_MATHS_NEON)
+		return vreinterpretq_s32_f32(value);
+#else
+		simdInt4 result;
+		std::memcpy(result.lanes, value.lanes, sizeof(result.lanes));
+		return result;
+#endif
+	}
+
+	inline simdFloat4 simdAsFloat(const simdInt4 value) //bits aren't changed
+	{
+#if defined(GUMIGOTA_MATHS_SSE)
+		return _mm_castsi128_ps(value);
+#elif defined(GUMIGOTA_MATHS_NEON)
+		return vreinterpretq_f32_s32(value);
+#else
+		simdFloat4 result;
+		std::memcpy(result.lanes, value.lanes, sizeof(result.lanes));
+		return result;
+#endif
+	}
+
+	inline simdInt4 simdConvertToInt(const simdFloat4 value) //rounds toward zero
+	{
+#if defined(GUMIGOTA_MATHS_SSE)
+		return _mm_cvttps_epi32(value);
+#elif defined(GUMIGOTA_MATHS_NEON)
+		return vcvtq_s32_f32(value);
+#else
+		simdInt4 result = { { (int)value.lanes[0], (int)value.lanes[1], (int)value.lanes[2], (int)value.lanes[3] } };
+		return result;
+#endif
+	}
+
+	inline simdInt4 simdIntSplat(const int value)
+	{
+#if defined(GUMIGOTA_MATHS_SSE)
+		return _mm_set1_epi32(value);
+#elif defined(GUMIGOTA_MATHS_NEON)
+		return vdupq_n_s32(value);
+#else
+		simdInt4 result = { { value, value, value, value } };
+		return result;
+#endif
+	}
+
+	inline simdInt4 simdIntAdd(const simdInt4 left, const simdInt4 right)
+	{
+#if defined(GUMIGOTA_MATHS_SSE)
+		return _mm_add_epi32(left, right);
+#elif defined(GUMIGOTA_MATHS_NEON)
+		return vaddq_s32(left, right);
+#else
+		simdInt4 result = { { left.lanes[0] + right.lanes[0], left.lanes[1] + right.lanes[1], left.lanes[2] + right.lanes[2], left.lanes[3] + right.lanes[3] } };
+		return result;
+#endif
+	}
+
+	inline simdInt4 simdIntSubtract(const simdInt4 left, const simdInt4 right)
+	{
+#if defined(GUMIGOTA_MATHS_SSE)
+		return _mm_sub_epi32(left, right);
+#elif defined(GUMIGOTA_MATHS_NEON)
+		return vsubq_s32(left, right);
+#else
+		simdInt4 result = { { left.lanes[0] - right.lanes[0], left.lanes[1] - right.lanes[1], left.lanes[2] - right.lanes[2], left.lanes[3] - right.lanes[3] } };
+		return result;
+#endif
+	}
+
+	template<int count>
+	inline simdInt4 simdIntShiftLeft(const simdInt4 value) //value has to be positive
+	{
+#if defined(GUMIGOTA_MATHS_SSE)
+		return _mm_slli_epi32(value, count);
+#elif defined(GUMIGOTA_MATHS_NEON)
+		return vshlq_n_s32(value, count);
+#else
+		simdInt4 result = { { value.lanes[0] << count, value.lanes[1] << count, value.lanes[2] << count, value.lanes[3] << count } };
+		return result;
+#endif
+	}
+
+	template<int count>
+	inline simdInt4 simdIntShiftRight(const simdInt4 value) //value has to be positive
+	{
+#if defined(GUMIGOTA_MATHS_SSE)
+		return _mm_srai_epi32(value, count);
+#elif defined(GUMIGOTA_MATHS_NEON)
+		return vshrq_n_s32(value, count);
+#else
+		simdInt4 result = { { value.lanes[0] >> count, value.lanes[1] >> count, value.lanes[2] >> count, value.lanes[3] >> count } };
+		return result;
+#endif
+	}
+
+
+	template<unsigned int i0, unsigned int i1, unsigned int i2, unsigned int i3>
+	inline simdFloat4 simdShuffle(const simdFloat4 left, const simdFloat4 right) //returns (left[i0], left[i1], right[i2], right[i3])
+	{
+#if defined(GUMIGOTA_MATHS_SSE)
+		return _mm_shuffle_ps(left, right, _MM_SHUFFLE(i3, i2, i1, i0));
+#elif defined(GUMIGOTA_MATHS_NEON)
+		float values[4] = { vgetq_lane_f32(left, i0), vgetq_lane_f32(left, i1), vgetq_lane_f32(right, i2), vgetq_lane_f32(right, i3) };
+		return vld1q_f32(values);
+#else
+		simdFloat4 result = { { left.lanes[i0], left.lanes[i1], right.lanes[i2], right.lanes[i3] } };
+		return result;
+#endif
+	}
+
+	inline void simdTranspose(simdFloat4& v0, simdFloat4& v1, simdFloat4& v2, simdFloat4& v3)
+	{
+		simdFloat4 t0 = simdShuffle<0, 1, 0, 1>(v0, v1);
+		simdFloat4 t1 = simdShuffle<2, 3, 2, 3>(v0, v1);
+		simdFloat4 t2 = simdShuffle<0, 1, 0, 1>(v2, v3);
+		simdFloat4 t3 = simdShuffle<2, 3, 2, 3>(v2, v3);
+
+		v0 = simdShuffle<0, 2, 0, 2>(t0, t2);
+		v1 = simdShuffle<1, 3, 1, 3>(t0, t2);
+		v2 = simdShuffle<0, 2, 0, 2>(t1, t3);
+		v3 = simdShuffle<1, 3, 1, 3>(t1, t3);
+	}
+
+}
+
+
+
+#endif
\ No newline at end of file
@@ -0,0 +1,184 @@
+
+/* INCLUDES */
+// Self Include
+#include "BatchTransformations.h"
+
+// Header Includes
+#include "../general/FastMath.h"
+
+#include "../../utils/ThreadPool.h"
+
+
+
+namespace gg
+{
+
+	/* ADDITIONAL FUNCTIONS */
+	static inline simdFloat4 s_loadLanes(const float* values, const unsigned int index, const unsigned int laneCount) //missing lanes of last group are zero
+	{
+		if (laneCount == 4)
+			return simdLoad(values + index);
+
+		float padded[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		for (unsigned int i = 0; i < laneCount; i++)
+			padded[i] = values[index + i];
+
+
+		return simdLoad(padded);
+	}
+
+	static inline void s_storeMatrices(matrix4* results, const unsigned int laneCount, simdFloat4 columns[4][4]) //columns[c][r] holds element (r, c) of all 4 objects
+	{
+		for (unsigned int c = 0; c < 4; c++)
+		{
+			simdTranspose(columns[c][0], columns[c][1], columns[c][2], columns[c][3]); //now columns[c][i] is column c of object i
+
+			for (unsigned int i = 0; i < laneCount; i++)
+				simdStore(results[i].elements + c * 4, columns[c][i]);
+		}
+	}
+
+	static inline void s_setTranslationColumn(simdFloat4 column[4], const float* positionX, const float* positionY, const float* positionZ, const unsigned int index, const unsigned int laneCount)
+	{
+		column[0] = s_loadLanes(positionX, index, laneCount);
+		column[1] = s_loadLanes(positionY, index, laneCount);
+		column[2] = s_loadLanes(positionZ, index, laneCount);
+		column[3] = simdSplat(1.0f);
+	}
+
+	static void s_eulerModelMatrices(matrix4* results, const EulerTransformArrays& transforms, const unsigned int index, const unsigned int laneCount)
+	{
+		// Sines and Cosines (polynomial, 4 objects at once)
+		simdFloat4 sinX, cosX, sinY, cosY, sinZ, cosZ;
+		simdFastSineCosine(s_loadLanes(transforms.rotationX, index, laneCount), sinX, cosX);
+		simdFastSineCosine(s_loadLanes(transforms.rotationY, index, laneCount), sinY, cosY);
+		simdFastSineCosine(s_loadLanes(transforms.rotationZ, index, laneCount), sinZ, cosZ);
+
+		// Scale
+		simdFloat4 scaleX = s_loadLanes(transforms.scaleX, index, laneCount);
+		simdFloat4 scaleY = transforms.scaleY != nullptr ? s_loadLanes(transforms.scaleY, index, laneCount) : scaleX;
+		simdFloat4 scaleZ = transforms.scaleZ != nullptr ? s_loadLanes(transforms.scaleZ, index, laneCount) : scaleX;
+
+		// Rotation X * Rotation Y * Rotation Z, Columns Multiplied by Scale
+		simdFloat4 zero = simdSplat(0.0f);
+		simdFloat4 sinXsinY = simdMultiply(sinX, sinY);
+		simdFloat4 cosXsinY = simdMultiply(cosX, sinY);
+
+		simdFloat4 columns[4][4];
+
+		columns[0][0] = simdMultiply(simdMultiply(cosY, cosZ), scaleX);
+		columns[0][1] = simdMultiply(simdAdd(simdMultiply(cosX, sinZ), simdMultiply(sinXsinY, cosZ)), scaleX);
+		columns[0][2] = simdMultiply(simdSubtract(simdMultiply(sinX, sinZ), simdMultiply(cosXsinY, cosZ)), scaleX);
+		columns[0][3] = zero;
+
+		columns[1][0] = simdMultiply(simdSubtract(zero, simdMultiply(cosY, sinZ)), scaleY);
+		columns[1][1] = simdMultiply(simdSubtract(simdMultiply(cosX, cosZ), simdMultiply(sinXsinY, sinZ)), scaleY);
+		columns[1][2] = simdMultiply(simdAdd(simdMultiply(sinX, cosZ), simdMultiply(cosXsinY, sinZ)), scaleY);
+		columns[1][3] = zero;
+
+		columns[2][0] = simdMultiply(sinY, scaleZ);
+		columns[2][1] = simdMultiply(simdSubtract(zero, simdMultiply(sinX, cosY)), scaleZ);
+		columns[2][2] = simdMultiply(simdMultiply(cosX, cosY), scaleZ);
+		columns[2][3] = zero;
+
+		s_setTranslationColumn(columns[3], transforms.positionX, transforms.positionY, transforms.positionZ, index, laneCount);
+
+		// Writing
+		s_storeMatrices(results, laneCount, columns);
+	}
+
+	static void s_quaternionModelMatrices(matrix4* results, const QuaternionTransformArrays& transforms, const unsigned int index, const unsigned int laneCount)
+	{
+		// Quaternion Products
+		simdFloat4 x = s_loadLanes(transforms.rotationX, index, laneCount);
+		simdFloat4 y = s_loadLanes(transforms.rotationY, index, laneCount);
+		simdFloat4 z = s_loadLanes(transforms.rotationZ, index, laneCount);
+		simdFloat4 w = s_loadLanes(transforms.rotationW, index, laneCount);
+
+		simdFloat4 x2 = simdAdd(x, x), y2 = simdAdd(y, y), z2 = simdAdd(z, z);
+
+		simdFloat4 xx = simdMultiply(x, x2), xy = simdMultiply(x, y2), xz = simdMultiply(x, z2);
+		simdFloat4 yy = simdMultiply(y, y2), yz = simdMultiply(y, z2), zz = simdMultiply(z, z2);
+		simdFloat4 wx = simdMultiply(w, x2), wy = simdMultiply(w, y2), wz = simdMultiply(w, z2);
+
+		// Scale
+		simdFloat4 scaleX = s_loadLanes(transforms.scaleX, index, laneCount);
+		simdFloat4 scaleY = transforms.scaleY != nullptr ? s_loadLanes(transforms.scaleY, index, laneCount) : scaleX;
+		simdFloat4 scaleZ = transforms.scaleZ != nullptr ? s_loadLanes(transforms.scaleZ, index, laneCount) : scaleX;
+
+		// Rotation, Columns Multiplied by Scale
+		simdFloat4 zero = simdSplat(0.0f);
+		simdFloat4 one = simdSplat(1.0f);
+
+		simdFloat4 columns[4][4];
+
+		columns[0][0] = simdMultiply(simdSubtract(one, simdAdd(yy, zz)), scaleX);
+		columns[0][1] = simdMultiply(simdAdd(xy, wz), scaleX);
+		columns[0][2] = simdMultiply(simdSubtract(xz, wy), scaleX);
+		columns[0][3] = zero;
+
+		columns[1][0] = simdMultiply(simdSubtract(xy, wz), scaleY);
+		columns[1][1] = simdMultiply(simdSubtract(one, simdAdd(xx, zz)), scaleY);
+		columns[1][2] = simdMultiply(simdAdd(yz, wx), scaleY);
+		columns[1][3] = zero;
+
+		columns[2][0] = simdMultiply(simdAdd(xz, wy), scaleZ);
+		columns[2][1] = simdMultiply(simdSubtract(yz, wx), scaleZ);
+		columns[2][2] = simdMultiply(simdSubtract(one, simdAdd(xx, yy)), scaleZ);
+		columns[2][3] = zero;
+
+		s_setTranslationColumn(columns[3], transforms.positionX, transforms.positionY, transforms.positionZ, index, laneCount);
+
+		// Writing
+		s_storeMatrices(results, laneCount, columns);
+	}
+
+	template<typename TransformArrays>
+	static void s_modelMatricesParallel(matrix4* results, const TransformArrays& transforms, const unsigned int count, ThreadPool& pool)
+	{
+		unsigned int taskCount = (count + BATCH_TRANSFORMATIONS_PARALLEL_CHUNK - 1) / BATCH_TRANSFORMATIONS_PARALLEL_CHUNK;
+
+		// Building on Calling Thread
+		if (taskCount <= 1 || pool.getThreadCount() == 1)
+		{
+			modelMatrices(results, transforms, 0, count);
+			return;
+		}
+
+		// Building on All Threads
+		pool.run(taskCount, [results, &transforms, count](const unsigned int task)
+		{
+			unsigned int first = task * BATCH_TRANSFORMATIONS_PARALLEL_CHUNK;
+			unsigned int chunkCount = count - first < BATCH_TRANSFORMATIONS_PARALLEL_CHUNK ? count - first : BATCH_TRANSFORMATIONS_PARALLEL_CHUNK;
+
+			modelMatrices(results + first, transforms, first, chunkCount);
+		});
+	}
+
+
+
+	/* FUNCTIONS */
+	void modelMatrices(matrix4* results, const EulerTransformArrays& transforms, const unsigned int first, const unsigned int count)
+	{
+		for (unsigned int i = 0; i < count; i += 4)
+			s_eulerModelMatrices(results + i, transforms, first + i, count - i < 4 ? count - i : 4);
+	}
+
+	void modelMatrices(matrix4* results, const QuaternionTransformArrays& transforms, const unsigned int first, const unsigned int count)
+	{
+		for (unsigned int i = 0; i < count; i += 4)
+			s_quaternionModelMatrices(results + i, transforms, first + i, count - i < 4 ? count - i : 4);
+	}
+
+
+	void modelMatrices(matrix4* results, const EulerTransformArrays& transforms, const unsigned int count, ThreadPool& pool)
+	{
+		s_modelMatricesParallel(results, transforms, count, pool);
+	}
+
+	void modelMatrices(matrix4* results, const QuaternionTransformArrays& transforms, const unsigned int count, ThreadPool& pool)
+	{
+		s_modelMatricesParallel(results, transforms, count, pool);
+	}
+
+}
\ No newline at end of file
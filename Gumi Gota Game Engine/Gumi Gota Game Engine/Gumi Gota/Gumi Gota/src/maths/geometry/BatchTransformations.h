@@ -0,0 +1,69 @@
+#ifndef GUMIGOTA_BATCHTRANSFORMATIONS_H
+#define GUMIGOTA_BATCHTRANSFORMATIONS_H
+
+
+
+/* INCLUDES */
+// Header Includes
+#include "../matrices/matrix4.h"
+
+
+
+/* DEFINITIONS */
+#define BATCH_TRANSFORMATIONS_PARALLEL_CHUNK 4096 //objects per task of parallel variants; multiple of 4, so only the last task has partial simd group
+
+
+
+namespace gg
+{
+
+	/* ADDITIONAL STUFF */
+	class ThreadPool;
+
+	struct EulerTransformArrays //soa input; every array has at least first + count elements
+	{
+		const float* positionX;
+		const float* positionY;
+		const float* positionZ;
+
+		const float* rotationX; //radians; composed like matrix4::model (x, then y, then z rotation)
+		const float* rotationY;
+		const float* rotationZ;
+
+		const float* scaleX;
+		const float* scaleY; //nullptr for uniform scale (scaleX is used)
+		const float* scaleZ; //nullptr for uniform scale (scaleX is used)
+	};
+
+	struct QuaternionTransformArrays //soa input; every array has at least first + count elements
+	{
+		const float* positionX;
+		const float* positionY;
+		const float* positionZ;
+
+		const float* rotationX; //unit quaternion (x, y, z, w)
+		const float* rotationY;
+		const float* rotationZ;
+		const float* rotationW;
+
+		const float* scaleX;
+		const float* scaleY; //nullptr for uniform scale (scaleX is used)
+		const float* scaleZ; //nullptr for uniform scale (scaleX is used)
+	};
+
+
+
+	/* FUNCTIONS */
+	// Write count model matrices (translation * rotation * scale) to results[0..count); matrices are built in closed form, 4 objects per simd operation
+	void modelMatrices(matrix4* results, const EulerTransformArrays& transforms, const unsigned int first, const unsigned int count);
+	void modelMatrices(matrix4* results, const QuaternionTransformArrays& transforms, const unsigned int first, const unsigned int count);
+
+	// Parallel variants split objects into chunks run on pool (calling thread included); worth it for tens of thousands of objects
+	void modelMatrices(matrix4* results, const EulerTransformArrays& transforms, const unsigned int count, ThreadPool& pool);
+	void modelMatrices(matrix4* results, const QuaternionTransformArrays& transforms, const unsigned int count, ThreadPool& pool);
+
+}
+
+
+
+#endif
\ No newline at end of file
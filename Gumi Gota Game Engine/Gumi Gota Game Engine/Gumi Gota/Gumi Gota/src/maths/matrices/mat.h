@@ -0,0 +1,301 @@
+#ifndef GUMIGOTA_MAT_H
+#define GUMIGOTA_MAT_H
+
+
+
+/* INCLUDES */
+// Header Includes
+#include "../vectors/vec.h"
+
+
+
+namespace gg
+{
+
+	template<unsigned int R, unsigned int C, typename T>
+	struct alignas(R == 4 && sizeof(T) == 4 ? 16 : alignof(T)) mat //R rows and C columns; float 4x4 matrices are aligned, so every column fits one simd register
+	{
+		/* Variables */
+		T elements[R * C]; //column major
+
+		/* Constructors */
+		constexpr mat() : elements() {}
+		constexpr mat(const T& diagonal) : elements() { for (unsigned int i = 0; i < R && i < C; i++) elements[i + i * R] = diagonal; }
+		constexpr mat(const T values[R * C]) : elements() { for (unsigned int i = 0; i < R * C; i++) elements[i] = values[i]; }
+
+		/* Functions */
+		constexpr mat& multiply(const mat& other); //square matrices only
+
+		constexpr T determinant() const; //4x4 only
+
+		// Matrices Functions
+		static constexpr mat identity() { return mat(T(1)); }
+
+
+		static constexpr mat invert(const mat& matrix); //4x4 only; returns zero matrix if matrix can't be inverted
+		static constexpr mat<C, R, T> transpose(const mat& matrix);
+
+
+		// 4x4 Transformations (constexpr ones can be used for constants)
+		static constexpr mat translation(const vec<3, T>& position);
+		static mat rotation(const T radians, const vec<3, T>& axis);
+		static constexpr mat scale(const T scale);
+		static constexpr mat scale(const vec<3, T>& scale);
+
+		static mat model(const vec<3, T>& position, const T rotX, const T rotY, const T rotZ, const T scale); // rotations are given in radians
+		static mat model(const vec<3, T>& position, const T rotX, const T rotY, const T rotZ, const vec<3, T>& scale); // rotations are given in radians
+		static mat model(const vec<3, T>& position, const T rot, const vec<3, T>& rotAxis, const T scale); // rotations are given in radians
+		static mat model(const vec<3, T>& position, const T rot, const vec<3, T>& rotAxis, const vec<3, T>& scale); // rotations are given in radians
+
+
+		static mat fpsView(const vec<3, T>& position, const T pitch, const T yaw); // pitch and yaw are given in radians
+		static mat lookAtView(const vec<3, T>& cameraPosition, const vec<3, T>& lookAtPosition, const vec<3, T>& upVector);
+
+		static constexpr mat orthographic(const T left, const T right, const T bottom, const T top, const T near, const T far);
+		static mat projection(const T aspectRatio, const T fov, const T zNear, const T zFar); // fov is given in radians
+
+		/* Operator Overloads */
+		constexpr mat& operator*=(const mat& other) { return multiply(other); }
+
+	private:
+		// Private Functions
+		constexpr T m_element(const unsigned int row, const unsigned int column) const { return elements[row + column * R]; }
+
+	};
+
+	// Trigonometric transformations (rotation, model, fpsView, lookAtView, projection) are defined for float matrices only, in matrix4.cpp
+
+
+
+	/* FUNCTIONS */
+	// Functions
+	template<unsigned int R, unsigned int C, typename T>
+	constexpr mat<R, C, T>& mat<R, C, T>::multiply(const mat& other)
+	{
+		static_assert(R == C, "only square matrices can be multiplied in place");
+
+		mat result;
+
+		for (unsigned int y = 0; y < C; y++)
+		{
+			for (unsigned int x = 0; x < R; x++)
+			{
+				T sum = T(0);
+
+				for (unsigned int i = 0; i < C; i++)
+					sum += elements[x + i * R] * other.elements[i + y * R];
+
+				result.elements[x + y * R] = sum;
+			}
+		}
+
+		*this = result;
+
+
+		return *this;
+	}
+
+	template<unsigned int R, unsigned int C, typename T>
+	constexpr T mat<R, C, T>::determinant() const
+	{
+		static_assert(R == 4 && C == 4, "determinant is implemented for 4x4 matrices only");
+
+		// 2x2 Determinants of Upper and Lower Row Pairs
+		T s0 = m_element(0, 0) * m_element(1, 1) - m_element(1, 0) * m_element(0, 1);
+		T s1 = m_element(0, 0) * m_element(1, 2) - m_element(1, 0) * m_element(0, 2);
+		T s2 = m_element(0, 0) * m_element(1, 3) - m_element(1, 0) * m_element(0, 3);
+		T s3 = m_element(0, 1) * m_element(1, 2) - m_element(1, 1) * m_element(0, 2);
+		T s4 = m_element(0, 1) * m_element(1, 3) - m_element(1, 1) * m_element(0, 3);
+		T s5 = m_element(0, 2) * m_element(1, 3) - m_element(1, 2) * m_element(0, 3);
+
+		T c5 = m_element(2, 2) * m_element(3, 3) - m_element(3, 2) * m_element(2, 3);
+		T c4 = m_element(2, 1) * m_element(3, 3) - m_element(3, 1) * m_element(2, 3);
+		T c3 = m_element(2, 1) * m_element(3, 2) - m_element(3, 1) * m_element(2, 2);
+		T c2 = m_element(2, 0) * m_element(3, 3) - m_element(3, 0) * m_element(2, 3);
+		T c1 = m_element(2, 0) * m_element(3, 2) - m_element(3, 0) * m_element(2, 2);
+		T c0 = m_element(2, 0) * m_element(3, 1) - m_element(3, 0) * m_element(2, 1);
+
+
+		return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+	}
+
+	// Matrices Functions
+	template<unsigned int R, unsigned int C, typename T>
+	constexpr mat<R, C, T> mat<R, C, T>::invert(const mat& matrix)
+	{
+		static_assert(R == 4 && C == 4, "invert is implemented for 4x4 matrices only");
+
+		// Init
+		mat result;
+
+		T det = matrix.determinant();
+		if (det == T(0))
+			return result;
+
+		// 2x2 Determinants of Upper and Lower Row Pairs
+		T s0 = matrix.m_element(0, 0) * matrix.m_element(1, 1) - matrix.m_element(1, 0) * matrix.m_element(0, 1);
+		T s1 = matrix.m_element(0, 0) * matrix.m_element(1, 2) - matrix.m_element(1, 0) * matrix.m_element(0, 2);
+		T s2 = matrix.m_element(0, 0) * matrix.m_element(1, 3) - matrix.m_element(1, 0) * matrix.m_element(0, 3);
+		T s3 = matrix.m_element(0, 1) * matrix.m_element(1, 2) - matrix.m_element(1, 1) * matrix.m_element(0, 2);
+		T s4 = matrix.m_element(0, 1) * matrix.m_element(1, 3) - matrix.m_element(1, 1) * matrix.m_element(0, 3);
+		T s5 = matrix.m_element(0, 2) * matrix.m_element(1, 3) - matrix.m_element(1, 2) * matrix.m_element(0, 3);
+
+		T c5 = matrix.m_element(2, 2) * matrix.m_element(3, 3) - matrix.m_element(3, 2) * matrix.m_element(2, 3);
+		T c4 = matrix.m_element(2, 1) * matrix.m_element(3, 3) - matrix.m_element(3, 1) * matrix.m_element(2, 3);
+		T c3 = matrix.m_element(2, 1) * matrix.m_element(3, 2) - matrix.m_element(3, 1) * matrix.m_element(2, 2);
+		T c2 = matrix.m_element(2, 0) * matrix.m_element(3, 3) - matrix.m_element(3, 0) * matrix.m_element(2, 3);
+		T c1 = matrix.m_element(2, 0) * matrix.m_element(3, 2) - matrix.m_element(3, 0) * matrix.m_element(2, 2);
+		T c0 = matrix.m_element(2, 0) * matrix.m_element(3, 1) - matrix.m_element(3, 0) * matrix.m_element(2, 1);
+
+		// Adjugate Divided by Determinant (element at row r and column c is stored at r + c * 4)
+		result.elements[0 + 0 * 4] = ( matrix.m_element(1, 1) * c5 - matrix.m_element(1, 2) * c4 + matrix.m_element(1, 3) * c3) / det;
+		result.elements[0 + 1 * 4] = (-matrix.m_element(0, 1) * c5 + matrix.m_element(0, 2) * c4 - matrix.m_element(0, 3) * c3) / det;
+		result.elements[0 + 2 * 4] = ( matrix.m_element(3, 1) * s5 - matrix.m_element(3, 2) * s4 + matrix.m_element(3, 3) * s3) / det;
+		result.elements[0 + 3 * 4] = (-matrix.m_element(2, 1) * s5 + matrix.m_element(2, 2) * s4 - matrix.m_element(2, 3) * s3) / det;
+
+		result.elements[1 + 0 * 4] = (-matrix.m_element(1, 0) * c5 + matrix.m_element(1, 2) * c2 - matrix.m_element(1, 3) * c1) / det;
+		result.elements[1 + 1 * 4] = ( matrix.m_element(0, 0) * c5 - matrix.m_element(0, 2) * c2 + matrix.m_element(0, 3) * c1) / det;
+		result.elements[1 + 2 * 4] = (-matrix.m_element(3, 0) * s5 + matrix.m_element(3, 2) * s2 - matrix.m_element(3, 3) * s1) / det;
+		result.elements[1 + 3 * 4] = ( matrix.m_element(2, 0) * s5 - matrix.m_element(2, 2) * s2 + matrix.m_element(2, 3) * s1) / det;
+
+		result.elements[2 + 0 * 4] = ( matrix.m_element(1, 0) * c4 - matrix.m_element(1, 1) * c2 + matrix.m_element(1, 3) * c0) / det;
+		result.elements[2 + 1 * 4] = (-matrix.m_element(0, 0) * c4 + matrix.m_element(0, 1) * c2 - matrix.m_element(0, 3) * c0) / det;
+		result.elements[2 + 2 * 4] = ( matrix.m_element(3, 0) * s4 - matrix.m_element(3, 1) * s2 + matrix.m_element(3, 3) * s0) / det;
+		result.elements[2 + 3 * 4] = (-matrix.m_element(2, 0) * s4 + matrix.m_element(2, 1) * s2 - matrix.m_element(2, 3) * s0) / det;
+
+		result.elements[3 + 0 * 4] = (-matrix.m_element(1, 0) * c3 + matrix.m_element(1, 1) * c1 - matrix.m_element(1, 2) * c0) / det;
+		result.elements[3 + 1 * 4] = ( matrix.m_element(0, 0) * c3 - matrix.m_element(0, 1) * c1 + matrix.m_element(0, 2) * c0) / det;
+		result.elements[3 + 2 * 4] = (-matrix.m_element(3, 0) * s3 + matrix.m_element(3, 1) * s1 - matrix.m_element(3, 2) * s0) / det;
+		result.elements[3 + 3 * 4] = ( matrix.m_element(2, 0) * s3 - matrix.m_element(2, 1) * s1 + matrix.m_element(2, 2) * s0) / det;
+
+
+		return result;
+	}
+
+	template<unsigned int R, unsigned int C, typename T>
+	constexpr mat<C, R, T> mat<R, C, T>::transpose(const mat& matrix)
+	{
+		mat<C, R, T> result;
+
+		for (unsigned int y = 0; y < C; y++)
+		{
+			for (unsigned int x = 0; x < R; x++)
+				result.elements[y + x * C] = matrix.elements[x + y * R];
+		}
+
+
+		return result;
+	}
+
+
+	template<unsigned int R, unsigned int C, typename T>
+	constexpr mat<R, C, T> mat<R, C, T>::translation(const vec<3, T>& position)
+	{
+		mat result(T(1));
+
+		result.elements[0 + 3 * 4] = position.x;
+		result.elements[1 + 3 * 4] = position.y;
+		result.elements[2 + 3 * 4] = position.z;
+
+
+		return result;
+	}
+
+	template<unsigned int R, unsigned int C, typename T>
+	constexpr mat<R, C, T> mat<R, C, T>::scale(const T scale)
+	{
+		mat result(T(1));
+
+		result.elements[0 + 0 * 4] = scale;
+		result.elements[1 + 1 * 4] = scale;
+		result.elements[2 + 2 * 4] = scale;
+
+
+		return result;
+	}
+
+	template<unsigned int R, unsigned int C, typename T>
+	constexpr mat<R, C, T> mat<R, C, T>::scale(const vec<3, T>& scale)
+	{
+		mat result(T(1));
+
+		result.elements[0 + 0 * 4] = scale.x;
+		result.elements[1 + 1 * 4] = scale.y;
+		result.elements[2 + 2 * 4] = scale.z;
+
+
+		return result;
+	}
+
+
+	template<unsigned int R, unsigned int C, typename T>
+	constexpr mat<R, C, T> mat<R, C, T>::orthographic(const T left, const T right, const T bottom, const T top, const T near, const T far)
+	{
+		mat result(T(1));
+
+		result.elements[0 + 0 * 4] = T(2) / (right - left);
+		result.elements[1 + 1 * 4] = T(2) / (top - bottom);
+		result.elements[2 + 2 * 4] = T(2) / (near - far);
+
+		result.elements[0 + 3 * 4] = (left + right) / (left - right);
+		result.elements[1 + 3 * 4] = (bottom + top) / (bottom - top);
+		result.elements[2 + 3 * 4] = (far + near) / (far - near);
+
+
+		return result;
+	}
+
+	// Operator Overloads
+	template<unsigned int R, unsigned int N, unsigned int C, typename T>
+	constexpr mat<R, C, T> operator*(const mat<R, N, T>& left, const mat<N, C, T>& right)
+	{
+		mat<R, C, T> result;
+
+		for (unsigned int y = 0; y < C; y++)
+		{
+			for (unsigned int x = 0; x < R; x++)
+			{
+				T sum = T(0);
+
+				for (unsigned int i = 0; i < N; i++)
+					sum += left.elements[x + i * R] * right.elements[i + y * N];
+
+				result.elements[x + y * R] = sum;
+			}
+		}
+
+
+		return result;
+	}
+
+	template<typename T>
+	constexpr vec<4, T> operator*(const vec<4, T>& vector, const mat<4, 4, T>& matrix) //transforms vector by matrix (matrix * column vector)
+	{
+		const T* e = matrix.elements;
+
+		return vec<4, T>(
+			e[0 + 0 * 4] * vector.x + e[0 + 1 * 4] * vector.y + e[0 + 2 * 4] * vector.z + e[0 + 3 * 4] * vector.w,
+			e[1 + 0 * 4] * vector.x + e[1 + 1 * 4] * vector.y + e[1 + 2 * 4] * vector.z + e[1 + 3 * 4] * vector.w,
+			e[2 + 0 * 4] * vector.x + e[2 + 1 * 4] * vector.y + e[2 + 2 * 4] * vector.z + e[2 + 3 * 4] * vector.w,
+			e[3 + 0 * 4] * vector.x + e[3 + 1 * 4] * vector.y + e[3 + 2 * 4] * vector.z + e[3 + 3 * 4] * vector.w
+		);
+	}
+
+	template<typename T>
+	constexpr vec<4, T> operator*(const mat<4, 4, T>& matrix, const vec<4, T>& vector) //row vector * matrix
+	{
+		const T* e = matrix.elements;
+
+		return vec<4, T>(
+			e[0 + 0 * 4] * vector.x + e[1 + 0 * 4] * vector.y + e[2 + 0 * 4] * vector.z + e[3 + 0 * 4] * vector.w,
+			e[0 + 1 * 4] * vector.x + e[1 + 1 * 4] * vector.y + e[2 + 1 * 4] * vector.z + e[3 + 1 * 4] * vector.w,
+			e[0 + 2 * 4] * vector.x + e[1 + 2 * 4] * vector.y + e[2 + 2 * 4] * vector.z + e[3 + 2 * 4] * vector.w,
+			e[0 + 3 * 4] * vector.x + e[1 + 3 * 4] * vector.y + e[2 + 3 * 4] * vector.z + e[3 + 3 * 4] * vector.w
+		);
+	}
+
+}
+
+
+
+#endif
\ No newline at end of file
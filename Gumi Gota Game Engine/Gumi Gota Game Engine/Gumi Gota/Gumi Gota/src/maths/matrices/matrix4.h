@@ -5,58 +5,183 @@
 
 /* INCLUDES */
 // Header Includes
+#include "mat.h"
+
 #include "../vectors/vector3.h"
 
+#include "../general/SIMD.h"
+
 
 
 namespace gg
 {
 
-	struct matrix4
+	typedef mat<4, 4, float> matrix4;
+
+	// Float Specializations (simd; functions of other matrices are generic constexpr code from mat.h)
+	template<> inline matrix4& matrix4::multiply(const matrix4& other);
+
+	template<> inline float matrix4::determinant() const;
+
+	template<> inline matrix4 matrix4::invert(const matrix4& matrix);
+	template<> inline matrix4 matrix4::transpose(const matrix4& matrix);
+
+	inline matrix4 operator*(const matrix4& left, const matrix4& right);
+
+	inline void simdAdjugate(const matrix4& matrix, simdFloat4 columns[4]); //columns of transposed cofactor matrix (inverse multiplied by determinant)
+
+	// Trigonometric Transformations (defined in matrix4.cpp)
+	template<> matrix4 matrix4::rotation(const float radians, const vector3& axis);
+
+	template<> matrix4 matrix4::model(const vector3& position, const float rotX, const float rotY, const float rotZ, const float scale);
+	template<> matrix4 matrix4::model(const vector3& position, const float rotX, const float rotY, const float rotZ, const vector3& scale);
+	template<> matrix4 matrix4::model(const vector3& position, const float rot, const vector3& rotAxis, const float scale);
+	template<> matrix4 matrix4::model(const vector3& position, const float rot, const vector3& rotAxis, const vector3& scale);
+
+	template<> matrix4 matrix4::fpsView(const vector3& position, const float pitch, const float yaw);
+	template<> matrix4 matrix4::lookAtView(const vector3& cameraPosition, const vector3& lookAtPosition, const vector3& upVector);
+
+	template<> matrix4 matrix4::projection(const float aspectRatio, const float fov, const float zNear, const float zFar);
+
+
+
+	/* INLINE FUNCTIONS (in header, so simd code is inlined into callers) */
+	// Functions
+	template<> inline matrix4& matrix4::multiply(const matrix4& other)
+	{
+		simdFloat4 column0 = simdLoad(elements + 0 * 4);
+		simdFloat4 column1 = simdLoad(elements + 1 * 4);
+		simdFloat4 column2 = simdLoad(elements + 2 * 4);
+		simdFloat4 column3 = simdLoad(elements + 3 * 4);
+
+		// Every Result Column Is Combination of Columns of This Matrix (this == &other works too, column is read before it's written)
+		for (int y = 0; y < 4; y++)
+		{
+			const float* weights = other.elements + y * 4;
+
+			simdFloat4 sum = simdMultiply(column0, simdSplat(weights[0]));
+			sum = simdAdd(sum, simdMultiply(column1, simdSplat(weights[1])));
+			sum = simdAdd(sum, simdMultiply(column2, simdSplat(weights[2])));
+			sum = simdAdd(sum, simdMultiply(column3, simdSplat(weights[3])));
+
+			simdStore(elements + y * 4, sum);
+		}
+
+
+		return *this;
+	}
+
+	template<> inline float matrix4::determinant() const
 	{
-		/* Variables */
-		float elements[4 * 4];
+		simdFloat4 adjugate[4];
+		simdAdjugate(*this, adjugate);
 
-		/* Constructors */
-		matrix4();
-		matrix4(const float& diagonal);
-		matrix4(const float values[4 * 4]);
+		// First Row Times First Adjugate Column (laplace expansion)
+		simdFloat4 firstRow = simdShuffle<0, 2, 0, 2>(simdShuffle<0, 0, 0, 0>(simdLoad(elements + 0 * 4), simdLoad(elements + 1 * 4)), simdShuffle<0, 0, 0, 0>(simdLoad(elements + 2 * 4), simdLoad(elements + 3 * 4)));
+		simdFloat4 products = simdMultiply(firstRow, adjugate[0]);
 
-		/* Functions */
-		matrix4& multiply(const matrix4 other);
+		simdFloat4 sums = simdAdd(products, simdShuffle<1, 0, 3, 2>(products, products));
+		sums = simdAdd(sums, simdShuffle<2, 3, 0, 1>(sums, sums));
 
-		float determinant() const;
 
-		// Matrices Functions
-		static matrix4 identity();
+		return simdGetX(sums);
+	}
 
+	// Matrices Functions
+	template<> inline matrix4 matrix4::invert(const matrix4& matrix)
+	{
+		// Init
+		matrix4 result;
+		simdFloat4 adjugate[4];
+		simdAdjugate(matrix, adjugate);
 
-		static matrix4 invert(const matrix4& mat);
+		// Calculating Determinant (the same way as determinant())
+		simdFloat4 firstRow = simdShuffle<0, 2, 0, 2>(simdShuffle<0, 0, 0, 0>(simdLoad(matrix.elements + 0 * 4), simdLoad(matrix.elements + 1 * 4)), simdShuffle<0, 0, 0, 0>(simdLoad(matrix.elements + 2 * 4), simdLoad(matrix.elements + 3 * 4)));
+		simdFloat4 products = simdMultiply(firstRow, adjugate[0]);
 
+		simdFloat4 det = simdAdd(products, simdShuffle<1, 0, 3, 2>(products, products));
+		det = simdAdd(det, simdShuffle<2, 3, 0, 1>(det, det));
 
-		static matrix4 translation(const vector3& position);
-		static matrix4 rotation(const float radians, const vector3& axis);
-		static matrix4 scale(const float scale);
-		static matrix4 scale(const vector3& scale);
+		if (simdGetX(det) == 0.0f)
+			return result;
 
-		static matrix4 model(const vector3& position, const float rotX, const float rotY, const float rotZ, const float scale); // rotations are given in radians
-		static matrix4 model(const vector3& position, const float rotX, const float rotY, const float rotZ, const vector3& scale); // rotations are given in radians
-		static matrix4 model(const vector3& position, const float rot, const vector3& rotAxis, const float scale); // rotations are given in radians
-		static matrix4 model(const vector3& position, const float rot, const vector3& rotAxis, const vector3& scale); // rotations are given in radians
+		// Writing
+		for (int i = 0; i < 4; i++)
+			simdStore(result.elements + i * 4, simdDivide(adjugate[i], det));
 
 
-		static matrix4 fpsView(const vector3& position, const float pitch, const float yaw); // pitch and yaw are given in radians
-		static matrix4 lookAtView(const vector3& cameraPosition, const vector3& lookAtPosition, const vector3& upVector);
+		return result;
+	}
 
-		static matrix4 orthographic(const float left, const float right, const float bottom, const float top, const float near, const float far);
-		static matrix4 projection(const float aspectRatio, const float fov, const float zNear, const float zFar); // fov is given in radians
+	template<> inline matrix4 matrix4::transpose(const matrix4& matrix)
+	{
+		matrix4 result;
 
-		/* Operator Overloads */
-		friend matrix4 operator*(matrix4 left, const matrix4& right);
+		simdFloat4 column0 = simdLoad(matrix.elements + 0 * 4);
+		simdFloat4 column1 = simdLoad(matrix.elements + 1 * 4);
+		simdFloat4 column2 = simdLoad(matrix.elements + 2 * 4);
+		simdFloat4 column3 = simdLoad(matrix.elements + 3 * 4);
 
-		matrix4& operator*=(const matrix4& other);
+		simdTranspose(column0, column1, column2, column3);
 
-	};
+		simdStore(result.elements + 0 * 4, column0);
+		simdStore(result.elements + 1 * 4, column1);
+		simdStore(result.elements + 2 * 4, column2);
+		simdStore(result.elements + 3 * 4, column3);
+
+
+		return result;
+	}
+
+	// Operator Overloads
+	inline matrix4 operator*(const matrix4& left, const matrix4& right)
+	{
+		matrix4 result = left;
+
+		return result.multiply(right);
+	}
+
+	// Additional Functions
+	inline void simdAdjugate(const matrix4& matrix, simdFloat4 columns[4])
+	{
+		// Init
+		simdFloat4 c0 = simdLoad(matrix.elements + 0 * 4);
+		simdFloat4 c1 = simdLoad(matrix.elements + 1 * 4);
+		simdFloat4 c2 = simdLoad(matrix.elements + 2 * 4);
+		simdFloat4 c3 = simdLoad(matrix.elements + 3 * 4);
+
+		// Columns with Swapped Row Pairs (m1k, m0k, m3k, m2k)
+		simdFloat4 a0 = simdShuffle<1, 0, 3, 2>(c0, c0);
+		simdFloat4 a1 = simdShuffle<1, 0, 3, 2>(c1, c1);
+		simdFloat4 a2 = simdShuffle<1, 0, 3, 2>(c2, c2);
+		simdFloat4 a3 = simdShuffle<1, 0, 3, 2>(c3, c3);
+
+		// 2x2 Determinants of Column Pairs (lower rows in first two lanes, upper rows in last two)
+		simdFloat4 p01 = simdMultiply(c0, a1);
+		simdFloat4 p02 = simdMultiply(c0, a2);
+		simdFloat4 p03 = simdMultiply(c0, a3);
+		simdFloat4 p12 = simdMultiply(c1, a2);
+		simdFloat4 p13 = simdMultiply(c1, a3);
+		simdFloat4 p23 = simdMultiply(c2, a3);
+
+		simdFloat4 d01 = simdSubtract(simdShuffle<2, 2, 0, 0>(p01, p01), simdShuffle<3, 3, 1, 1>(p01, p01));
+		simdFloat4 d02 = simdSubtract(simdShuffle<2, 2, 0, 0>(p02, p02), simdShuffle<3, 3, 1, 1>(p02, p02));
+		simdFloat4 d03 = simdSubtract(simdShuffle<2, 2, 0, 0>(p03, p03), simdShuffle<3, 3, 1, 1>(p03, p03));
+		simdFloat4 d12 = simdSubtract(simdShuffle<2, 2, 0, 0>(p12, p12), simdShuffle<3, 3, 1, 1>(p12, p12));
+		simdFloat4 d13 = simdSubtract(simdShuffle<2, 2, 0, 0>(p13, p13), simdShuffle<3, 3, 1, 1>(p13, p13));
+		simdFloat4 d23 = simdSubtract(simdShuffle<2, 2, 0, 0>(p23, p23), simdShuffle<3, 3, 1, 1>(p23, p23));
+
+		// Cofactor Rows (become adjugate columns after transposing)
+		simdFloat4 evenSigns = simdSet(1.0f, -1.0f, 1.0f, -1.0f);
+		simdFloat4 oddSigns = simdSet(-1.0f, 1.0f, -1.0f, 1.0f);
+
+		columns[0] = simdMultiply(simdAdd(simdSubtract(simdMultiply(a1, d23), simdMultiply(a2, d13)), simdMultiply(a3, d12)), evenSigns);
+		columns[1] = simdMultiply(simdAdd(simdSubtract(simdMultiply(a0, d23), simdMultiply(a2, d03)), simdMultiply(a3, d02)), oddSigns);
+		columns[2] = simdMultiply(simdAdd(simdSubtract(simdMultiply(a0, d13), simdMultiply(a1, d03)), simdMultiply(a3, d01)), evenSigns);
+		columns[3] = simdMultiply(simdAdd(simdSubtract(simdMultiply(a0, d12), simdMultiply(a1, d02)), simdMultiply(a2, d01)), oddSigns);
+
+		simdTranspose(columns[0], columns[1], columns[2], columns[3]);
+	}
 
 }
 
@@ -0,0 +1,89 @@
+
+/* INCLUDES */
+// Self Include
+#include "quaternion.h"
+
+// Header Includes
+#include "../general/FastMath.h"
+
+#include "../trigonometry/Trigonometry.h"
+
+
+
+namespace gg
+{
+
+	/* Functions */
+	// Rotations Functions
+	quaternion quaternion::axisAngle(const float radians, const vector3& axis)
+	{
+		float s, c;
+		fastSineCosine(radians * 0.5f, s, c);
+
+
+		return quaternion(axis.x * s, axis.y * s, axis.z * s, c);
+	}
+
+	quaternion quaternion::euler(const float rotX, const float rotY, const float rotZ)
+	{
+		// Sines and Cosines of All Half Angles at Once
+		float halfAngles[4] = { rotX * 0.5f, rotY * 0.5f, rotZ * 0.5f, 0.0f };
+		float sines[4], cosines[4];
+
+		simdFloat4 s, c;
+		simdFastSineCosine(simdLoad(halfAngles), s, c);
+		simdStore(sines, s);
+		simdStore(cosines, c);
+
+		// Rotation X * Rotation Y * Rotation Z, Multiplied Out
+		float sxcy = sines[0] * cosines[1], cxsy = cosines[0] * sines[1];
+		float sxsy = sines[0] * sines[1], cxcy = cosines[0] * cosines[1];
+
+
+		return quaternion(sxcy * cosines[2] + cxsy * sines[2],
+		                  cxsy * cosines[2] - sxcy * sines[2],
+		                  cxcy * sines[2] + sxsy * cosines[2],
+		                  cxcy * cosines[2] - sxsy * sines[2]);
+	}
+
+
+	quaternion quaternion::nlerp(const quaternion& from, const quaternion& to, const float amount)
+	{
+		// Shortest Path (q and -q are the same rotation)
+		float sign = dotProduct(from, to) < 0.0f ? -1.0f : 1.0f;
+
+		float a = 1.0f - amount;
+		float b = amount * sign;
+
+		quaternion result(from.x * a + to.x * b, from.y * a + to.y * b, from.z * a + to.z * b, from.w * a + to.w * b);
+		result.normalize();
+
+
+		return result;
+	}
+
+	quaternion quaternion::slerp(const quaternion& from, const quaternion& to, const float amount)
+	{
+		// Shortest Path (q and -q are the same rotation)
+		float cosAngle = dotProduct(from, to);
+		float sign = cosAngle < 0.0f ? -1.0f : 1.0f;
+		cosAngle *= sign;
+
+		if (cosAngle > QUATERNION_SLERP_THRESHOLD)
+			return nlerp(from, to, amount);
+
+		// Weights (sines of all 3 angles at once)
+		float angle = cosineAngle(cosAngle);
+
+		float angles[4] = { angle, (1.0f - amount) * angle, amount * angle, 0.0f };
+		float sines[4];
+		simdStore(sines, simdFastSine(simdLoad(angles)));
+
+		float a = sines[1] / sines[0];
+		float b = sines[2] / sines[0] * sign;
+
+
+		return quaternion(from.x * a + to.x * b, from.y * a + to.y * b, from.z * a + to.z * b, from.w * a + to.w * b);
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+#ifndef GUMIGOTA_QUATERNION_H
+#define GUMIGOTA_QUATERNION_H
+
+
+
+/* INCLUDES */
+// Header Includes
+#include "../vectors/vector3.h"
+#include "../matrices/matrix4.h"
+
+
+
+/* DEFINITIONS */
+#define QUATERNION_SLERP_THRESHOLD 0.9995f //above this dot product slerp falls back to nlerp, sine of angle between rotations gets too small to divide by
+
+
+
+namespace gg
+{
+
+	struct alignas(16) quaternion //rotation as (axis * sin(angle / 2), cos(angle / 2)); rotations are unit quaternions
+	{
+		/* Variables */
+		float x, y, z, w;
+
+		/* Constructors */
+		constexpr quaternion() : x(0.0f), y(0.0f), z(0.0f), w(1.0f) {} //no rotation
+		constexpr quaternion(const float x, const float y, const float z, const float w) : x(x), y(y), z(z), w(w) {}
+
+		/* Functions */
+		constexpr quaternion& multiply(const quaternion& other) //rotates by other first, then by this (like matrix multiplication)
+		{
+			float resultX = w * other.x + x * other.w + y * other.z - z * other.y;
+			float resultY = w * other.y - x * other.z + y * other.w + z * other.x;
+			float resultZ = w * other.z + x * other.y - y * other.x + z * other.w;
+			float resultW = w * other.w - x * other.x - y * other.y - z * other.z;
+
+			x = resultX;
+			y = resultY;
+			z = resultZ;
+			w = resultW;
+
+
+			return *this;
+		}
+
+		constexpr quaternion conjugate() const { return quaternion(-x, -y, -z, w); } //opposite rotation of unit quaternion
+
+		constexpr float lengthSquared() const { return x * x + y * y + z * z + w * w; }
+		inline float length() const { return std::sqrt(lengthSquared()); }
+
+		inline void normalize() { float magnitude = length(); x /= magnitude; y /= magnitude; z /= magnitude; w /= magnitude; }
+
+		constexpr vector3 rotate(const vector3& vector) const //faster than building matrix for a single vector
+		{
+			// v + 2w(q x v) + 2q x (q x v), with t = 2(q x v)
+			float tx = 2.0f * (y * vector.z - z * vector.y);
+			float ty = 2.0f * (z * vector.x - x * vector.z);
+			float tz = 2.0f * (x * vector.y - y * vector.x);
+
+
+			return vector3(vector.x + w * tx + y * tz - z * ty,
+			               vector.y + w * ty + z * tx - x * tz,
+			               vector.z + w * tz + x * ty - y * tx);
+		}
+
+		constexpr matrix4 toMatrix() const; //rotation matrix in closed form, no trigonometry
+
+		// Rotations Functions (defined in quaternion.cpp)
+		static quaternion axisAngle(const float radians, const vector3& axis); //axis has to be normalized
+		static quaternion euler(const float rotX, const float rotY, const float rotZ); //the same rotation as matrix4::model with these angles (x, then y, then z rotation); rotations are given in radians
+
+		static quaternion nlerp(const quaternion& from, const quaternion& to, const float amount); //normalized linear interpolation; cheap, but speed isn't constant
+		static quaternion slerp(const quaternion& from, const quaternion& to, const float amount); //spherical interpolation; constant speed
+
+		/* Operator Overloads */
+		friend constexpr quaternion operator*(const quaternion& left, const quaternion& right) { quaternion result = left; return result.multiply(right); }
+		friend constexpr vector3 operator*(const quaternion& rotation, const vector3& vector) { return rotation.rotate(vector); }
+
+		constexpr quaternion& operator*=(const quaternion& other) { return multiply(other); }
+
+
+		constexpr bool operator==(const quaternion& other) const { return x == other.x && y == other.y && z == other.z && w == other.w; }
+		constexpr bool operator!=(const quaternion& other) const { return !(*this == other);                                           }
+
+	};
+
+
+
+	/* FUNCTIONS */
+	constexpr float dotProduct(const quaternion& q1, const quaternion& q2) { return q1.x * q2.x + q1.y * q2.y + q1.z * q2.z + q1.w * q2.w; }
+
+	inline quaternion normal(const quaternion& q) { quaternion result = q; result.normalize(); return result; }
+
+
+
+	/* INLINE FUNCTIONS */
+	constexpr matrix4 quaternion::toMatrix() const
+	{
+		matrix4 result(1.0f);
+
+		float x2 = x + x, y2 = y + y, z2 = z + z;
+
+		float xx = x * x2, xy = x * y2, xz = x * z2;
+		float yy = y * y2, yz = y * z2, zz = z * z2;
+		float wx = w * x2, wy = w * y2, wz = w * z2;
+
+		result.elements[0 + 0 * 4] = 1.0f - (yy + zz);
+		result.elements[1 + 0 * 4] = xy + wz;
+		result.elements[2 + 0 * 4] = xz - wy;
+
+		result.elements[0 + 1 * 4] = xy - wz;
+		result.elements[1 + 1 * 4] = 1.0f - (xx + zz);
+		result.elements[2 + 1 * 4] = yz + wx;
+
+		result.elements[0 + 2 * 4] = xz + wy;
+		result.elements[1 + 2 * 4] = yz - wx;
+		result.elements[2 + 2 * 4] = 1.0f - (xx + yy);
+
+
+		return result;
+	}
+
+}
+
+
+
+#endif
\ No newline at end of file
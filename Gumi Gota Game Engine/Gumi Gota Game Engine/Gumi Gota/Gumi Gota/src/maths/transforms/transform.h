@@ -0,0 +1,68 @@
+#ifndef GUMIGOTA_TRANSFORM_H
+#define GUMIGOTA_TRANSFORM_H
+
+
+
+/* INCLUDES */
+// Header Includes
+#include "../vectors/vector3.h"
+#include "../matrices/matrix4.h"
+#include "../quaternions/quaternion.h"
+
+
+
+namespace gg
+{
+
+	struct transform //translation * rotation * scale, the same order as matrix4::model; cheaper to store and interpolate than a matrix
+	{
+		/* Variables */
+		quaternion rotation;
+		vector3 position;
+		vector3 scale;
+
+		/* Constructors */
+		constexpr transform() : rotation(), position(0.0f), scale(1.0f) {}
+		constexpr transform(const vector3& position, const quaternion& rotation, const float scale) : rotation(rotation), position(position), scale(scale) {}
+		constexpr transform(const vector3& position, const quaternion& rotation, const vector3& scale) : rotation(rotation), position(position), scale(scale) {}
+
+		/* Functions */
+		constexpr matrix4 toMatrix() const //rotation matrix with scaled columns and translation, no matrix multiplications
+		{
+			matrix4 result = rotation.toMatrix();
+
+			for (unsigned int i = 0; i < 3; i++)
+			{
+				result.elements[i + 0 * 4] *= scale.x;
+				result.elements[i + 1 * 4] *= scale.y;
+				result.elements[i + 2 * 4] *= scale.z;
+			}
+
+			result.elements[0 + 3 * 4] = position.x;
+			result.elements[1 + 3 * 4] = position.y;
+			result.elements[2 + 3 * 4] = position.z;
+
+
+			return result;
+		}
+
+		constexpr vector3 apply(const vector3& point) const { return position + rotation.rotate(point * scale); } //transforms point without building matrix
+
+		// Transforms Functions
+		static inline transform interpolate(const transform& from, const transform& to, const float amount) //position and scale are interpolated linearly, rotation with slerp
+		{
+			return transform(from.position + (to.position - from.position) * amount, quaternion::slerp(from.rotation, to.rotation, amount), from.scale + (to.scale - from.scale) * amount);
+		}
+
+		static inline transform fastInterpolate(const transform& from, const transform& to, const float amount) //rotation with nlerp; good enough for small steps, like between animation keyframes
+		{
+			return transform(from.position + (to.position - from.position) * amount, quaternion::nlerp(from.rotation, to.rotation, amount), from.scale + (to.scale - from.scale) * amount);
+		}
+
+	};
+
+}
+
+
+
+#endif
\ No newline at end of file
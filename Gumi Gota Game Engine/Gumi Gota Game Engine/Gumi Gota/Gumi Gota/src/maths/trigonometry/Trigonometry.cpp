@@ -14,17 +14,17 @@ namespace gg
 	/* FUNCTIONS */
 	float sine(const float radians)
 	{
-		return sin(radians);
+		return std::sin(radians);
 	}
 
 	float cosine(const float radians)
 	{
-		return cos(radians);
+		return std::cos(radians);
 	}
 
 	float tangent(const float radians)
 	{
-		return tan(radians);
+		return std::tan(radians);
 	}
 
 	float cotangent(const float radians)
@@ -35,17 +35,17 @@ namespace gg
 
 	float sineAngle(const float value)
 	{
-		return asin(value);
+		return std::asin(value);
 	}
 
 	float cosineAngle(const float value)
 	{
-		return acos(value);
+		return std::acos(value);
 	}
 
 	float tangentAngle(const float value)
 	{
-		return atan(value);
+		return std::atan(value);
 	}
 
 	float cotangentAngle(const float value)
@@ -0,0 +1,188 @@
+#ifndef GUMIGOTA_VEC_H
+#define GUMIGOTA_VEC_H
+
+
+
+/* INCLUDES */
+// Normal Includes
+#include <cmath>
+
+
+
+namespace gg
+{
+
+	template<unsigned int N, typename T>
+	struct vec; //specialized for 2, 3 and 4 components; everything except length() and normalize() is constexpr, so vectors can be computed at compile time
+
+
+
+	template<typename T>
+	struct vec<2, T>
+	{
+		/* Variables */
+		T x, y;
+
+		/* Constructors */
+		constexpr vec() : x(T(0)), y(T(0)) {}
+		constexpr vec(const T value) : x(value), y(value) {}
+		constexpr vec(const T x, const T y) : x(x), y(y) {}
+
+		template<typename U>
+		constexpr explicit vec(const vec<2, U>& other) : x(T(other.x)), y(T(other.y)) {}
+
+		/* Functions */
+		constexpr vec& add(const vec& other)      { x += other.x; y += other.y; return *this; }
+		constexpr vec& subtract(const vec& other) { x -= other.x; y -= other.y; return *this; }
+		constexpr vec& multiply(const vec& other) { x *= other.x; y *= other.y; return *this; }
+		constexpr vec& divide(const vec& other)   { x /= other.x; y /= other.y; return *this; }
+
+		constexpr vec opposite() const { return vec(-x, -y); }
+
+		constexpr vec absolute() const { return vec(x < T(0) ? -x : x, y < T(0) ? -y : y); }
+
+		inline T length() const { return T(std::sqrt(lengthSquared())); }
+		constexpr T lengthSquared() const { return x * x + y * y; }
+
+		/* Operator Overloads */
+		friend constexpr vec operator+(const vec& left, const vec& right) { vec result = left; return result.add(right);      }
+		friend constexpr vec operator-(const vec& left, const vec& right) { vec result = left; return result.subtract(right); }
+		friend constexpr vec operator*(const vec& left, const vec& right) { vec result = left; return result.multiply(right); }
+		friend constexpr vec operator/(const vec& left, const vec& right) { vec result = left; return result.divide(right);   }
+
+		constexpr vec& operator+=(const vec& other) { return add(other);      }
+		constexpr vec& operator-=(const vec& other) { return subtract(other); }
+		constexpr vec& operator*=(const vec& other) { return multiply(other); }
+		constexpr vec& operator/=(const vec& other) { return divide(other);   }
+
+		friend constexpr vec operator*(const vec& vector, const T value) { return vec(vector.x * value, vector.y * value); }
+		friend constexpr vec operator/(const vec& vector, const T value) { return vec(vector.x / value, vector.y / value); }
+
+		constexpr vec& operator*=(const T value) { x *= value; y *= value; return *this; }
+		constexpr vec& operator/=(const T value) { x /= value; y /= value; return *this; }
+
+
+		constexpr bool operator==(const vec& other) const { return x == other.x && y == other.y; }
+		constexpr bool operator!=(const vec& other) const { return !(*this == other);           }
+
+	};
+
+
+
+	template<typename T>
+	struct vec<3, T>
+	{
+		/* Variables */
+		T x, y, z;
+
+		/* Constructors */
+		constexpr vec() : x(T(0)), y(T(0)), z(T(0)) {}
+		constexpr vec(const T value) : x(value), y(value), z(value) {}
+		constexpr vec(const vec<2, T>& xy, const T z) : x(xy.x), y(xy.y), z(z) {}
+		constexpr vec(const T x, const T y, const T z) : x(x), y(y), z(z) {}
+
+		template<typename U>
+		constexpr explicit vec(const vec<3, U>& other) : x(T(other.x)), y(T(other.y)), z(T(other.z)) {}
+
+		/* Functions */
+		constexpr vec& add(const vec& other)      { x += other.x; y += other.y; z += other.z; return *this; }
+		constexpr vec& subtract(const vec& other) { x -= other.x; y -= other.y; z -= other.z; return *this; }
+		constexpr vec& multiply(const vec& other) { x *= other.x; y *= other.y; z *= other.z; return *this; }
+		constexpr vec& divide(const vec& other)   { x /= other.x; y /= other.y; z /= other.z; return *this; }
+
+		constexpr vec opposite() const { return vec(-x, -y, -z); }
+
+		constexpr vec absolute() const { return vec(x < T(0) ? -x : x, y < T(0) ? -y : y, z < T(0) ? -z : z); }
+
+		constexpr vec<2, T> xy() const { return vec<2, T>(x, y); }
+
+		inline T length() const { return T(std::sqrt(lengthSquared())); }
+		constexpr T lengthSquared() const { return x * x + y * y + z * z; }
+
+		inline void normalize() { T magnitude = length(); x /= magnitude; y /= magnitude; z /= magnitude; }
+
+		/* Operator Overloads */
+		friend constexpr vec operator+(const vec& left, const vec& right) { vec result = left; return result.add(right);      }
+		friend constexpr vec operator-(const vec& left, const vec& right) { vec result = left; return result.subtract(right); }
+		friend constexpr vec operator*(const vec& left, const vec& right) { vec result = left; return result.multiply(right); }
+		friend constexpr vec operator/(const vec& left, const vec& right) { vec result = left; return result.divide(right);   }
+
+		constexpr vec& operator+=(const vec& other) { return add(other);      }
+		constexpr vec& operator-=(const vec& other) { return subtract(other); }
+		constexpr vec& operator*=(const vec& other) { return multiply(other); }
+		constexpr vec& operator/=(const vec& other) { return divide(other);   }
+
+		friend constexpr vec operator*(const vec& vector, const T value) { return vec(vector.x * value, vector.y * value, vector.z * value); }
+		friend constexpr vec operator/(const vec& vector, const T value) { return vec(vector.x / value, vector.y / value, vector.z / value); }
+
+		constexpr vec& operator*=(const T value) { x *= value; y *= value; z *= value; return *this; }
+		constexpr vec& operator/=(const T value) { x /= value; y /= value; z /= value; return *this; }
+
+
+		constexpr bool operator==(const vec& other) const { return x == other.x && y == other.y && z == other.z; }
+		constexpr bool operator!=(const vec& other) const { return !(*this == other);                            }
+
+	};
+
+
+
+	template<typename T>
+	struct alignas(sizeof(T) == 4 ? 16 : alignof(T)) vec<4, T> //point or direction in homogeneous coordinates; length, normalizing and scaling use only xyz; float vectors are aligned, so they fit one simd register
+	{
+		/* Variables */
+		T x, y, z, w;
+
+		/* Constructors */
+		constexpr vec() : x(T(0)), y(T(0)), z(T(0)), w(T(0)) {}
+		constexpr vec(const vec<3, T>& xyz, const T w) : x(xyz.x), y(xyz.y), z(xyz.z), w(w) {}
+		constexpr vec(const T x, const T y, const T z, const T w) : x(x), y(y), z(z), w(w) {}
+
+		template<typename U>
+		constexpr explicit vec(const vec<4, U>& other) : x(T(other.x)), y(T(other.y)), z(T(other.z)), w(T(other.w)) {}
+
+		/* Functions */
+		constexpr vec& add(const vec& other)      { x += other.x; y += other.y; z += other.z; w += other.w; return *this; }
+		constexpr vec& subtract(const vec& other) { x -= other.x; y -= other.y; z -= other.z; w -= other.w; return *this; }
+		constexpr vec& multiply(const vec& other) { x *= other.x; y *= other.y; z *= other.z; w *= other.w; return *this; }
+		constexpr vec& divide(const vec& other)   { x /= other.x; y /= other.y; z /= other.z; w /= other.w; return *this; }
+
+		constexpr vec opposite() const { return vec(-x, -y, -z, w); }
+
+		constexpr vec absolute() const { return vec(x < T(0) ? -x : x, y < T(0) ? -y : y, z < T(0) ? -z : z, w < T(0) ? -w : w); }
+
+		constexpr vec<2, T> xy() const  { return vec<2, T>(x, y);    }
+		constexpr vec<3, T> xyz() const { return vec<3, T>(x, y, z); }
+
+		inline T length() const { return T(std::sqrt(lengthSquared())); }
+		constexpr T lengthSquared() const { return x * x + y * y + z * z; }
+
+		inline void normalize() { T magnitude = length(); x /= magnitude; y /= magnitude; z /= magnitude; }
+
+		/* Operator Overloads */
+		friend constexpr vec operator+(const vec& left, const vec& right) { vec result = left; return result.add(right);      }
+		friend constexpr vec operator-(const vec& left, const vec& right) { vec result = left; return result.subtract(right); }
+		friend constexpr vec operator*(const vec& left, const vec& right) { vec result = left; return result.multiply(right); }
+		friend constexpr vec operator/(const vec& left, const vec& right) { vec result = left; return result.divide(right);   }
+
+		constexpr vec& operator+=(const vec& other) { return add(other);      }
+		constexpr vec& operator-=(const vec& other) { return subtract(other); }
+		constexpr vec& operator*=(const vec& other) { return multiply(other); }
+		constexpr vec& operator/=(const vec& other) { return divide(other);   }
+
+		friend constexpr vec operator*(const vec& vector, const T value) { return vec(vector.x * value, vector.y * value, vector.z * value, vector.w); } //w isn't scaled
+		friend constexpr vec operator/(const vec& vector, const T value) { return vec(vector.x / value, vector.y / value, vector.z / value, vector.w); } //w isn't scaled
+
+		constexpr vec& operator*=(const T value) { x *= value; y *= value; z *= value; return *this; }
+		constexpr vec& operator/=(const T value) { x /= value; y /= value; z /= value; return *this; }
+
+
+		constexpr bool operator==(const vec& other) const { return x == other.x && y == other.y && z == other.z && w == other.w; }
+		constexpr bool operator!=(const vec& other) const { return !(*this == other);                                           }
+
+	};
+
+}
+
+
+
+#endif
\ No newline at end of file
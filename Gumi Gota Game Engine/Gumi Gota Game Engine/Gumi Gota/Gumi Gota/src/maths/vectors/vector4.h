@@ -8,66 +8,52 @@
 #include "../../maths/vectors/vector3.h"
 
 #include "../../maths/matrices/matrix4.h"
+#include "../../maths/general/SIMD.h"
 
 
 
 namespace gg
 {
 
-	struct vector4
-	{
-		/* Variables */
-		float x, y, z, w;
-
-		/* Constructors */
-		vector4();
-		vector4(const vector3& xyz, const float w);
-		vector4(const float x, const float y, const float z, const float w);
-
-		/* Functions */
-		vector4& add(const vector4& other);
-		vector4& subtract(const vector4& other);
-		vector4& multiply(const vector4& other);
-		vector4& divide(const vector4& other);
-
-		vector4 opposite() const;
-
-		vector4 absolute() const;
+	typedef vec<4, float> vector4;
 
-		vector2 xy();
-		vector3 xyz();
 
-		float length();
-		float lengthSquared();
 
-		void normalize();
+	/* ADDITIONAL FUNCTIONS */
+	// Float Overloads (simd; transformations of other vectors are generic constexpr code from mat.h)
+	inline vector4 operator*(const vector4& vector, const matrix4& matrix) //transforms vector by matrix (matrix * column vector)
+	{
+		simdFloat4 sum = simdMultiply(simdLoad(matrix.elements + 0 * 4), simdSplat(vector.x));
+		sum = simdAdd(sum, simdMultiply(simdLoad(matrix.elements + 1 * 4), simdSplat(vector.y)));
+		sum = simdAdd(sum, simdMultiply(simdLoad(matrix.elements + 2 * 4), simdSplat(vector.z)));
+		sum = simdAdd(sum, simdMultiply(simdLoad(matrix.elements + 3 * 4), simdSplat(vector.w)));
 
-		/* Operator Overloads */
-		friend vector4 operator+(vector4 left, const vector4& right);
-		friend vector4 operator-(vector4 left, const vector4& right);
-		friend vector4 operator*(vector4 left, const vector4& right);
-		friend vector4 operator/(vector4 left, const vector4& right);
+		vector4 result;
+		simdStore(&result.x, sum);
 
-		vector4& operator+=(const vector4& other);
-		vector4& operator-=(const vector4& other);
-		vector4& operator*=(const vector4& other);
-		vector4& operator/=(const vector4& other);
 
-		friend vector4 operator*(vector4 vec, const float value);
-		friend vector4 operator/(vector4 vec, const float value);
+		return result;
+	}
 
-		vector4& operator*=(const float value);
-		vector4& operator/=(const float value);
+	inline vector4 operator*(const matrix4& matrix, const vector4& vector) //row vector * matrix
+	{
+		simdFloat4 row0 = simdLoad(matrix.elements + 0 * 4);
+		simdFloat4 row1 = simdLoad(matrix.elements + 1 * 4);
+		simdFloat4 row2 = simdLoad(matrix.elements + 2 * 4);
+		simdFloat4 row3 = simdLoad(matrix.elements + 3 * 4);
+		simdTranspose(row0, row1, row2, row3);
 
+		simdFloat4 sum = simdMultiply(row0, simdSplat(vector.x));
+		sum = simdAdd(sum, simdMultiply(row1, simdSplat(vector.y)));
+		sum = simdAdd(sum, simdMultiply(row2, simdSplat(vector.z)));
+		sum = simdAdd(sum, simdMultiply(row3, simdSplat(vector.w)));
 
-		bool operator==(const vector4& other) const;
-		bool operator!=(const vector4& other) const;
+		vector4 result;
+		simdStore(&result.x, sum);
 
-	};
 
-	/* ADDITIONAL FUNCTIONS */
-	vector4 operator*(const vector4& vector, const matrix4& matrix);
-	vector4 operator*(const matrix4& matrix, const vector4& vector);
+		return result;
+	}
 
 }
 
@@ -0,0 +1,106 @@
+
+/* INCLUDES */
+// Self Include
+#include "CPUFeatures.h"
+
+// Normal Includes
+#ifdef GUMIGOTA_X86
+	#ifdef _MSC_VER
+		#include <intrin.h>
+	#else
+		#include <cpuid.h>
+	#endif
+#endif
+
+
+
+namespace gg
+{
+
+	/* ADDITIONAL STUFF */
+	struct CPUFeatureFlags
+	{
+		bool hasSSE2;
+		bool hasAVX2;
+	};
+
+
+
+	/* ADDITIONAL FUNCTIONS */
+#ifdef GUMIGOTA_X86
+	static void s_cpuid(const unsigned int leaf, const unsigned int subleaf, unsigned int registers[4])
+	{
+#ifdef _MSC_VER
+		int values[4];
+		__cpuidex(values, (int)leaf, (int)subleaf);
+
+		for (unsigned int i = 0; i < 4; i++)
+			registers[i] = (unsigned int)values[i];
+#else
+		__cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+	}
+
+	static unsigned long long s_xgetbv()
+	{
+#ifdef _MSC_VER
+		return _xgetbv(0);
+#else
+		unsigned int low, high;
+		__asm__ volatile ("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+
+		return ((unsigned long long)high << 32) | low;
+#endif
+	}
+#endif
+
+	static CPUFeatureFlags s_detect()
+	{
+		CPUFeatureFlags features = { false, false };
+
+#ifdef GUMIGOTA_X86
+		// Basic Features
+		unsigned int registers[4];
+		s_cpuid(0, 0, registers);
+		unsigned int maxLeaf = registers[0];
+
+		s_cpuid(1, 0, registers);
+		features.hasSSE2 = (registers[3] & (1u << 26)) != 0;
+
+		bool hasOSXSAVE = (registers[2] & (1u << 27)) != 0;
+		bool hasAVX = (registers[2] & (1u << 28)) != 0;
+
+		// Extended Features (avx2 needs os support for saving ymm registers)
+		if (maxLeaf >= 7 && hasOSXSAVE && hasAVX && (s_xgetbv() & 0x6) == 0x6)
+		{
+			s_cpuid(7, 0, registers);
+			features.hasAVX2 = (registers[1] & (1u << 5)) != 0;
+		}
+#endif
+
+
+		return features;
+	}
+
+	static const CPUFeatureFlags& s_getFeatures()
+	{
+		static const CPUFeatureFlags features = s_detect(); //local static is initialized exactly once, even if first calls come from several threads at once
+
+
+		return features;
+	}
+
+
+
+	/* FUNCTIONS */
+	bool cpuSupportsSSE2()
+	{
+		return s_getFeatures().hasSSE2;
+	}
+
+	bool cpuSupportsAVX2()
+	{
+		return s_getFeatures().hasAVX2;
+	}
+
+}
\ No newline at end of file
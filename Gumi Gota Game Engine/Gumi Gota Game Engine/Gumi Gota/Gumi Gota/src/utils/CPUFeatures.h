@@ -0,0 +1,32 @@
+#ifndef GUMIGOTA_CPUFEATURES_H
+#define GUMIGOTA_CPUFEATURES_H
+
+
+
+/* DEFINITIONS */
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+	#define GUMIGOTA_X86 //sse2 and avx2 code paths are compiled only for x86 cpus
+#endif
+
+#if defined(GUMIGOTA_X86) && !defined(_MSC_VER)
+	#define GUMIGOTA_TARGET_SSE2 __attribute__((target("sse2"))) //gcc and clang need target attributes for intrinsics the whole file isn't compiled for
+	#define GUMIGOTA_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+	#define GUMIGOTA_TARGET_SSE2
+	#define GUMIGOTA_TARGET_AVX2
+#endif
+
+
+
+namespace gg
+{
+
+	/* FUNCTIONS */
+	bool cpuSupportsSSE2(); //checked once, then cached; safe to call from any thread
+	bool cpuSupportsAVX2(); //also checks if operating system saves avx registers
+
+}
+
+
+
+#endif
\ No newline at end of file
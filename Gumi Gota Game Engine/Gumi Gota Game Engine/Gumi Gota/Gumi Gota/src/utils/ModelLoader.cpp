@@ -58,11 +58,8 @@ namespace gg
 		normals.push_back(readNormals[normalIndex].y);
 		normals.push_back(readNormals[normalIndex].z);
 	}
-	
 
-
-	/* FUNCTIONS */
-	Model loadModelFromFile(const std::string& objFilepath, const std::string& textureFilepath)
+	static void s_readOBJ(const std::string& objFilepath, std::vector<float>& vertices, std::vector<float>& textureCoordinates, std::vector<float>& normals, std::vector<unsigned int>& indices)
 	{
 		// Opening OBJ File
 		std::ifstream fileReader(objFilepath);
@@ -77,11 +74,6 @@ namespace gg
 		std::vector<vector2> readTextureCoordinates;
 		std::vector<vector3> readNormals;
 
-		std::vector<float> vertices;
-		std::vector<float> textureCoordinates;
-		std::vector<float> normals;
-		std::vector<unsigned int> indices;
-
 		std::string readLine;
 		std::string firstWord;
 		std::string readValue[3];
@@ -160,9 +152,35 @@ namespace gg
 
 		// Finishing
 		fileReader.close(); //closing file
+	}
+
+
+
+	/* FUNCTIONS */
+	Model loadModelFromFile(const std::string& objFilepath, const std::string& textureFilepath)
+	{
+		std::vector<float> vertices;
+		std::vector<float> textureCoordinates;
+		std::vector<float> normals;
+		std::vector<unsigned int> indices;
+
+		s_readOBJ(objFilepath, vertices, textureCoordinates, normals, indices);
 
 
 		return Model(&vertices[0], vertices.size(), &textureCoordinates[0], textureCoordinates.size(), textureFilepath, &normals[0], normals.size(), &indices[0], indices.size());
 	}
 
+	Model loadModelFromFile(GeometryPool& pool, const std::string& objFilepath, const std::string& textureFilepath)
+	{
+		std::vector<float> vertices;
+		std::vector<float> textureCoordinates;
+		std::vector<float> normals;
+		std::vector<unsigned int> indices;
+
+		s_readOBJ(objFilepath, vertices, textureCoordinates, normals, indices);
+
+
+		return Model(pool, &vertices[0], vertices.size(), &textureCoordinates[0], textureCoordinates.size(), textureFilepath, &normals[0], normals.size(), &indices[0], indices.size());
+	}
+
 }
\ No newline at end of file
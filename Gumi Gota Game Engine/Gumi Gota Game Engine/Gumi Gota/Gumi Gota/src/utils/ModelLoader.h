@@ -13,7 +13,8 @@ namespace gg
 {
 
 	/* FUNCTIONS */
-	Model loadModelFromFile(const std::string& objFilepath, const std::string& textureFilepath); //loading model from OBJ file
+	Model loadModelFromFile(const std::string& objFilepath, const std::string& textureFilepath); //loading model from OBJ file; model uses its own buffers
+	Model loadModelFromFile(GeometryPool& pool, const std::string& objFilepath, const std::string& textureFilepath); //loading model from OBJ file into geometry pool (like Renderer3D::getGeometryPool()), so it's drawn with indirect draw calls
 
 }
 
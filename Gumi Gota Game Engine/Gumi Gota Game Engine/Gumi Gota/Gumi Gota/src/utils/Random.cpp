@@ -0,0 +1,213 @@
+
+/* INCLUDES */
+// Self Include
+#include "Random.h"
+
+// Header Includes
+#include "CPUFeatures.h"
+
+// Intrinsics Includes
+#ifdef GUMIGOTA_X86
+	#include <emmintrin.h>
+#endif
+
+
+
+/* MACROS */
+#define RANDOM_PCG_MULTIPLIER 6364136223846793005ULL
+#define RANDOM_FLOAT_UNIT (1.0f / 16777216.0f) //2^-24, so 24 upper bits map exactly to [0, 1)
+
+
+
+namespace gg
+{
+
+	/* ADDITIONAL STUFF */
+	static unsigned int s_nextSeed = 1;
+
+
+
+	/* ADDITIONAL FUNCTIONS */
+	static unsigned long long s_splitMix(unsigned long long& state) //spreads seed bits, so close seeds give unrelated states
+	{
+		unsigned long long z = (state += 0x9E3779B97F4A7C15ULL);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+
+		return z ^ (z >> 31);
+	}
+
+	static inline unsigned int s_rotateLeft(const unsigned int x, const int k)
+	{
+		return (x << k) | (x >> (32 - k));
+	}
+
+	static void s_fillScalar(unsigned int lanes[4][RANDOM_LANE_COUNT], float* result, const unsigned int count, const float scale, const float offset)
+	{
+		for (unsigned int i = 0; i < count; i += RANDOM_LANE_COUNT)
+		{
+			for (unsigned int lane = 0; lane < RANDOM_LANE_COUNT; lane++)
+			{
+				// Xoshiro128+ Step
+				unsigned int value = lanes[0][lane] + lanes[3][lane];
+				unsigned int t = lanes[1][lane] << 9;
+
+				lanes[2][lane] ^= lanes[0][lane];
+				lanes[3][lane] ^= lanes[1][lane];
+				lanes[1][lane] ^= lanes[2][lane];
+				lanes[0][lane] ^= lanes[3][lane];
+				lanes[2][lane] ^= t;
+				lanes[3][lane] = s_rotateLeft(lanes[3][lane], 11);
+
+				// Writing (last step may produce more values than needed)
+				if (i + lane < count)
+					result[i + lane] = (float)(value >> 8) * scale + offset;
+			}
+		}
+	}
+
+#ifdef GUMIGOTA_X86
+	GUMIGOTA_TARGET_SSE2 static unsigned int s_fillSSE2(unsigned int lanes[4][RANDOM_LANE_COUNT], float* result, const unsigned int count, const float scale, const float offset) //returns amount of written values; rest is left for scalar path
+	{
+		// Init
+		__m128i s0 = _mm_loadu_si128((const __m128i*)lanes[0]);
+		__m128i s1 = _mm_loadu_si128((const __m128i*)lanes[1]);
+		__m128i s2 = _mm_loadu_si128((const __m128i*)lanes[2]);
+		__m128i s3 = _mm_loadu_si128((const __m128i*)lanes[3]);
+
+		const __m128 scales = _mm_set1_ps(scale);
+		const __m128 offsets = _mm_set1_ps(offset);
+
+		unsigned int i = 0;
+
+		// Generating 4 Values at Once
+		for (; i + RANDOM_LANE_COUNT <= count; i += RANDOM_LANE_COUNT)
+		{
+			__m128i value = _mm_add_epi32(s0, s3);
+			__m128i t = _mm_slli_epi32(s1, 9);
+
+			s2 = _mm_xor_si128(s2, s0);
+			s3 = _mm_xor_si128(s3, s1);
+			s1 = _mm_xor_si128(s1, s2);
+			s0 = _mm_xor_si128(s0, s3);
+			s2 = _mm_xor_si128(s2, t);
+			s3 = _mm_or_si128(_mm_slli_epi32(s3, 11), _mm_srli_epi32(s3, 21));
+
+			__m128 floats = _mm_cvtepi32_ps(_mm_srli_epi32(value, 8)); //24 bits, so signed conversion is exact
+			_mm_storeu_ps(result + i, _mm_add_ps(_mm_mul_ps(floats, scales), offsets));
+		}
+
+		// Finishing
+		_mm_storeu_si128((__m128i*)lanes[0], s0);
+		_mm_storeu_si128((__m128i*)lanes[1], s1);
+		_mm_storeu_si128((__m128i*)lanes[2], s2);
+		_mm_storeu_si128((__m128i*)lanes[3], s3);
+
+
+		return i;
+	}
+#endif
+
+
+
+	/* Constructors */
+	Random::Random()
+	{
+		seed(s_nextSeed++);
+	}
+
+	Random::Random(const unsigned int seed)
+	{
+		this->seed(seed);
+	}
+
+	/* Functions */
+	void Random::seed(const unsigned int seed)
+	{
+		m_seed = seed;
+
+		unsigned long long state = seed;
+
+		// Pcg32 Setup
+		m_state = 0;
+		m_increment = (s_splitMix(state) << 1) | 1; //stream has to be odd
+		m_state += s_splitMix(state);
+		nextUInt();
+
+		// Xoshiro128+ Setup
+		for (unsigned int lane = 0; lane < RANDOM_LANE_COUNT; lane++)
+		{
+			unsigned long long bits0 = s_splitMix(state);
+			unsigned long long bits1 = s_splitMix(state);
+
+			m_lanes[0][lane] = (unsigned int)bits0;
+			m_lanes[1][lane] = (unsigned int)(bits0 >> 32);
+			m_lanes[2][lane] = (unsigned int)bits1;
+			m_lanes[3][lane] = (unsigned int)(bits1 >> 32) | 1; //state can't be all zeros
+		}
+	}
+
+
+	unsigned int Random::nextUInt()
+	{
+		unsigned long long oldState = m_state;
+		m_state = oldState * RANDOM_PCG_MULTIPLIER + m_increment;
+
+		unsigned int xorShifted = (unsigned int)(((oldState >> 18) ^ oldState) >> 27);
+		unsigned int rotation = (unsigned int)(oldState >> 59);
+
+
+		return (xorShifted >> rotation) | (xorShifted << ((32 - rotation) & 31));
+	}
+
+	unsigned int Random::nextUInt(const unsigned int max)
+	{
+		return (unsigned int)(((unsigned long long)nextUInt() * max) >> 32); //multiply-shift instead of modulo; faster and without division by zero
+	}
+
+	float Random::nextFloat()
+	{
+		return (float)(nextUInt() >> 8) * RANDOM_FLOAT_UNIT;
+	}
+
+	float Random::nextFloat(const float min, const float max)
+	{
+		return min + nextFloat() * (max - min);
+	}
+
+	float Random::nextSigned()
+	{
+		return (float)(nextUInt() >> 8) * (2.0f * RANDOM_FLOAT_UNIT) - 1.0f;
+	}
+
+
+	void Random::fillFloats(float* result, const unsigned int count)
+	{
+		m_fill(result, count, RANDOM_FLOAT_UNIT, 0.0f);
+	}
+
+	void Random::fillFloats(float* result, const unsigned int count, const float min, const float max)
+	{
+		m_fill(result, count, RANDOM_FLOAT_UNIT * (max - min), min);
+	}
+
+	void Random::fillSigned(float* result, const unsigned int count)
+	{
+		m_fill(result, count, 2.0f * RANDOM_FLOAT_UNIT, -1.0f);
+	}
+
+	// Private Functions
+	void Random::m_fill(float* result, const unsigned int count, const float scale, const float offset)
+	{
+		unsigned int done = 0;
+
+#ifdef GUMIGOTA_X86
+		if (cpuSupportsSSE2())
+			done = s_fillSSE2(m_lanes, result, count, scale, offset);
+#endif
+
+		if (done < count)
+			s_fillScalar(m_lanes, result + done, count - done, scale, offset);
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,55 @@
+#ifndef GUMIGOTA_RANDOM_H
+#define GUMIGOTA_RANDOM_H
+
+
+
+/* DEFINITIONS */
+#define RANDOM_LANE_COUNT 4 //independent xoshiro128+ generators used by fill functions, one per sse2 lane
+
+
+
+namespace gg
+{
+
+	class Random //seedable generator with its own state, so every user can have one (no locking, same results after reseeding)
+	{
+	private:
+		/* Variables */
+		unsigned int m_seed;
+
+		unsigned long long m_state, m_increment; //pcg32, used by single values
+		unsigned int m_lanes[4][RANDOM_LANE_COUNT]; //xoshiro128+ state words, one column per lane; used by fill functions
+
+	public:
+		/* Constructors */
+		Random(); //every default constructed generator gets next seed of global counter, so runs are repeatable but generators differ
+		Random(const unsigned int seed);
+
+		/* Functions */
+		void seed(const unsigned int seed); //restarts sequence
+
+		unsigned int nextUInt();
+		unsigned int nextUInt(const unsigned int max); //from 0 to max (excluding max); returns 0 if max is 0
+		float nextFloat(); //from 0.0 to 1.0 (excluding 1.0)
+		float nextFloat(const float min, const float max);
+		float nextSigned(); //from -1.0 to 1.0 (excluding 1.0)
+
+		// Batched Generation (values are the same on every cpu, sse2 is just faster)
+		void fillFloats(float* result, const unsigned int count); //from 0.0 to 1.0
+		void fillFloats(float* result, const unsigned int count, const float min, const float max);
+		void fillSigned(float* result, const unsigned int count); //from -1.0 to 1.0
+
+		// Getters
+		inline unsigned int getSeed() const { return m_seed; }
+
+	private:
+		// Private Functions
+		void m_fill(float* result, const unsigned int count, const float scale, const float offset); //result is (bits >> 8) * scale + offset
+
+	};
+
+}
+
+
+
+#endif
\ No newline at end of file
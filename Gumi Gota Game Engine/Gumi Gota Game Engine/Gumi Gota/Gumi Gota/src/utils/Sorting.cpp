@@ -3,6 +3,9 @@
 // Self Include
 #include "Sorting.h"
 
+// Normal Includes
+#include <cstring>
+
 
 
 namespace gg
@@ -31,243 +34,124 @@ namespace gg
 		indices[index2] = copy;
 	}
 
-	// Quick Sort
-	static void s_quickSortValues(float* values, const int startIndex, const int endIndex)
+	// Radix Sort
+	static void s_radixSort(unsigned int* keys, unsigned int* indices, const unsigned int size, unsigned int* keysBuffer, unsigned int* indicesBuffer) //sorts keys, moving indices with them; indices can be nullptr
 	{
-		if (startIndex < endIndex)
-		{
-			float pivot = values[endIndex];
-			int partitionIndex = startIndex;
+		// Init
+		unsigned int* sourceKeys = keys;
+		unsigned int* sourceIndices = indices;
+		unsigned int* destinationKeys = keysBuffer;
+		unsigned int* destinationIndices = indicesBuffer;
 
-			for (unsigned int i = startIndex; i < endIndex; i++)
-			{
-				if (values[i] <= pivot)
-				{
-					s_swap(values, i, partitionIndex);
-					partitionIndex++;
-				}
-			}
+		// Sorting by Each Byte (least significant first)
+		for (unsigned int shift = 0; shift < 32; shift += 8)
+		{
+			// Counting
+			unsigned int offsets[256] = { 0 };
 
-			s_swap(values, endIndex, partitionIndex);
+			for (unsigned int i = 0; i < size; i++)
+				offsets[(sourceKeys[i] >> shift) & 0xFF]++;
 
-			s_quickSortValues(values, startIndex, partitionIndex - 1);
-			s_quickSortValues(values, partitionIndex + 1, endIndex);
-		}
-	}
+			if (offsets[(sourceKeys[0] >> shift) & 0xFF] == size) //every key has the same byte, so pass wouldn't change anything
+				continue;
 
-	static void s_quickSortValues(std::vector<float>& values, const int startIndex, const int endIndex)
-	{
-		if (startIndex < endIndex)
-		{
-			float pivot = values[endIndex];
-			int partitionIndex = startIndex;
+			unsigned int offset = 0;
+			for (unsigned int i = 0; i < 256; i++)
+			{
+				unsigned int count = offsets[i];
+				offsets[i] = offset;
+				offset += count;
+			}
 
-			for (unsigned int i = startIndex; i < endIndex; i++)
+			// Scattering
+			for (unsigned int i = 0; i < size; i++)
 			{
-				if (values[i] <= pivot)
-				{
-					s_swap(values, i, partitionIndex);
-					partitionIndex++;
-				}
+				unsigned int destination = offsets[(sourceKeys[i] >> shift) & 0xFF]++;
+
+				destinationKeys[destination] = sourceKeys[i];
+				if (indices != nullptr)
+					destinationIndices[destination] = sourceIndices[i];
 			}
 
-			s_swap(values, endIndex, partitionIndex);
+			std::swap(sourceKeys, destinationKeys);
+			std::swap(sourceIndices, destinationIndices);
+		}
 
-			s_quickSortValues(values, startIndex, partitionIndex - 1);
-			s_quickSortValues(values, partitionIndex + 1, endIndex);
+		// Copying Result If It Ended in Buffer
+		if (sourceKeys != keys)
+		{
+			std::memcpy(keys, sourceKeys, size * sizeof(unsigned int));
+			if (indices != nullptr)
+				std::memcpy(indices, sourceIndices, size * sizeof(unsigned int));
 		}
 	}
 
-
-	static void s_quickSortIndicesValuesFromArray(std::vector<unsigned int>& indices, float* values, const int startIndex, const int endIndex)
+	static void s_radixSort(unsigned int* keys, unsigned int* indices, const unsigned int size)
 	{
-		if (startIndex < endIndex)
-		{
-			float pivot = values[endIndex];
-			int partitionIndex = startIndex;
+		std::vector<unsigned int> keysBuffer(size);
+		std::vector<unsigned int> indicesBuffer(indices != nullptr ? size : 0);
 
-			for (unsigned int i = startIndex; i < endIndex; i++)
-			{
-				if (values[i] <= pivot)
-				{
-					s_swap(values, i, partitionIndex);
-					s_swap(indices, i, partitionIndex);
-					partitionIndex++;
-				}
-			}
-
-			s_swap(values, endIndex, partitionIndex);
-			s_swap(indices, endIndex, partitionIndex);
-
-			s_quickSortIndicesValuesFromArray(indices, values, startIndex, partitionIndex - 1);
-			s_quickSortIndicesValuesFromArray(indices, values, partitionIndex + 1, endIndex);
-		}
+		s_radixSort(keys, indices, size, keysBuffer.data(), indicesBuffer.data());
 	}
 
-	static void s_quickSortIndicesValuesFromVector(std::vector<unsigned int>& indices, std::vector<float>& values, const int startIndex, const int endIndex)
+	static float s_fromRadixKey(const unsigned int key)
 	{
-		if (startIndex < endIndex)
-		{
-			float pivot = values[endIndex];
-			int partitionIndex = startIndex;
-
-			for (unsigned int i = startIndex; i < endIndex; i++)
-			{
-				if (values[i] <= pivot)
-				{
-					s_swap(values, i, partitionIndex);
-					s_swap(indices, i, partitionIndex);
-					partitionIndex++;
-				}
-			}
+		unsigned int bits = (key & 0x80000000u) ? (key & 0x7FFFFFFFu) : ~key;
 
-			s_swap(values, endIndex, partitionIndex);
-			s_swap(indices, endIndex, partitionIndex);
+		float value;
+		std::memcpy(&value, &bits, sizeof(value));
 
-			s_quickSortIndicesValuesFromVector(indices, values, startIndex, partitionIndex - 1);
-			s_quickSortIndicesValuesFromVector(indices, values, partitionIndex + 1, endIndex);
-		}
+		return value;
 	}
 
 
-
 	/* FUNCTIONS */
-	// Quick Sort
-	void quickSortValues(float* values, const unsigned int size)
+	// Radix Sort
+	void radixSortValues(float* values, const unsigned int size)
 	{
-		// Init
-		unsigned int startIndex = 0;
-		unsigned int endIndex = size - 1;
+		if (size < 2)
+			return;
 
-		// Sorting
-		if (startIndex < endIndex)
-		{
-			float pivot = values[endIndex];
-			int partitionIndex = startIndex;
+		// Sorting as Unsigned Integers
+		std::vector<unsigned int> keys(size);
 
-			for (unsigned int i = startIndex; i < endIndex; i++)
-			{
-				if (values[i] <= pivot)
-				{
-					s_swap(values, i, partitionIndex);
-					partitionIndex++;
-				}
-			}
+		for (unsigned int i = 0; i < size; i++)
+			keys[i] = radixKey(values[i]);
 
-			s_swap(values, endIndex, partitionIndex);
+		s_radixSort(keys.data(), nullptr, size);
 
-			s_quickSortValues(values, startIndex, partitionIndex - 1);
-			s_quickSortValues(values, partitionIndex + 1, endIndex);
-		}
+		for (unsigned int i = 0; i < size; i++)
+			values[i] = s_fromRadixKey(keys[i]);
 	}
 
-	void quickSortValues(std::vector<float>& values)
+	void radixSortValues(std::vector<float>& values)
 	{
-		// Init
-		unsigned int startIndex = 0;
-		unsigned int endIndex = values.size() - 1;
-
-		// Sorting
-		if (startIndex < endIndex)
-		{
-			float pivot = values[endIndex];
-			int partitionIndex = startIndex;
-
-			for (unsigned int i = startIndex; i < endIndex; i++)
-			{
-				if (values[i] <= pivot)
-				{
-					s_swap(values, i, partitionIndex);
-					partitionIndex++;
-				}
-			}
-
-			s_swap(values, endIndex, partitionIndex);
-
-			s_quickSortValues(values, startIndex, partitionIndex - 1);
-			s_quickSortValues(values, partitionIndex + 1, endIndex);
-		}
+		radixSortValues(values.data(), values.size());
 	}
 
 
-	std::vector<unsigned int> quickSortIndices(float* values, const unsigned int size)
+	void radixSortIndices(const unsigned int* radixKeys, const unsigned int size, std::vector<unsigned int>& indices)
 	{
 		// Init
-		unsigned int startIndex = 0;
-		unsigned int endIndex = size - 1;
-
-		std::vector<unsigned int> result;
-		result.reserve(endIndex);
-		for (unsigned int i = 0; i < endIndex; i++)
-		{
-			result.push_back(i);
-		}
-
-		// Sorting
-		if (startIndex < endIndex)
-		{
-			float pivot = values[endIndex];
-			int partitionIndex = startIndex;
-
-			for (unsigned int i = startIndex; i < endIndex; i++)
-			{
-				if (values[i] <= pivot)
-				{
-					s_swap(values, i, partitionIndex);
-					s_swap(result, i, partitionIndex);
-					partitionIndex++;
-				}
-			}
+		indices.resize(size);
 
-			s_swap(values, endIndex, partitionIndex);
-			s_swap(result, endIndex, partitionIndex);
-
-			s_quickSortIndicesValuesFromArray(result, values, startIndex, partitionIndex - 1);
-			s_quickSortIndicesValuesFromArray(result, values, partitionIndex + 1, endIndex);
-		}
+		for (unsigned int i = 0; i < size; i++)
+			indices[i] = i;
 
+		if (size < 2)
+			return;
 
-		return result;
+		// Sorting Copy of Keys
+		std::vector<unsigned int> keys(radixKeys, radixKeys + size);
+		s_radixSort(keys.data(), indices.data(), size);
 	}
 
-	std::vector<unsigned int> quickSortIndices(std::vector<float>& values)
+	void radixSortPairs(unsigned int* radixKeys, unsigned int* values, const unsigned int size, unsigned int* keysBuffer, unsigned int* valuesBuffer)
 	{
-		// Init
-		unsigned int startIndex = 0;
-		unsigned int endIndex = values.size() - 1;
-
-		std::vector<unsigned int> result;
-		result.reserve(endIndex);
-		for (unsigned int i = 0; i < endIndex + 1; i++)
-		{
-			result.push_back(i);
-		}
+		if (size < 2)
+			return;
 
-		// Sorting
-		if (startIndex < endIndex)
-		{
-			float pivot = values[endIndex];
-			int partitionIndex = startIndex;
-
-			for (unsigned int i = startIndex; i < endIndex; i++)
-			{
-				if (values[i] <= pivot)
-				{
-					s_swap(values, i, partitionIndex);
-					s_swap(result, i, partitionIndex);
-					partitionIndex++;
-				}
-			}
-
-			s_swap(values, endIndex, partitionIndex);
-			s_swap(result, endIndex, partitionIndex);
-
-			s_quickSortIndicesValuesFromVector(result, values, startIndex, partitionIndex - 1);
-			s_quickSortIndicesValuesFromVector(result, values, partitionIndex + 1, endIndex);
-		}
-
-
-		return result;
+		s_radixSort(radixKeys, values, size, keysBuffer, valuesBuffer);
 	}
 
 	// Insert Sort
@@ -6,6 +6,8 @@
 /* INCLUDES */
 // Normal Includes
 #include <vector>
+#include <algorithm>
+#include <cstring>
 
 
 
@@ -13,12 +15,79 @@ namespace gg
 {
 
 	/* FUNCTIONS */
-	// Quick Sort
-	void quickSortValues(float* values, const unsigned int size);
-	void quickSortValues(std::vector<float>& values);
-	
-	std::vector<unsigned int> quickSortIndices(float* values, const unsigned int size); //sorts values and returns indices (new order) of values
-	std::vector<unsigned int> quickSortIndices(std::vector<float>& values); //sorts values and returns indices (new order) of values
+	// Radix Keys
+	inline unsigned int radixKey(const unsigned int key) { return key; }
+	inline unsigned int radixKey(const int key) { return (unsigned int)key ^ 0x80000000u; }
+	inline unsigned int radixKey(const float key) //maps float to unsigned int with the same order (negative numbers included)
+	{
+		unsigned int bits;
+		std::memcpy(&bits, &key, sizeof(bits));
+
+		return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+	}
+
+	// Radix Sort (lsd, 8 bits per pass; O(n) no matter how values are ordered)
+	void radixSortValues(float* values, const unsigned int size);
+	void radixSortValues(std::vector<float>& values);
+
+	void radixSortIndices(const unsigned int* radixKeys, const unsigned int size, std::vector<unsigned int>& indices); //indices (new order) of keys, keys aren't moved; stable
+	void radixSortPairs(unsigned int* radixKeys, unsigned int* values, const unsigned int size, unsigned int* keysBuffer, unsigned int* valuesBuffer); //sorts keys, moving values with them; buffers hold size elements, so nothing is allocated; stable
+
+	// Key Sort
+	template<typename T>
+	void sortIndicesByKeys(const T* keys, const unsigned int size, std::vector<unsigned int>& indices) //returns permutation instead of moving keys and whatever they belong to
+	{
+		std::vector<unsigned int> radixKeys(size);
+
+		for (unsigned int i = 0; i < size; i++)
+			radixKeys[i] = radixKey(keys[i]);
+
+		radixSortIndices(radixKeys.data(), size, indices);
+	}
+
+	template<typename T>
+	std::vector<unsigned int> sortIndicesByKeys(const std::vector<T>& keys)
+	{
+		std::vector<unsigned int> indices;
+		sortIndicesByKeys(keys.data(), keys.size(), indices);
+
+		return indices;
+	}
+
+	// Top-K Selection
+	template<typename T>
+	void selectLowestIndices(const T* keys, const unsigned int size, const unsigned int amount, std::vector<unsigned int>& indices) //indices of lowest keys, sorted from lowest; O(n + k log k)
+	{
+		// Init
+		indices.resize(size);
+
+		for (unsigned int i = 0; i < size; i++)
+			indices[i] = i;
+
+		auto isLower = [keys](const unsigned int index0, const unsigned int index1)
+		{
+			return keys[index0] < keys[index1] || (!(keys[index1] < keys[index0]) && index0 < index1); //ties keep original order, so result doesn't flicker
+		};
+
+		// Selecting
+		if (amount < size)
+		{
+			std::nth_element(indices.begin(), indices.begin() + amount, indices.end(), isLower);
+			indices.resize(amount);
+		}
+
+		// Sorting Selected
+		std::sort(indices.begin(), indices.end(), isLower);
+	}
+
+	template<typename T>
+	std::vector<unsigned int> selectLowestIndices(const std::vector<T>& keys, const unsigned int amount)
+	{
+		std::vector<unsigned int> indices;
+		selectLowestIndices(keys.data(), keys.size(), amount, indices);
+
+		return indices;
+	}
 
 	// Insert Sort
 	void insertSortValues(float* values, const unsigned int size);
@@ -0,0 +1,141 @@
+
+/* INCLUDES */
+// Self Include
+#include "ThreadPool.h"
+
+
+
+namespace gg
+{
+
+	/* Constructors */
+	ThreadPool::ThreadPool()
+		: m_generation(0), m_busyWorkers(0), m_isStopping(false),
+		  m_task(nullptr), m_taskCount(0), m_nextTask(0)
+	{
+		m_startWorkers(0);
+	}
+
+	ThreadPool::ThreadPool(const unsigned int threadCount)
+		: m_generation(0), m_busyWorkers(0), m_isStopping(false),
+		  m_task(nullptr), m_taskCount(0), m_nextTask(0)
+	{
+		m_startWorkers(threadCount);
+	}
+
+	/* Destructor */
+	ThreadPool::~ThreadPool()
+	{
+		m_stopWorkers();
+	}
+
+	/* Functions */
+	void ThreadPool::run(const unsigned int taskCount, const std::function<void(const unsigned int)>& task)
+	{
+		// Running on Calling Thread (not worth waking workers)
+		if (m_workers.empty() || taskCount <= 1)
+		{
+			for (unsigned int i = 0; i < taskCount; i++)
+				task(i);
+
+			return;
+		}
+
+		// Waking Workers
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			m_task = &task;
+			m_taskCount = taskCount;
+			m_nextTask = 0;
+			m_busyWorkers = m_workers.size();
+			m_generation++;
+		}
+
+		m_startCondition.notify_all();
+
+		// Working Together with Workers
+		m_runTasks();
+
+		// Waiting for Workers
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_finishCondition.wait(lock, [this]() { return m_busyWorkers == 0; });
+
+		m_task = nullptr;
+	}
+
+
+	// Setters
+	void ThreadPool::setThreadCount(const unsigned int count)
+	{
+		m_stopWorkers();
+		m_startWorkers(count);
+	}
+
+	// Private Functions
+	void ThreadPool::m_startWorkers(const unsigned int threadCount)
+	{
+		unsigned int count = threadCount;
+		if (count == 0)
+			count = std::thread::hardware_concurrency();
+
+		m_isStopping = false;
+
+		for (unsigned int i = 1; i < count; i++)
+			m_workers.push_back(std::thread(&ThreadPool::m_workerLoop, this, m_generation));
+	}
+
+	void ThreadPool::m_stopWorkers()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_isStopping = true;
+		}
+
+		m_startCondition.notify_all();
+
+		for (std::thread& worker : m_workers)
+			worker.join();
+
+		m_workers.clear();
+	}
+
+
+	void ThreadPool::m_workerLoop(const unsigned int startGeneration)
+	{
+		unsigned int seenGeneration = startGeneration;
+
+		while (true)
+		{
+			// Waiting for Work
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_startCondition.wait(lock, [this, seenGeneration]() { return m_isStopping || m_generation != seenGeneration; });
+
+				if (m_isStopping)
+					return;
+
+				seenGeneration = m_generation;
+			}
+
+			// Working
+			m_runTasks();
+
+			// Reporting
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_busyWorkers--;
+
+				if (m_busyWorkers == 0)
+					m_finishCondition.notify_one();
+			}
+		}
+	}
+
+	void ThreadPool::m_runTasks()
+	{
+		for (unsigned int i = m_nextTask++; i < m_taskCount; i = m_nextTask++)
+			(*m_task)(i);
+	}
+
+}
\ No newline at end of file
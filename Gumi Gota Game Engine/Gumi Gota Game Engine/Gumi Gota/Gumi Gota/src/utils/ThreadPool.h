@@ -0,0 +1,67 @@
+#ifndef GUMIGOTA_THREADPOOL_H
+#define GUMIGOTA_THREADPOOL_H
+
+
+
+/* INCLUDES */
+// Normal Includes
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+
+
+
+namespace gg
+{
+
+	class ThreadPool //general parallel for (used by Scene3D for updating independent objects and by batched maths); calling thread works too, so pool with 1 thread has no workers
+	{
+	private:
+		/* Variables */
+		std::vector<std::thread> m_workers;
+
+		std::mutex m_mutex;
+		std::condition_variable m_startCondition, m_finishCondition;
+		unsigned int m_generation; //increased on every run, so workers know there's new work
+		unsigned int m_busyWorkers;
+		bool m_isStopping;
+
+		const std::function<void(const unsigned int)>* m_task;
+		unsigned int m_taskCount;
+		std::atomic<unsigned int> m_nextTask; //tasks are taken one by one, so threads which got small tasks take more of them
+
+	public:
+		/* Constructors */
+		ThreadPool(); //uses all hardware threads
+		ThreadPool(const unsigned int threadCount);
+
+		/* Destructor */
+		~ThreadPool();
+
+		/* Functions */
+		void run(const unsigned int taskCount, const std::function<void(const unsigned int)>& task); //calls task(index) for every index from 0 to taskCount; returns when all tasks are done
+
+		// Setters
+		void setThreadCount(const unsigned int count); //0 means all hardware threads; waits for workers to finish
+
+		// Getters
+		inline unsigned int getThreadCount() const { return m_workers.size() + 1; }
+
+	private:
+		// Private Functions
+		void m_startWorkers(const unsigned int threadCount);
+		void m_stopWorkers();
+
+		void m_workerLoop(const unsigned int startGeneration); //generation is taken when worker is created, so run called right after doesn't get missed
+		void m_runTasks();
+
+	};
+
+}
+
+
+
+#endif
\ No newline at end of file